@@ -0,0 +1,95 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : clock_mode.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INCS_CLOCK_MODE_H_
+#define INCS_CLOCK_MODE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "USART_driver.h"
+#include "NVIC_driver.h"
+#include "Timer.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#define CLOCK_MODE_LOW_POWER_CLOCK		RCC_SELECT_HSE	// 8 MHz, PLL stopped, still accurate enough for 115200 baud
+#define CLOCK_MODE_ACTIVE_CLOCK			RCC_SELECT_PLL	// 72 MHz
+#define CLOCK_MODE_IDLE_DELAY_MS		2000			// Time without activity before slowing down
+#define CLOCK_MODE_MAX_UARTS			3
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	CLOCK_MODE_LOW_POWER,
+	CLOCK_MODE_ACTIVE
+}Clock_Mode_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+#define CLOCK_MODE_FRAME_BITS			11		// Start, 8 data, parity and stop bits
+#define CLOCK_MODE_RX_IDLE_TIMEOUT_US	5000	// A line held low does not block the switch, below one TIM2 period (50 ms)
+
+/*
+ * =============================================
+ * APIs Supported by "Clock Mode"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- Clock_Mode_Init
+ * @brief 		- Starts the manager in the mode the system clock is already in
+ * @param [in] 	- mode: Current clock mode @ref Clock_Mode_t
+ * @retval 		- None
+ * Note			- Does not switch the clock, removes all the UARTs
+ */
+void Clock_Mode_Init(Clock_Mode_t mode);
+
+/**=============================================
+ * @Fn			- Clock_Mode_Add_UART
+ * @brief 		- Registers a UART whose baudrate must be kept across the switches
+ * @param [in] 	- USARTx: Pointer to the USART instance, already initialized
+ * @retval 		- 1 if registered, 0 if the UART table is full
+ * Note			- The switch waits for its transmission to complete and its RX line to be idle
+ */
+uint8 Clock_Mode_Add_UART(USART_TypeDef* USARTx);
+
+/**=============================================
+ * @Fn			- Clock_Mode_Set
+ * @brief 		- Switches the system clock, the drivers follow through their RCC clock callbacks
+ * @param [in] 	- mode: Requested clock mode @ref Clock_Mode_t
+ * @retval 		- None
+ * Note			- Main context only, busy waits for the UARTs and times the RX line on the TIM2 microsecond count
+ * 				  The interrupts are disabled from the clock switch until the last callback returns
+ */
+void Clock_Mode_Set(Clock_Mode_t mode);
+
+/**=============================================
+ * @Fn			- Clock_Mode_Update
+ * @brief 		- Goes full speed on activity and back to low power after CLOCK_MODE_IDLE_DELAY_MS without it
+ * @param [in] 	- busy: 1 while anything needs full speed (gate session, card frame, admin entry)
+ * @param [in] 	- elapsed_ms: Time since the previous call
+ * @retval 		- None
+ * Note			- Must be called periodically from the main context
+ */
+void Clock_Mode_Update(uint8 busy, uint16 elapsed_ms);
+
+/**=============================================
+ * @Fn			- Clock_Mode_Get
+ * @brief 		- Returns the current clock mode
+ * @param [in] 	- None
+ * @retval 		- Current mode @ref Clock_Mode_t
+ * Note			- None
+ */
+Clock_Mode_t Clock_Mode_Get(void);
+
+#endif /* INCS_CLOCK_MODE_H_ */
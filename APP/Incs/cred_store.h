@@ -0,0 +1,97 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : cred_store.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INCS_CRED_STORE_H_
+#define INCS_CRED_STORE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Platform_Types.h"
+#include "eeprom_emul.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#define CRED_MAX_USERS			3
+#define CRED_UID_MAX_LENGTH		10	// Card UIDs are received as text, e.g. 10 digits for EM4100 cards
+#define CRED_FIRST_KEY			0	// Slot n is saved under the EEPROM key CRED_FIRST_KEY + n
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint8 UID[CRED_UID_MAX_LENGTH];
+	uint8 Length;	// 0 when the slot is empty
+}Cred_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref CRED_RETURN_define
+#define CRED_OK					1
+#define CRED_ERROR				0
+
+#define CRED_NOT_FOUND			0xFF
+
+/*
+ * =============================================
+ * APIs Supported by "Credential Store"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- Cred_Store_Init
+ * @brief 		- Restores the credential slots saved in the EEPROM
+ * @param [in] 	- None
+ * @retval 		- CRED_OK, or CRED_ERROR if the EEPROM is unusable @ref CRED_RETURN_define
+ * Note			- Slots never saved are empty
+ */
+uint8 Cred_Store_Init(void);
+
+/**=============================================
+ * @Fn			- Cred_Store_Set
+ * @brief 		- Saves a UID in a slot, replacing the previous one
+ * @param [in] 	- slot: Slot index (0...CRED_MAX_USERS-1)
+ * @param [in] 	- uid: Pointer to the UID bytes
+ * @param [in] 	- length: Number of UID bytes, 0 empties the slot
+ * @retval 		- CRED_OK or CRED_ERROR @ref CRED_RETURN_define
+ * Note			- Saved in the EEPROM too, CRED_ERROR if that fails while the slot is still updated
+ */
+uint8 Cred_Store_Set(uint8 slot, const uint8* uid, uint8 length);
+
+/**=============================================
+ * @Fn			- Cred_Store_Get
+ * @brief 		- Returns the credential saved in a slot
+ * @param [in] 	- slot: Slot index (0...CRED_MAX_USERS-1)
+ * @retval 		- Pointer to the credential, NULL for an invalid slot
+ * Note			- None
+ */
+const Cred_t* Cred_Store_Get(uint8 slot);
+
+/**=============================================
+ * @Fn			- Cred_Store_Find
+ * @brief 		- Searches the saved credentials for a UID
+ * @param [in] 	- uid: Pointer to the UID bytes
+ * @param [in] 	- length: Number of UID bytes
+ * @retval 		- Slot index of the UID, or CRED_NOT_FOUND
+ * Note			- Empty slots never match
+ */
+uint8 Cred_Store_Find(const uint8* uid, uint8 length);
+
+/**=============================================
+ * @Fn			- Cred_Store_Count
+ * @brief 		- Returns the number of slots holding a UID
+ * @param [in] 	- None
+ * @retval 		- Number of non empty slots (0...CRED_MAX_USERS)
+ * Note			- None
+ */
+uint8 Cred_Store_Count(void);
+
+#endif /* INCS_CRED_STORE_H_ */
@@ -14,9 +14,19 @@
 //----------------------------------------------
 #include "USART_driver.h"
 #include "Servo_Motor.h"
+#include "gate_session.h"
 #include "lcd_driver.h"
+#include "lcd_glyph.h"
+#include "fmt.h"
+#include "lcd_text.h"
+#include "lcd_input.h"
+#include "scheduler.h"
+#include "cred_store.h"
 #include "led_driver.h"
+#include "led_pattern.h"
 #include "keypad_driver.h"
+#include "clock_mode.h"
+#include "irq_priorities.h"
 
 //----------------------------------------------
 // Section: User type definitions
@@ -26,21 +36,32 @@ typedef enum{
 	ID_Found
 }ID_Check_Result;
 
+typedef struct{
+	uint8			Data[CRED_UID_MAX_LENGTH];
+	uint8			Length;
+	volatile uint8	Ready;	// Set when the end of line is received, cleared when the card is read
+}RFID_Frame_t;
+
 //----------------------------------------------
 // Section: Macros Configuration References
 //----------------------------------------------
 
 #define NO_OF_SLOTS				3
-#define USERS_COUNT				3
-#define USER1					0
-#define USER2					1
-#define USER3					2
+#define USERS_COUNT				CRED_MAX_USERS // One admin LCD row per user, 3 at most
+#define ADMIN_ID_COLUMN			7
+#define ADMIN_TASK_PERIOD_MS	20
 #define ENTER_USART_INSTANT		USART1
 #define EXIT_USART_INSTANT		USART2
-#define ENTER_PIR_PORT			GPIOA
-#define ENTER_PIR_PIN			GPIO_PIN_7
-#define EXIT_PIR_PORT			GPIOA
-#define EXIT_PIR_PIN			GPIO_PIN_1
+#define ENTER_PIR				GPIOA, 4 // Pin descriptors @ref GPIO_PIN_DESCRIPTOR_define, EXTI line = pin index
+#define EXIT_PIR				GPIOA, 1 // (PA7 would share EXTI line 7 with keypad COL2 on PB7)
+#define USER_LCD_TEXT_PERIOD_MS	50
+#define USER_LCD_MARQUEE_STEP_MS	300
+#define LED_PATTERN_PERIOD_MS	10
+#define GATE_ENTRY				0 // Index of the arm in the gate servo table
+#define GATE_EXIT				1
+#define GATE_COUNT				2
+#define GATE_SESSION_PERIOD_MS	10
+#define CLOCK_MODE_PERIOD_MS	10
 
 /*
  * =============================================
@@ -62,10 +83,20 @@ void ECU_Init(void);
  * @brief 		- This function is called at the very start of the system to set the users' IDs
  * @param [in] 	- None
  * @retval 		- None
- * Note			- None
+ * Note			- Only starts the entry, the keys are handled by a background task so the gates keep working
+ * 				  '*' deletes the last digit, '#' saves the ID, holding '#' later restarts the entry
  */
 void Admin_Init(void);
 
+/**=============================================
+ * @Fn			- Admin_Restore
+ * @brief 		- Shows the users' IDs restored from the EEPROM and turns the system on
+ * @param [in] 	- None
+ * @retval 		- 1 if every user has a saved ID, 0 if Admin_Init must be called
+ * Note			- Holding '#' still restarts the entry
+ */
+uint8 Admin_Restore(void);
+
 /**=============================================
  * @Fn			- UserLCD_PrintFreeSlots
  * @brief 		- This function prints number of free slots on UserLCD on demand
@@ -75,21 +106,32 @@ void Admin_Init(void);
  */
 void UserLCD_PrintFreeSlots();
 
+/**=============================================
+ * @Fn			- Read_Card
+ * @brief 		- Takes the card UID received on a gate reader and echoes it back on UART
+ * @param [in] 	- _USART: Pointer to the USART instant of the gate reader
+ * @param [out] - _UID: Buffer of CRED_UID_MAX_LENGTH bytes for the UID
+ * @retval 		- Length of the UID, 0 if no complete UID was received
+ * Note			- The reader sends the UID as text terminated by '\r' or '\n'
+ */
+uint8 Read_Card(USART_TypeDef* _USART, uint8* _UID);
+
 /**=============================================
  * @Fn			- Check_ID
  * @brief 		- This function checks for the given ID in the saved IDs and return the result
- * @param [in] 	- _ID: ID to check
+ * @param [in] 	- _UID: ID to check
+ * @param [in] 	- _Length: Length of the ID in bytes
  * @retval 		- IF_Found if found, ID_NOT_Found else
  * Note			- None
  */
-ID_Check_Result Check_ID(uint8 _ID);
+ID_Check_Result Check_ID(const uint8* _UID, uint8 _Length);
 
 /**=============================================
  * @Fn			- Enter_Gate_Open
  * @brief 		- Opens the enter gate and prints on LCD that the gate is open
  * @param [in] 	- None
  * @retval 		- None
- * Note			- None
+ * Note			- Returns immediately, the gate session closes the arm once the car leaves the PIR field
  */
 void Enter_Gate_Open();
 
@@ -98,7 +140,7 @@ void Enter_Gate_Open();
  * @brief 		- Opens the exit gate and prints on LCD that the gate is open
  * @param [in] 	- None
  * @retval 		- None
- * Note			- None
+ * Note			- Returns immediately, the gate session closes the arm once the car leaves the PIR field
  */
 void Exit_Gate_Open();
 
@@ -107,7 +149,7 @@ void Exit_Gate_Open();
  * @brief 		- Triggeres the alarm and prints "UNKOWN ID!" on LCD
  * @param [in] 	- None
  * @retval 		- None
- * Note			- None
+ * Note			- The free slots are printed again once the red LED alarm is over
  */
 void Wrong_RFID();
 
@@ -0,0 +1,112 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : gate_session.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INCS_GATE_SESSION_H_
+#define INCS_GATE_SESSION_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Servo_Motor.h"
+#include "EXTI_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	GATE_SESSION_IDLE,		// Arm closed
+	GATE_SESSION_OPENING,	// Arm moving up
+	GATE_SESSION_WAIT_CAR,	// Arm up, waiting for the car to leave the PIR field
+	GATE_SESSION_CLOSING	// Arm moving down
+}Gate_Session_State_t;
+
+typedef struct{
+	uint8					Servo;			// Index of the arm in the servo table
+	GPIO_TypeDef*			PIR_Port;
+	uint16					PIR_Pin;		// High while a car is in front of the sensor
+	Gate_Session_State_t	State;
+	volatile uint8			Arm_Event;		// Set from the servo interrupt when the arm stops
+	volatile uint8			Arm_Angle;		// Angle reached by the arm
+	volatile uint8			PIR_Event;		// Set from the EXTI interrupt on a PIR falling edge
+	void (*P_Done_CallBack)(void);			// Called from Gate_Session_Update once the arm is closed again
+}Gate_Session_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+#define GATE_ARM_OPEN_ANGLE		90
+#define GATE_ARM_CLOSED_ANGLE	0
+
+/*
+ * =============================================
+ * APIs Supported by "Gate Session"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- Gate_Session_Init
+ * @brief 		- Prepares a gate session and connects its PIR to an EXTI line
+ * @param [out] - session: Pointer to the session state
+ * @param [in] 	- servo: Index of the gate arm in the servo table
+ * @param [in] 	- PIR_Port: Port of the PIR input, must be configured as input
+ * @param [in] 	- PIR_Line: Pin number of the PIR input, also its EXTI line
+ * @param [in] 	- PIR_CallBack: EXTI callback that must call Gate_Session_PIR_Event on this session
+ * @param [in] 	- done_callback: Called when the arm is closed after a car passed, can be NULL
+ * @retval 		- None
+ * Note			- No other port may use the EXTI line of the PIR
+ */
+void Gate_Session_Init(Gate_Session_t* session, uint8 servo, GPIO_TypeDef* PIR_Port, uint8 PIR_Line, void (*PIR_CallBack)(void), void (*done_callback)(void));
+
+/**=============================================
+ * @Fn			- Gate_Session_Open
+ * @brief 		- Starts raising the arm to let a car pass
+ * @param [in] 	- session: Pointer to the session state
+ * @retval 		- None
+ * Note			- Returns immediately, a closing arm goes back up and an open arm stays open
+ */
+void Gate_Session_Open(Gate_Session_t* session);
+
+/**=============================================
+ * @Fn			- Gate_Session_Arm_Event
+ * @brief 		- Reports that the arm of the session stopped
+ * @param [in] 	- session: Pointer to the session state
+ * @param [in] 	- angle: Angle reached by the arm
+ * @retval 		- None
+ * Note			- Called from the servo done callback (interrupt context)
+ */
+void Gate_Session_Arm_Event(Gate_Session_t* session, uint8 angle);
+
+/**=============================================
+ * @Fn			- Gate_Session_PIR_Event
+ * @brief 		- Reports a falling edge of the PIR of the session
+ * @param [in] 	- session: Pointer to the session state
+ * @retval 		- None
+ * Note			- Called from the EXTI callback (interrupt context)
+ */
+void Gate_Session_PIR_Event(Gate_Session_t* session);
+
+/**=============================================
+ * @Fn			- Gate_Session_Update
+ * @brief 		- Handles the pending arm and PIR events of a session
+ * @param [in] 	- session: Pointer to the session state
+ * @retval 		- None
+ * Note			- Called periodically from the main loop, nothing is polled between events
+ */
+void Gate_Session_Update(Gate_Session_t* session);
+
+/**=============================================
+ * @Fn			- Gate_Session_Is_Busy
+ * @brief 		- Checks if the gate is open or moving
+ * @param [in] 	- session: Pointer to the session state
+ * @retval 		- 1 while a car is being let through, 0 when the arm is closed
+ * Note			- None
+ */
+uint8 Gate_Session_Is_Busy(const Gate_Session_t* session);
+
+#endif /* INCS_GATE_SESSION_H_ */
@@ -0,0 +1,42 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : irq_priorities.h 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INCS_IRQ_PRIORITIES_H_
+#define INCS_IRQ_PRIORITIES_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "NVIC_driver.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+/* Interrupt priority plan, applied by ECU_Init before any interrupt is enabled
+ * Card bytes must never be overrun, the time bases come next and the PIR/keypad edges last */
+#define IRQ_PRIO_UART_RX		NVIC_PRIO_0001
+#define IRQ_PRIO_TIMER			NVIC_PRIO_0010	// SysTick scheduler tick and servo timer
+#define IRQ_PRIO_EXTI			NVIC_PRIO_0011
+
+/*
+ * =============================================
+ * APIs Supported by "IRQ Priorities"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- IRQ_Priorities_Init
+ * @brief 		- Applies the priority of every interrupt of the board and of SysTick
+ * @param [in] 	- None
+ * @retval 		- None
+ * Note			- All 4 priority bits are preemption levels, the other interrupts keep priority 0
+ */
+void IRQ_Priorities_Init(void);
+
+#endif /* INCS_IRQ_PRIORITIES_H_ */
@@ -0,0 +1,95 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : scheduler.h 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INCS_SCHEDULER_H_
+#define INCS_SCHEDULER_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "systick_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	SCH_CONTEXT_MAIN,	// Task is dispatched from the main loop, may take time (LCD updates)
+	SCH_CONTEXT_ISR		// Task runs inside the tick interrupt, must be short (input sampling)
+}SCH_Context_t;
+
+typedef struct{
+	void			(*Task)(void);
+	uint16			Period_ms;
+	uint16			Elapsed_ms;
+	SCH_Context_t	Context;
+	volatile uint8	Ready;		// Set by the tick for main context tasks
+	uint32			Max_Cycles;	// Worst case execution time of ISR context tasks, in CPU cycles
+}SCH_Task_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+#define SCH_TICK_MS				1
+#define SCH_MAX_TASKS			8
+#define SCH_INVALID_TASK		0xFF
+
+/*
+ * =============================================
+ * APIs Supported by "Scheduler"
+ * =============================================
+ */
+
+/**=============================================
+ * @Fn			- SCH_Init
+ * @brief 		- Starts the SysTick timer as a periodic 1 ms tick
+ * @param [in] 	- None
+ * @retval 		- None
+ * Note			- MCAL_STK_Delay must not be used after the tick is started as it reprograms SysTick
+ */
+void SCH_Init(void);
+
+/**=============================================
+ * @Fn			- SCH_Add_Task
+ * @brief 		- Registers a periodic task
+ * @param [in] 	- task: Function to be called every period
+ * @param [in] 	- period_ms: Period of the task in milliseconds
+ * @param [in] 	- context: Where the task is executed @ref SCH_Context_t
+ * @retval 		- Task ID, or SCH_INVALID_TASK if the task table is full
+ * Note			- None
+ */
+uint8 SCH_Add_Task(void (*task)(void), uint16 period_ms, SCH_Context_t context);
+
+/**=============================================
+ * @Fn			- SCH_Dispatch
+ * @brief 		- Runs the main context tasks whose period elapsed
+ * @param [in] 	- None
+ * @retval 		- None
+ * Note			- Must be called from the main loop
+ */
+void SCH_Dispatch(void);
+
+/**=============================================
+ * @Fn			- SCH_Get_Ticks
+ * @brief 		- Returns the number of milliseconds since SCH_Init
+ * @param [in] 	- None
+ * @retval 		- Tick counter
+ * Note			- None
+ */
+uint32 SCH_Get_Ticks(void);
+
+/**=============================================
+ * @Fn			- SCH_Get_Task_Cycles
+ * @brief 		- Returns the worst case execution time measured for a task
+ * @param [in] 	- task_id: ID returned by SCH_Add_Task
+ * @retval 		- Execution time in CPU cycles, 0 if unknown
+ * Note			- Measured on the SysTick counter, only for ISR context tasks
+ */
+uint32 SCH_Get_Task_Cycles(uint8 task_id);
+
+#endif /* INCS_SCHEDULER_H_ */
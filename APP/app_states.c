@@ -27,7 +27,11 @@ STATE_API(Init_STATE){
 STATE_API(Admin_STATE){
 	APP_Current_State = Admin_STATE;
 
-	Admin_Init();
+	/* IDs saved on a previous boot skip the entry */
+	if(!Admin_Restore()){
+		Admin_Init();
+	}
+	else{ /* Do Nothing */ }
 
 	Print_Slots_LCD_Flag = 1;
 
@@ -61,55 +65,53 @@ STATE_API(Idle_STATE){
 }
 
 STATE_API(Enter_Gate_STATE){
-	uint8 ID;
+	uint8 UID[CRED_UID_MAX_LENGTH];
+	uint8 UID_Length;
 
 	APP_Current_State = Enter_Gate_STATE;
 
 	/* Clear flag */
 	Enter_Flag = 0;
 
-	/* Get received ID from UART */
-	MCAL_USART_ReceiveData(ENTER_USART_INSTANT, (uint16*)&ID, disable);
-
-	/* Echo the ID on UART */
-	MCAL_USART_SendData(ENTER_USART_INSTANT, (uint16*)&ID, disable);
+	/* Get received ID from UART and echo it */
+	UID_Length = Read_Card(ENTER_USART_INSTANT, UID);
 
-	if(ID_Found == Check_ID(ID)){
+	if(ID_Found == Check_ID(UID, UID_Length)){
 		Free_Slots--;
+		/* Free slots are printed again once the gate is closed */
 		Enter_Gate_Open();
 	}
 	else{
+		/* Free slots are printed again once the alarm is over */
 		Wrong_RFID();
 	}
 
 	fp_App_State_Handler = (Free_Slots > 0) ? STATE_NAME(Idle_STATE) : STATE_NAME(Full_STATE) ;
-	Print_Slots_LCD_Flag = 1;
 }
 
 STATE_API(Exit_Gate_STATE){
-	uint8 ID;
+	uint8 UID[CRED_UID_MAX_LENGTH];
+	uint8 UID_Length;
 
 	APP_Current_State = Exit_Gate_STATE;
 
 	/* Clear flag */
 	Exit_Flag = 0;
 
-	/* Get received ID from UART */
-	MCAL_USART_ReceiveData(EXIT_USART_INSTANT, (uint16*)&ID, disable);
-
-	/* Echo the ID on UART */
-	MCAL_USART_SendData(EXIT_USART_INSTANT, (uint16*)&ID, disable);
+	/* Get received ID from UART and echo it */
+	UID_Length = Read_Card(EXIT_USART_INSTANT, UID);
 
-	if(ID_Found == Check_ID(ID)){
+	if(ID_Found == Check_ID(UID, UID_Length)){
 		Free_Slots++;
+		/* Free slots are printed again once the gate is closed */
 		Exit_Gate_Open();
 	}
 	else{
+		/* Free slots are printed again once the alarm is over */
 		Wrong_RFID();
 	}
 
 	fp_App_State_Handler = (Free_Slots > 0) ? STATE_NAME(Idle_STATE) : STATE_NAME(Full_STATE) ;
-	Print_Slots_LCD_Flag = 1;
 }
 
 STATE_API(Full_STATE){
@@ -0,0 +1,150 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : clock_mode.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "clock_mode.h"
+
+#if (CLOCK_MODE_RX_IDLE_TIMEOUT_US >= 50000)
+#error "CLOCK_MODE_RX_IDLE_TIMEOUT_US must stay below the TIM2 period"
+#endif
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+static Clock_Mode_t Clock_Mode_Current;
+static uint16 Clock_Mode_Idle_ms;
+static USART_TypeDef* Clock_Mode_UARTs[CLOCK_MODE_MAX_UARTS];
+static uint8 Clock_Mode_UARTs_Count;
+
+//----------------------------------------------
+// Section: Static Functions Definitions
+//----------------------------------------------
+
+/* Waits until the RX line stays high for a whole frame, so no character is being received
+ * The times are read on the TIM2 microsecond count, the loop itself takes a variable time */
+static void Clock_Mode_Wait_RX_Idle(USART_TypeDef* USARTx){
+	uint32 baudrate = MCAL_USART_Get_BaudRate(USARTx);
+	uint32 frame_us, start, high_start;
+
+	if(baudrate > 0){
+		frame_us = ((CLOCK_MODE_FRAME_BITS * 1000000UL) / baudrate) + 1;
+		start = Timer2_Get_us();
+		high_start = start;
+		while((Timer2_Elapsed_us(high_start) < frame_us) && (Timer2_Elapsed_us(start) < CLOCK_MODE_RX_IDLE_TIMEOUT_US)){
+			if(!MCAL_USART_Get_RX_Level(USARTx)){
+				high_start = Timer2_Get_us();
+			}
+			else{ /* Do Nothing */ }
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+//----------------------------------------------
+// Section: API Definitions
+//----------------------------------------------
+
+/**=============================================
+ * @Fn			- Clock_Mode_Init
+ * @brief 		- Starts the manager in the mode the system clock is already in
+ * @param [in] 	- mode: Current clock mode @ref Clock_Mode_t
+ * @retval 		- None
+ * Note			- Does not switch the clock, removes all the UARTs
+ */
+void Clock_Mode_Init(Clock_Mode_t mode){
+	Clock_Mode_Current = mode;
+	Clock_Mode_Idle_ms = 0;
+	Clock_Mode_UARTs_Count = 0;
+}
+
+/**=============================================
+ * @Fn			- Clock_Mode_Add_UART
+ * @brief 		- Registers a UART whose baudrate must be kept across the switches
+ * @param [in] 	- USARTx: Pointer to the USART instance, already initialized
+ * @retval 		- 1 if registered, 0 if the UART table is full
+ * Note			- The switch waits for its transmission to complete and its RX line to be idle
+ */
+uint8 Clock_Mode_Add_UART(USART_TypeDef* USARTx){
+	uint8 added = 0;
+
+	if((NULL != USARTx) && (Clock_Mode_UARTs_Count < CLOCK_MODE_MAX_UARTS)){
+		Clock_Mode_UARTs[Clock_Mode_UARTs_Count] = USARTx;
+		Clock_Mode_UARTs_Count++;
+		added = 1;
+	}
+	else{ /* Do Nothing */ }
+
+	return added;
+}
+
+/**=============================================
+ * @Fn			- Clock_Mode_Set
+ * @brief 		- Switches the system clock, the drivers follow through their RCC clock callbacks
+ * @param [in] 	- mode: Requested clock mode @ref Clock_Mode_t
+ * @retval 		- None
+ * Note			- Main context only, busy waits for the UARTs and uses the TIM2 microsecond delay
+ * 				  The interrupts are disabled from the clock switch until the last callback returns
+ */
+void Clock_Mode_Set(Clock_Mode_t mode){
+	uint8 index;
+	uint32 primask;
+
+	if(mode != Clock_Mode_Current){
+		/* A character on the wire while BRR no longer matches the clock would be corrupted */
+		for(index = 0; index < Clock_Mode_UARTs_Count; index++){
+			MCAL_USART_Wait_TC(Clock_Mode_UARTs[index]);
+			Clock_Mode_Wait_RX_Idle(Clock_Mode_UARTs[index]);
+		}
+
+		/* A character received during the PLL lock is still sampled at the old clock,
+		 * the RX data register holds it until the interrupts are enabled again */
+		primask = MCAL_NVIC_Disable_Global_IRQ();
+
+		/* The drivers re-derive their dividers in the RCC clock callbacks, before any interrupt can run */
+		MCAL_RCC_Select_Clock((CLOCK_MODE_ACTIVE == mode) ? CLOCK_MODE_ACTIVE_CLOCK : CLOCK_MODE_LOW_POWER_CLOCK);
+		Clock_Mode_Current = mode;
+
+		MCAL_NVIC_Restore_Global_IRQ(primask);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+ * @Fn			- Clock_Mode_Update
+ * @brief 		- Goes full speed on activity and back to low power after CLOCK_MODE_IDLE_DELAY_MS without it
+ * @param [in] 	- busy: 1 while anything needs full speed (gate session, card frame, admin entry)
+ * @param [in] 	- elapsed_ms: Time since the previous call
+ * @retval 		- None
+ * Note			- Must be called periodically from the main context
+ */
+void Clock_Mode_Update(uint8 busy, uint16 elapsed_ms){
+	if(busy){
+		Clock_Mode_Idle_ms = 0;
+		Clock_Mode_Set(CLOCK_MODE_ACTIVE);
+	}
+	else if(Clock_Mode_Idle_ms < CLOCK_MODE_IDLE_DELAY_MS){
+		Clock_Mode_Idle_ms += elapsed_ms;
+	}
+	else{
+		Clock_Mode_Set(CLOCK_MODE_LOW_POWER);
+	}
+}
+
+/**=============================================
+ * @Fn			- Clock_Mode_Get
+ * @brief 		- Returns the current clock mode
+ * @param [in] 	- None
+ * @retval 		- Current mode @ref Clock_Mode_t
+ * Note			- None
+ */
+Clock_Mode_t Clock_Mode_Get(void){
+	return Clock_Mode_Current;
+}
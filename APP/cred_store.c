@@ -0,0 +1,138 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : cred_store.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <stddef.h>
+#include "cred_store.h"
+
+#if (CRED_UID_MAX_LENGTH > EEPROM_MAX_LENGTH) || ((CRED_FIRST_KEY + CRED_MAX_USERS) > EEPROM_MAX_KEYS)
+#error "The credential slots do not fit in the EEPROM keys"
+#endif
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+static Cred_t Cred_Slots[CRED_MAX_USERS];
+
+//----------------------------------------------
+// Section: API Definitions
+//----------------------------------------------
+
+/**=============================================
+ * @Fn			- Cred_Store_Init
+ * @brief 		- Restores the credential slots saved in the EEPROM
+ * @param [in] 	- None
+ * @retval 		- CRED_OK, or CRED_ERROR if the EEPROM is unusable @ref CRED_RETURN_define
+ * Note			- Slots never saved are empty
+ */
+uint8 Cred_Store_Init(void){
+	uint8 slot, length, index;
+	uint8 value[EEPROM_MAX_LENGTH];
+	uint8 return_value = (EEPROM_OK == EEPROM_Init()) ? CRED_OK : CRED_ERROR;
+
+	/* One scan of the EEPROM page at boot, the admin does not key the IDs again */
+	for(slot = 0; slot < CRED_MAX_USERS; slot++){
+		Cred_Slots[slot].Length = 0;
+		if((EEPROM_OK == EEPROM_Read(CRED_FIRST_KEY + slot, value, &length)) && (length <= CRED_UID_MAX_LENGTH)){
+			for(index = 0; index < length; index++){
+				Cred_Slots[slot].UID[index] = value[index];
+			}
+			Cred_Slots[slot].Length = length;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	return return_value;
+}
+
+/**=============================================
+ * @Fn			- Cred_Store_Set
+ * @brief 		- Saves a UID in a slot, replacing the previous one
+ * @param [in] 	- slot: Slot index (0...CRED_MAX_USERS-1)
+ * @param [in] 	- uid: Pointer to the UID bytes
+ * @param [in] 	- length: Number of UID bytes, 0 empties the slot
+ * @retval 		- CRED_OK or CRED_ERROR @ref CRED_RETURN_define
+ * Note			- None
+ */
+uint8 Cred_Store_Set(uint8 slot, const uint8* uid, uint8 length){
+	uint8 index;
+	uint8 return_value = CRED_ERROR;
+
+	if((slot < CRED_MAX_USERS) && (length <= CRED_UID_MAX_LENGTH)){
+		for(index = 0; index < length; index++){
+			Cred_Slots[slot].UID[index] = uid[index];
+		}
+		Cred_Slots[slot].Length = length;
+		/* Unchanged values are not written again */
+		return_value = (EEPROM_OK == EEPROM_Write(CRED_FIRST_KEY + slot, uid, length)) ? CRED_OK : CRED_ERROR;
+	}
+	else{ /* Do Nothing */ }
+
+	return return_value;
+}
+
+/**=============================================
+ * @Fn			- Cred_Store_Get
+ * @brief 		- Returns the credential saved in a slot
+ * @param [in] 	- slot: Slot index (0...CRED_MAX_USERS-1)
+ * @retval 		- Pointer to the credential, NULL for an invalid slot
+ * Note			- None
+ */
+const Cred_t* Cred_Store_Get(uint8 slot){
+	return (slot < CRED_MAX_USERS) ? &Cred_Slots[slot] : NULL;
+}
+
+/**=============================================
+ * @Fn			- Cred_Store_Find
+ * @brief 		- Searches the saved credentials for a UID
+ * @param [in] 	- uid: Pointer to the UID bytes
+ * @param [in] 	- length: Number of UID bytes
+ * @retval 		- Slot index of the UID, or CRED_NOT_FOUND
+ * Note			- Empty slots never match
+ */
+uint8 Cred_Store_Find(const uint8* uid, uint8 length){
+	uint8 slot, index;
+	uint8 found_slot = CRED_NOT_FOUND;
+
+	for(slot = 0; (slot < CRED_MAX_USERS) && (CRED_NOT_FOUND == found_slot); slot++){
+		if((0 != length) && (length == Cred_Slots[slot].Length)){
+			for(index = 0; (index < length) && (uid[index] == Cred_Slots[slot].UID[index]); index++);
+			if(index == length){
+				found_slot = slot;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	return found_slot;
+}
+
+/**=============================================
+ * @Fn			- Cred_Store_Count
+ * @brief 		- Returns the number of slots holding a UID
+ * @param [in] 	- None
+ * @retval 		- Number of non empty slots (0...CRED_MAX_USERS)
+ * Note			- None
+ */
+uint8 Cred_Store_Count(void){
+	uint8 slot;
+	uint8 count = 0;
+
+	for(slot = 0; slot < CRED_MAX_USERS; slot++){
+		if(0 != Cred_Slots[slot].Length){
+			count++;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	return count;
+}
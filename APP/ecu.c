@@ -17,21 +17,55 @@
 //----------------------------------------------
 void Enter_UART_CallBack(void);
 void Exit_UART_CallBack(void);
+static void UserLCD_Text_Task(void);
+static void Admin_Task(void);
+static void LED_Pattern_Task(void);
+static void Red_LED_Done_CallBack(const LED_Pattern_t* pattern);
+static void Gate_Arm_CallBack(uint8 Servo, uint8 Angle);
+static void Enter_PIR_CallBack(void);
+static void Exit_PIR_CallBack(void);
+static void Gate_Closed_CallBack(void);
+static void Gate_Session_Task(void);
+static void Clock_Mode_Task(void);
+static uint8 RFID_Receive(USART_TypeDef* _USART, RFID_Frame_t* frame);
 
 //----------------------------------------------
 // Section: Global Variables Definitions
 //----------------------------------------------
 static LED_cfg_t Green_LED;
 static LED_cfg_t Red_LED;
+static LED_Pattern_Player_t Green_LED_Pattern;
+static LED_Pattern_Player_t Red_LED_Pattern;
 static LCD_t Admin_LCD;
 static LCD_t User_LCD;
+static LCD_Glyph_Cache_t User_LCD_Glyphs;
+static LCD_Text_t User_LCD_Marquee;
 static USART_cfg_t Enter_Gate_UART;
 static USART_cfg_t Exit_Gate_UART;
-static GPIO_PinConfig_t PIR;
 volatile uint8 Enter_Flag, Exit_Flag;
 uint8 Free_Slots = 3;
 uint8 Print_Slots_LCD_Flag;
-static uint8 Users_IDs[USERS_COUNT];
+static LCD_Input_t Admin_Input;
+static uint8 Admin_User = USERS_COUNT; // User being entered, USERS_COUNT when no entry is running
+static volatile uint8 Wrong_RFID_Shown;  // "UNKNOWN ID!" waits for the end of the red LED alarm
+static RFID_Frame_t Enter_Frame, Exit_Frame;
+static Gate_Session_t Gate_Sessions[GATE_COUNT];
+
+/* Gate arms on TIM4 CH3/CH4, pulse widths measured on each arm, 0 degree is the closed (horizontal) arm */
+static const Servo_t Gate_Servos[GATE_COUNT] = {
+		{GPIOB, GPIO_PIN_8, TIM4, PWM_CHANNEL_3, 500, 1488, 1, GATE_ARM_CLOSED_ANGLE}, // Entry
+		{GPIOB, GPIO_PIN_9, TIM4, PWM_CHANNEL_4, 500, 1488, 1, GATE_ARM_CLOSED_ANGLE}  // Exit
+};
+
+/* The HAL modules mask their interrupt by level, it must match the plan */
+#if (LED_PATTERN_CRITICAL_LEVEL != IRQ_PRIO_TIMER) || (SERVO_CRITICAL_LEVEL != IRQ_PRIO_TIMER)
+#error "LED pattern and servo critical levels must be the timer interrupt priority"
+#endif
+
+static const uint8 Admin_Rows[USERS_COUNT] = {LCD_SECOND_ROW, LCD_THIRD_ROW, LCD_FOURTH_ROW};
+
+/* Custom 5x8 glyphs */
+static const uint8 Car_Glyph[LCD_GLYPH_ROWS] = {0x00, 0x00, 0x0E, 0x11, 0x1F, 0x1F, 0x0A, 0x00};
 
 //----------------------------------------------
 // Section: API Definitions
@@ -45,16 +79,28 @@ static uint8 Users_IDs[USERS_COUNT];
  * Note			- Must be called on boot
  */
 void ECU_Init(void){
-	/* Clock initialization */
-	MCAL_RCC_Enable_Peripheral(RCC_GPIOA);
-	MCAL_RCC_Enable_Peripheral(RCC_GPIOB);
-	MCAL_RCC_Enable_Peripheral(RCC_TIM2);
+	/* Drivers install their handlers directly in the SRAM vector table from here on */
+	MCAL_NVIC_Relocate_Vector_Table();
+
+	/* Interrupt priorities, all 4 bits are preemption levels */
+	IRQ_Priorities_Init();
+	MCAL_NVIC_Critical_Measure_Start();
+
+	/* Clock initialization, 72 MHz from the PLL before any driver derives its dividers */
+	MCAL_RCC_Select_Clock(RCC_SELECT_PLL);
+	MCAL_RCC_Acquire_Peripheral(RCC_GPIOA);
+	MCAL_RCC_Acquire_Peripheral(RCC_GPIOB);
+
+	/* Microsecond time base, used by the LCD timing */
+	Timer2_init();
 
 	/* LEDs initialization */
 	Green_LED.LED_Port = GPIOA;
 	Green_LED.LED_Mode = LED_Active_Low;
 	Green_LED.LED_Pin.GPIO_PinNumber = GPIO_PIN_11;
-	Green_LED.LED_Pin.GPIO_MODE = GPIO_MODE_OUTPUT_PP;
+	Green_LED.LED_Pin.GPIO_MODE = GPIO_MODE_OUTPUT_AF_PP;
+	Green_LED.LED_Timer = TIM1; // TIM1_CH4 on PA11, dimmable
+	Green_LED.LED_Channel = PWM_CHANNEL_4;
 	Green_LED.LED_Pin.GPIO_OUTPUT_SPEED = GPIO_SPEED_10M;
 	LED_Init(&Green_LED);
 
@@ -64,6 +110,9 @@ void ECU_Init(void){
 	Red_LED.LED_Pin.GPIO_MODE = GPIO_MODE_OUTPUT_PP;
 	Red_LED.LED_Pin.GPIO_OUTPUT_SPEED = GPIO_SPEED_10M;
 	LED_Init(&Red_LED);
+	LED_Pattern_Init(&Green_LED_Pattern, &Green_LED);
+	LED_Pattern_Init(&Red_LED_Pattern, &Red_LED);
+	LED_Pattern_Set_Done_CallBack(&Red_LED_Pattern, Red_LED_Done_CallBack);
 
 	/* LCDs initialization */
 	Admin_LCD.Mode = LCD_4BIT;
@@ -89,6 +138,7 @@ void ECU_Init(void){
 	User_LCD.D6_PIN = GPIO_PIN_14;
 	User_LCD.D7_PIN = GPIO_PIN_15;
 	LCD_Init(&User_LCD);
+	LCD_Glyph_Cache_Init(&User_LCD_Glyphs, &User_LCD);
 
 	/* UART initialization */
 	Enter_Gate_UART.USART_Mode = UART_Mode_TX_RX;
@@ -112,21 +162,36 @@ void ECU_Init(void){
 	MCAL_USART_Init(EXIT_USART_INSTANT, &Exit_Gate_UART);
 
 	/* PIRs initialization */
-	PIR.GPIO_MODE = GPIO_MODE_INPUT_FLO;
-	PIR.GPIO_PinNumber = ENTER_PIR_PIN;
-	MCAL_GPIO_Init(ENTER_PIR_PORT, &PIR);
-
-	PIR.GPIO_MODE = GPIO_MODE_INPUT_FLO;
-	PIR.GPIO_PinNumber = EXIT_PIR_PIN;
-	MCAL_GPIO_Init(EXIT_PIR_PORT, &PIR);
+	GPIO_PIN_INIT(ENTER_PIR, GPIO_MODE_INPUT_FLO, 0);
+	GPIO_PIN_INIT(EXIT_PIR, GPIO_MODE_INPUT_FLO, 0);
 
 	/* Servo motors initialization */
-	Timer2_init();
-	Servo1_Entry_Gate_Init();
-	Servo2_Exit_Gate_Init();
+	Servo_Init(Gate_Servos, GATE_COUNT);
+	Servo_Set_Done_CallBack(Gate_Arm_CallBack);
+
+	/* Gate sessions, each arm is closed again on the falling edge of its PIR */
+	Gate_Session_Init(&Gate_Sessions[GATE_ENTRY], GATE_ENTRY, GPIO_PIN_PORT(ENTER_PIR), GPIO_PIN_INDEX(ENTER_PIR), Enter_PIR_CallBack, Gate_Closed_CallBack);
+	Gate_Session_Init(&Gate_Sessions[GATE_EXIT], GATE_EXIT, GPIO_PIN_PORT(EXIT_PIR), GPIO_PIN_INDEX(EXIT_PIR), Exit_PIR_CallBack, Gate_Closed_CallBack);
 
 	/* Keypad initialization */
 	keypad_init();
+
+	/* Users' IDs saved in the flash EEPROM, only entered by the admin when missing */
+	Cred_Store_Init();
+
+	/* Full speed until CLOCK_MODE_IDLE_DELAY_MS without activity, the drivers follow the switches through the RCC callbacks */
+	Clock_Mode_Init(CLOCK_MODE_ACTIVE);
+	Clock_Mode_Add_UART(ENTER_USART_INSTANT);
+	Clock_Mode_Add_UART(EXIT_USART_INSTANT);
+
+	/* Scheduler initialization, the LCD text is animated in the background of the state machine */
+	SCH_Init();
+	SCH_Add_Task(keypad_Scan_Tick, KEYPAD_SCAN_PERIOD_MS, SCH_CONTEXT_ISR);
+	SCH_Add_Task(LED_Pattern_Task, LED_PATTERN_PERIOD_MS, SCH_CONTEXT_ISR);
+	SCH_Add_Task(Admin_Task, ADMIN_TASK_PERIOD_MS, SCH_CONTEXT_MAIN);
+	SCH_Add_Task(UserLCD_Text_Task, USER_LCD_TEXT_PERIOD_MS, SCH_CONTEXT_MAIN);
+	SCH_Add_Task(Gate_Session_Task, GATE_SESSION_PERIOD_MS, SCH_CONTEXT_MAIN);
+	SCH_Add_Task(Clock_Mode_Task, CLOCK_MODE_PERIOD_MS, SCH_CONTEXT_MAIN);
 }
 
 /**=============================================
@@ -137,48 +202,63 @@ void ECU_Init(void){
  * Note			- None
  */
 void Admin_Init(void){
-	uint8 keypad_buffer;
+	Fmt_Sink_t LCD_Sink;
+	uint8 user;
 
 	/* Ask the admin to enter the users' IDs */
+	LCD_Send_Command(&Admin_LCD, LCD_CLEAR_DISPLAY);
 	LCD_Send_string_Pos(&Admin_LCD, (uint8*)"Enter users' IDs", LCD_FIRST_ROW, 1);
 
-	LCD_Send_string_Pos(&Admin_LCD, (uint8*)"User1 ID: ", LCD_SECOND_ROW, 6);
-
-	/* Set user IDs */
-	do{
-		keypad_buffer = keypad_Get_Pressed_Key();
-	}while('F' == keypad_buffer);
-
-	LCD_Send_Char(&Admin_LCD, keypad_buffer);
-	Users_IDs[USER1] = keypad_buffer;
-
-	LCD_Send_string_Pos(&Admin_LCD, (uint8*)"User2 ID: ", LCD_THIRD_ROW, 2);
-
-	do{
-		keypad_buffer = keypad_Get_Pressed_Key();
-	}while('F' == keypad_buffer);
+	Fmt_Sink_LCD(&LCD_Sink, &Admin_LCD);
+	for(user = 0; user < USERS_COUNT; user++){
+		LCD_Set_Cursor(&Admin_LCD, Admin_Rows[user], 1);
+		Fmt_Print(&LCD_Sink, "User%d:", user + 1);
+	}
 
-	LCD_Send_Char(&Admin_LCD, keypad_buffer);
-	Users_IDs[USER2] = keypad_buffer;
+	/* No heartbeat until all the IDs are entered */
+	LED_Pattern_Stop(&Green_LED_Pattern);
 
-	LCD_Send_string_Pos(&Admin_LCD, (uint8*)"User3 ID: ", LCD_FOURTH_ROW, 2);
+	/* Keys are handled by Admin_Task from now on */
+	Admin_User = 0;
+	LCD_Input_Start(&Admin_Input, &Admin_LCD, Admin_Rows[Admin_User], ADMIN_ID_COLUMN, CRED_UID_MAX_LENGTH);
+}
 
-	do{
-		keypad_buffer = keypad_Get_Pressed_Key();
-	}while('F' == keypad_buffer);
+/**=============================================
+ * @Fn			- Admin_Restore
+ * @brief 		- Shows the users' IDs restored from the EEPROM and turns the system on
+ * @param [in] 	- None
+ * @retval 		- 1 if every user has a saved ID, 0 if Admin_Init must be called
+ * Note			- Holding '#' still restarts the entry
+ */
+uint8 Admin_Restore(void){
+	Fmt_Sink_t LCD_Sink;
+	const Cred_t* cred;
+	uint8 user, index;
+	uint8 restored = 0;
+
+	if(USERS_COUNT == Cred_Store_Count()){
+		/* Same screen as at the end of the entry */
+		LCD_Send_Command(&Admin_LCD, LCD_CLEAR_DISPLAY);
+		LCD_Send_string_Pos(&Admin_LCD, (uint8*)"  System is ON  ", LCD_FIRST_ROW, 1);
+
+		Fmt_Sink_LCD(&LCD_Sink, &Admin_LCD);
+		for(user = 0; user < USERS_COUNT; user++){
+			LCD_Set_Cursor(&Admin_LCD, Admin_Rows[user], 1);
+			Fmt_Print(&LCD_Sink, "User%d:", user + 1);
+			cred = Cred_Store_Get(user);
+			LCD_Set_Cursor(&Admin_LCD, Admin_Rows[user], ADMIN_ID_COLUMN);
+			for(index = 0; index < cred->Length; index++){
+				LCD_Send_Char(&Admin_LCD, cred->UID[index]);
+			}
+		}
 
-	LCD_Send_Char(&Admin_LCD, keypad_buffer);
-	Users_IDs[USER3] = keypad_buffer;
+		Admin_User = USERS_COUNT;
+		LED_Pattern_Start(&Green_LED_Pattern, &LED_PATTERN_BREATHE);
+		restored = 1;
+	}
+	else{ /* Do Nothing */ }
 
-	/* Set the default screen for the rest of the program */
-	LCD_Send_Command(&Admin_LCD, LCD_CLEAR_DISPLAY);
-	LCD_Send_string_Pos(&Admin_LCD, (uint8*)"System is ON", LCD_FIRST_ROW, 3);
-	LCD_Send_string_Pos(&Admin_LCD, (uint8*)"User1 ID: ", LCD_SECOND_ROW, 6);
-	LCD_Send_Char(&Admin_LCD, Users_IDs[USER1]);
-	LCD_Send_string_Pos(&Admin_LCD, (uint8*)"User2 ID: ", LCD_THIRD_ROW, 2);
-	LCD_Send_Char(&Admin_LCD, Users_IDs[USER2]);
-	LCD_Send_string_Pos(&Admin_LCD, (uint8*)"User3 ID: ", LCD_FOURTH_ROW, 2);
-	LCD_Send_Char(&Admin_LCD, Users_IDs[USER3]);
+	return restored;
 }
 
 /**=============================================
@@ -189,6 +269,8 @@ void Admin_Init(void){
  * Note			- Must set Print_Slots_LCD_Flag to 1 before calling this function to print
  */
 void UserLCD_PrintFreeSlots(){
+	Fmt_Sink_t LCD_Sink;
+
 	/* Check if we need to print free slots, to avoid unnecessary prints */
 	if(Print_Slots_LCD_Flag){
 		Print_Slots_LCD_Flag = 0;
@@ -196,12 +278,18 @@ void UserLCD_PrintFreeSlots(){
 			LCD_Send_Command(&User_LCD, LCD_CLEAR_DISPLAY);
 			LCD_Send_string_Pos(&User_LCD, (uint8*)"Welcome!", LCD_FIRST_ROW, 4);
 			LCD_Send_string_Pos(&User_LCD, (uint8*)"Parking is full!", LCD_SECOND_ROW, 1);
+			LCD_Text_Start(&User_LCD_Marquee, &User_LCD, (const uint8*)"No free slots, please come back later",
+					LCD_TEXT_MARQUEE, LCD_FOURTH_ROW, 1, USER_LCD_MARQUEE_STEP_MS);
 		}
 		else{
 			LCD_Send_Command(&User_LCD, LCD_CLEAR_DISPLAY);
 			LCD_Send_string_Pos(&User_LCD, (uint8*)"Welcome!", LCD_FIRST_ROW, 4);
-			LCD_Send_Char_Pos(&User_LCD, (Free_Slots+'0'), LCD_SECOND_ROW, 1);
-			LCD_Send_string_Pos(&User_LCD, (uint8*)"Slots free!", LCD_SECOND_ROW, 3);
+			LCD_Send_Char_Pos(&User_LCD, LCD_Glyph_Get(&User_LCD_Glyphs, Car_Glyph), LCD_FIRST_ROW, 13);
+			LCD_Set_Cursor(&User_LCD, LCD_SECOND_ROW, 1);
+			Fmt_Sink_LCD(&LCD_Sink, &User_LCD);
+			Fmt_Print(&LCD_Sink, "%d Slots free!", Free_Slots);
+			LCD_Text_Start(&User_LCD_Marquee, &User_LCD, (const uint8*)"Tap your card on the gate reader to enter",
+					LCD_TEXT_MARQUEE, LCD_FOURTH_ROW, 1, USER_LCD_MARQUEE_STEP_MS);
 		}
 	}
 	else{ /* Do Nothing */ }
@@ -214,19 +302,41 @@ void UserLCD_PrintFreeSlots(){
  * @retval 		- IF_Found if found, ID_NOT_Found else
  * Note			- None
  */
-ID_Check_Result Check_ID(uint8 _ID){
-	uint8 counter;
-	uint8 found_flag = 0;
-
-	for(counter = 0; counter < NO_OF_SLOTS; counter++){
-		if(_ID == Users_IDs[counter]){
-			found_flag = 1;
-			break;
+ID_Check_Result Check_ID(const uint8* _UID, uint8 _Length){
+	return (CRED_NOT_FOUND != Cred_Store_Find(_UID, _Length)) ? ID_Found : ID_NOT_Found;
+}
+
+/**=============================================
+ * @Fn			- Read_Card
+ * @brief 		- Takes the card UID received on a gate reader and echoes it back on UART
+ * @param [in] 	- _USART: Pointer to the USART instant of the gate reader
+ * @param [out] - _UID: Buffer of CRED_UID_MAX_LENGTH bytes for the UID
+ * @retval 		- Length of the UID, 0 if no complete UID was received
+ * Note			- The reader sends the UID as text terminated by '\r' or '\n'
+ */
+uint8 Read_Card(USART_TypeDef* _USART, uint8* _UID){
+	RFID_Frame_t* frame = (ENTER_USART_INSTANT == _USART) ? &Enter_Frame : &Exit_Frame;
+	uint8 length = 0;
+	uint8 index;
+	uint16 data;
+
+	if(frame->Ready){
+		length = frame->Length;
+		for(index = 0; index < length; index++){
+			_UID[index] = frame->Data[index];
+
+			/* Echo the ID on UART */
+			data = _UID[index];
+			MCAL_USART_SendData(_USART, &data, enable);
 		}
-		else{ /* Do Nothing */ }
+
+		/* Release the frame for the next card */
+		frame->Length = 0;
+		frame->Ready = 0;
 	}
+	else{ /* Do Nothing */ }
 
-	return (found_flag == 1) ? ID_Found : ID_NOT_Found;
+	return length;
 }
 
 /**=============================================
@@ -234,26 +344,15 @@ ID_Check_Result Check_ID(uint8 _ID){
  * @brief 		- Opens the enter gate and prints on LCD that the gate is open
  * @param [in] 	- None
  * @retval 		- None
- * Note			- None
+ * Note			- Returns immediately, the gate session closes the arm once the car leaves the PIR field
  */
 void Enter_Gate_Open(){
+	Wrong_RFID_Shown = 0;
+	LCD_Text_Stop(&User_LCD_Marquee);
 	LCD_Send_Command(&User_LCD, LCD_CLEAR_DISPLAY);
 	LCD_Send_String(&User_LCD, (uint8*)"Enter gate open!");
-	Servo1_Entry_Gate(SERVO_UP);
-	LED_TurnOn(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOn(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOn(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	while(MCAL_GPIO_ReadPin(ENTER_PIR_PORT, ENTER_PIR_PIN));
-	Servo1_Entry_Gate(SERVO_DOWN);
+	Gate_Session_Open(&Gate_Sessions[GATE_ENTRY]);
+	LED_Pattern_Start(&Green_LED_Pattern, &LED_PATTERN_BLINK3);
 }
 
 /**=============================================
@@ -261,26 +360,15 @@ void Enter_Gate_Open(){
  * @brief 		- Opens the exit gate and prints on LCD that the gate is open
  * @param [in] 	- None
  * @retval 		- None
- * Note			- None
+ * Note			- Returns immediately, the gate session closes the arm once the car leaves the PIR field
  */
 void Exit_Gate_Open(){
+	Wrong_RFID_Shown = 0;
+	LCD_Text_Stop(&User_LCD_Marquee);
 	LCD_Send_Command(&User_LCD, LCD_CLEAR_DISPLAY);
 	LCD_Send_String(&User_LCD, (uint8*)"Exit gate open!");
-	Servo2_Exit_Gate(SERVO_UP);
-	LED_TurnOn(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOn(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOn(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Green_LED);
-	for(int i = 0; i < 50000; i++);
-	while(MCAL_GPIO_ReadPin(EXIT_PIR_PORT, EXIT_PIR_PIN));
-	Servo2_Exit_Gate(SERVO_DOWN);
+	Gate_Session_Open(&Gate_Sessions[GATE_EXIT]);
+	LED_Pattern_Start(&Green_LED_Pattern, &LED_PATTERN_BLINK3);
 }
 
 /**=============================================
@@ -288,25 +376,14 @@ void Exit_Gate_Open(){
  * @brief 		- Triggeres the alarm and prints "UNKOWN ID!" on LCD
  * @param [in] 	- None
  * @retval 		- None
- * Note			- None
+ * Note			- The free slots are printed again once the red LED alarm is over
  */
 void Wrong_RFID(){
+	LCD_Text_Stop(&User_LCD_Marquee);
 	LCD_Send_Command(&User_LCD, LCD_CLEAR_DISPLAY);
 	LCD_Send_String(&User_LCD, (uint8*)"UNKNOWN ID!");
-	Servo1_Entry_Gate(SERVO_DOWN);
-	Servo2_Exit_Gate(SERVO_DOWN);
-	LED_TurnOn(&Red_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Red_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOn(&Red_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Red_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOn(&Red_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Red_LED);
-	for(int i = 0; i < 50000; i++);
+	Wrong_RFID_Shown = 1;
+	LED_Pattern_Start(&Red_LED_Pattern, &LED_PATTERN_BLINK3);
 }
 
 /**=============================================
@@ -317,38 +394,153 @@ void Wrong_RFID(){
  * Note			- None
  */
 void Trigger_Alarm(USART_TypeDef* _USART){
-	uint8 ID;
-	/* Flush UART buffer and flash red LED */
-
-	/* Get received ID from UART */
-	MCAL_USART_ReceiveData(_USART, (uint16*)&ID, disable);
-
-	/* Echo the ID on UART */
-	MCAL_USART_SendData(_USART, (uint16*)&ID, disable);
-
-	LED_TurnOn(&Red_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Red_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOn(&Red_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Red_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOn(&Red_LED);
-	for(int i = 0; i < 50000; i++);
-	LED_TurnOff(&Red_LED);
-	for(int i = 0; i < 50000; i++);
+	uint8 UID[CRED_UID_MAX_LENGTH];
+
+	/* Get received ID from UART and echo it */
+	(void)Read_Card(_USART, UID);
+
+	/* Flash the red LED in the background, takes over a running red pattern */
+	LED_Pattern_Start(&Red_LED_Pattern, &LED_PATTERN_FAST_ALARM);
 }
 
 void Enter_UART_CallBack(void){
-	Enter_Flag = 1;
+	if(RFID_Receive(ENTER_USART_INSTANT, &Enter_Frame)){
+		Enter_Flag = 1;
+	}
+	else{ /* Do Nothing */ }
 }
 
 void Exit_UART_CallBack(void){
-	Exit_Flag = 1;
+	if(RFID_Receive(EXIT_USART_INSTANT, &Exit_Frame)){
+		Exit_Flag = 1;
+	}
+	else{ /* Do Nothing */ }
 }
 
 //----------------------------------------------
 // Section: Static Functions Definitions
 //----------------------------------------------
 
+/* Scheduler task, advances the scrolling text of the user LCD */
+static void UserLCD_Text_Task(void){
+	LCD_Text_Update(&User_LCD_Marquee, USER_LCD_TEXT_PERIOD_MS);
+}
+
+/* Scheduler task, feeds the keypad events to the users' IDs entry */
+static void Admin_Task(void){
+	Keypad_Event_t event;
+
+	while(keypad_Get_Event(&event)){
+		if(Admin_User < USERS_COUNT){
+			/* Holding backspace keeps deleting */
+			if((KEYPAD_EVENT_PRESS == event.Type) ||
+					((KEYPAD_EVENT_REPEAT == event.Type) && (LCD_INPUT_KEY_BACKSPACE == event.Key))){
+				if(LCD_INPUT_DONE == LCD_Input_Process_Key(&Admin_Input, event.Key)){
+					Cred_Store_Set(Admin_User, Admin_Input.Buffer, Admin_Input.Length);
+					Admin_User++;
+					if(Admin_User < USERS_COUNT){
+						LCD_Input_Start(&Admin_Input, &Admin_LCD, Admin_Rows[Admin_User], ADMIN_ID_COLUMN, CRED_UID_MAX_LENGTH);
+					}
+					else{
+						/* Entered IDs stay on screen under the status line */
+						LCD_Send_string_Pos(&Admin_LCD, (uint8*)"  System is ON  ", LCD_FIRST_ROW, 1);
+						/* Green LED breathes while the system is on, gate blinks interrupt it */
+						LED_Pattern_Start(&Green_LED_Pattern, &LED_PATTERN_BREATHE);
+					}
+				}
+				else{ /* Do Nothing */ }
+			}
+			else{ /* Do Nothing */ }
+		}
+		else if((KEYPAD_EVENT_LONG_PRESS == event.Type) && (LCD_INPUT_KEY_ENTER == event.Key)){
+			Admin_Init();
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+/* LED pattern tick, runs in the tick interrupt so the LEDs keep blinking while a gate waits for a car */
+static void LED_Pattern_Task(void){
+	LED_Pattern_Update(&Green_LED_Pattern, LED_PATTERN_PERIOD_MS);
+	LED_Pattern_Update(&Red_LED_Pattern, LED_PATTERN_PERIOD_MS);
+}
+
+/* Red LED pattern done, called from the tick interrupt: "UNKNOWN ID!" stayed on screen
+ * during the whole alarm and the free slots replace it, unless a gate opened meanwhile */
+static void Red_LED_Done_CallBack(const LED_Pattern_t* pattern){
+	(void)pattern;
+	if(Wrong_RFID_Shown){
+		Wrong_RFID_Shown = 0;
+		Print_Slots_LCD_Flag = 1;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Servo done callback, called from the servo timer interrupt when an arm reaches its position */
+static void Gate_Arm_CallBack(uint8 Servo, uint8 Angle){
+	if(Servo < GATE_COUNT){
+		Gate_Session_Arm_Event(&Gate_Sessions[Servo], Angle);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* PIR falling edges, the car left the gate */
+static void Enter_PIR_CallBack(void){
+	Gate_Session_PIR_Event(&Gate_Sessions[GATE_ENTRY]);
+}
+
+static void Exit_PIR_CallBack(void){
+	Gate_Session_PIR_Event(&Gate_Sessions[GATE_EXIT]);
+}
+
+/* A car passed and its gate is closed again, the free slots replace the gate message */
+static void Gate_Closed_CallBack(void){
+	Print_Slots_LCD_Flag = 1;
+}
+
+static void Gate_Session_Task(void){
+	uint8 gate;
+	for(gate = 0; gate < GATE_COUNT; gate++){
+		Gate_Session_Update(&Gate_Sessions[gate]);
+	}
+}
+
+/* Full speed while a card is waiting, a gate moves or the admin types, low power otherwise */
+static void Clock_Mode_Task(void){
+	uint8 gate;
+	uint8 busy = Enter_Flag || Exit_Flag || (Admin_User < USERS_COUNT);
+
+	for(gate = 0; gate < GATE_COUNT; gate++){
+		busy |= Gate_Session_Is_Busy(&Gate_Sessions[gate]);
+	}
+	Clock_Mode_Update(busy, CLOCK_MODE_PERIOD_MS);
+}
+
+/* Collects the UID characters of a gate reader, called from its RX interrupt
+ * Returns 1 when a complete UID is ready, characters are dropped until it is read */
+static uint8 RFID_Receive(USART_TypeDef* _USART, RFID_Frame_t* frame){
+	uint16 data;
+	uint8 complete = 0;
+
+	/* Reading the data register also clears the RX interrupt */
+	MCAL_USART_ReceiveData(_USART, &data, disable);
+
+	if(!frame->Ready){
+		if(('\r' == data) || ('\n' == data)){
+			/* Empty lines, like the second half of "\r\n", are ignored */
+			if(frame->Length > 0){
+				frame->Ready = 1;
+				complete = 1;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else if(frame->Length < CRED_UID_MAX_LENGTH){
+			frame->Data[frame->Length] = (uint8)data;
+			frame->Length++;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+
+	return complete;
+}
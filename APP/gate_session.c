@@ -0,0 +1,164 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : gate_session.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "gate_session.h"
+
+//----------------------------------------------
+// Section: Private Functions
+//----------------------------------------------
+
+/* The arm is lowered once nothing is in front of the sensor */
+static void Gate_Session_Check_Car(Gate_Session_t* session){
+	if(0 == (session->PIR_Port->IDR & session->PIR_Pin)){
+		session->State = GATE_SESSION_CLOSING;
+		Servo_Set(session->Servo, GATE_ARM_CLOSED_ANGLE);
+	}
+	else{
+		session->State = GATE_SESSION_WAIT_CAR;
+	}
+}
+
+//----------------------------------------------
+// Section: API Definitions
+//----------------------------------------------
+
+/**=============================================
+ * @Fn			- Gate_Session_Init
+ * @brief 		- Prepares a gate session and connects its PIR to an EXTI line
+ * @param [out] - session: Pointer to the session state
+ * @param [in] 	- servo: Index of the gate arm in the servo table
+ * @param [in] 	- PIR_Port: Port of the PIR input, must be configured as input
+ * @param [in] 	- PIR_Line: Pin number of the PIR input, also its EXTI line
+ * @param [in] 	- PIR_CallBack: EXTI callback that must call Gate_Session_PIR_Event on this session
+ * @param [in] 	- done_callback: Called when the arm is closed after a car passed, can be NULL
+ * @retval 		- None
+ * Note			- No other port may use the EXTI line of the PIR
+ */
+void Gate_Session_Init(Gate_Session_t* session, uint8 servo, GPIO_TypeDef* PIR_Port, uint8 PIR_Line, void (*PIR_CallBack)(void), void (*done_callback)(void)){
+	EXTI_PinConfig_t EXTI_Cfg;
+
+	session->Servo = servo;
+	session->PIR_Port = PIR_Port;
+	session->PIR_Pin = (uint16)(1U << PIR_Line);
+	session->State = GATE_SESSION_IDLE;
+	session->Arm_Event = 0;
+	session->PIR_Event = 0;
+	session->P_Done_CallBack = done_callback;
+
+	/* The car leaving the sensor field is the only edge of interest */
+	EXTI_Cfg.GPIO_Port = PIR_Port;
+	EXTI_Cfg.Line = PIR_Line;
+	EXTI_Cfg.Trigger = EXTI_TRIGGER_FALLING;
+	EXTI_Cfg.IRQ_EN = EXTI_IRQ_ENABLE;
+	EXTI_Cfg.P_IRQ_CallBack = PIR_CallBack;
+	MCAL_EXTI_Init(&EXTI_Cfg);
+}
+
+/**=============================================
+ * @Fn			- Gate_Session_Open
+ * @brief 		- Starts raising the arm to let a car pass
+ * @param [in] 	- session: Pointer to the session state
+ * @retval 		- None
+ * Note			- Returns immediately, a closing arm goes back up and an open arm stays open
+ */
+void Gate_Session_Open(Gate_Session_t* session){
+	if(GATE_SESSION_WAIT_CAR != session->State){
+		session->State = GATE_SESSION_OPENING;
+		Servo_Set(session->Servo, GATE_ARM_OPEN_ANGLE);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+ * @Fn			- Gate_Session_Arm_Event
+ * @brief 		- Reports that the arm of the session stopped
+ * @param [in] 	- session: Pointer to the session state
+ * @param [in] 	- angle: Angle reached by the arm
+ * @retval 		- None
+ * Note			- Called from the servo done callback (interrupt context)
+ */
+void Gate_Session_Arm_Event(Gate_Session_t* session, uint8 angle){
+	session->Arm_Angle = angle;
+	session->Arm_Event = 1;
+}
+
+/**=============================================
+ * @Fn			- Gate_Session_PIR_Event
+ * @brief 		- Reports a falling edge of the PIR of the session
+ * @param [in] 	- session: Pointer to the session state
+ * @retval 		- None
+ * Note			- Called from the EXTI callback (interrupt context)
+ */
+void Gate_Session_PIR_Event(Gate_Session_t* session){
+	session->PIR_Event = 1;
+}
+
+/**=============================================
+ * @Fn			- Gate_Session_Update
+ * @brief 		- Handles the pending arm and PIR events of a session
+ * @param [in] 	- session: Pointer to the session state
+ * @retval 		- None
+ * Note			- Called periodically from the main loop, nothing is polled between events
+ */
+void Gate_Session_Update(Gate_Session_t* session){
+	uint8 arm_event = session->Arm_Event;
+	uint8 PIR_event = session->PIR_Event;
+
+	/* Events are consumed before acting so a new one raised meanwhile is kept */
+	if(arm_event){
+		session->Arm_Event = 0;
+	}
+	else{ /* Do Nothing */ }
+	if(PIR_event){
+		session->PIR_Event = 0;
+	}
+	else{ /* Do Nothing */ }
+
+	switch(session->State){
+	case GATE_SESSION_OPENING:
+		/* The car may only pass once the arm is really up */
+		if(arm_event && (GATE_ARM_OPEN_ANGLE == session->Arm_Angle)){
+			Gate_Session_Check_Car(session);
+		}
+		else{ /* Do Nothing */ }
+		break;
+	case GATE_SESSION_WAIT_CAR:
+		if(PIR_event){
+			Gate_Session_Check_Car(session);
+		}
+		else{ /* Do Nothing */ }
+		break;
+	case GATE_SESSION_CLOSING:
+		if(arm_event && (GATE_ARM_CLOSED_ANGLE == session->Arm_Angle)){
+			session->State = GATE_SESSION_IDLE;
+			if(NULL != session->P_Done_CallBack){
+				session->P_Done_CallBack();
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+		break;
+	default:
+		break;
+	}
+}
+
+/**=============================================
+ * @Fn			- Gate_Session_Is_Busy
+ * @brief 		- Checks if the gate is open or moving
+ * @param [in] 	- session: Pointer to the session state
+ * @retval 		- 1 while a car is being let through, 0 when the arm is closed
+ * Note			- None
+ */
+uint8 Gate_Session_Is_Busy(const Gate_Session_t* session){
+	return (GATE_SESSION_IDLE != session->State);
+}
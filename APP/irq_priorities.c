@@ -0,0 +1,51 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : irq_priorities.c 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "irq_priorities.h"
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+
+/* Interrupt priority plan, SysTick is set apart as it is a system exception */
+static const struct{
+	uint8 IRQn;
+	uint8 Priority;
+}IRQ_Priorities[] = {
+		{USART1_IRQ,	IRQ_PRIO_UART_RX},	// Enter gate reader
+		{USART2_IRQ,	IRQ_PRIO_UART_RX},	// Exit gate reader
+		{TIM4_IRQ,		IRQ_PRIO_TIMER},	// Servo steps
+		{EXTI1_IRQ,		IRQ_PRIO_EXTI},		// Exit PIR
+		{EXTI4_IRQ,		IRQ_PRIO_EXTI},		// Enter PIR
+		{EXTI9_IRQ,		IRQ_PRIO_EXTI}		// Keypad columns (lines 5..9)
+};
+
+//----------------------------------------------
+// Section: API Definitions
+//----------------------------------------------
+
+/**=============================================
+ * @Fn			- IRQ_Priorities_Init
+ * @brief 		- Applies the priority of every interrupt of the board and of SysTick
+ * @param [in] 	- None
+ * @retval 		- None
+ * Note			- All 4 priority bits are preemption levels, the other interrupts keep priority 0
+ */
+void IRQ_Priorities_Init(void){
+	uint8 index;
+
+	MCAL_NVIC_SetPriorityGrouping(NVIC_PRIO_16GRP_0SUBGRP);
+	for(index = 0; index < (sizeof(IRQ_Priorities) / sizeof(IRQ_Priorities[0])); index++){
+		MCAL_NVIC_SetPriority(IRQ_Priorities[index].IRQn, IRQ_Priorities[index].Priority);
+	}
+	MCAL_NVIC_SetSystemPriority(NVIC_SYSTICK_EXCEPTION, IRQ_PRIO_TIMER);
+}
@@ -12,8 +12,10 @@
 extern void (*fp_App_State_Handler)();
 
 int main(){
-	/* The system will initialize and run based on a state machine no need to do anything in main */
-	while(1)
+	/* The system will initialize and run based on a state machine, background tasks are dispatched between states */
+	while(1){
+		SCH_Dispatch();
 		fp_App_State_Handler();
+	}
 	return 0;
 }
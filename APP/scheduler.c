@@ -0,0 +1,165 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : scheduler.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "scheduler.h"
+#include "RCC_driver.h"
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+static SCH_Task_t SCH_Tasks[SCH_MAX_TASKS];
+static uint8 SCH_Tasks_Count;
+static volatile uint32 SCH_Ticks;
+
+//----------------------------------------------
+// Section: Static Functions Definitions
+//----------------------------------------------
+
+static void SCH_Tick(void){
+	uint8 index;
+	uint32 start, cycles;
+
+	SCH_Ticks++;
+
+	for(index = 0; index < SCH_Tasks_Count; index++){
+		SCH_Tasks[index].Elapsed_ms += SCH_TICK_MS;
+		if(SCH_Tasks[index].Elapsed_ms >= SCH_Tasks[index].Period_ms){
+			SCH_Tasks[index].Elapsed_ms = 0;
+			if(SCH_CONTEXT_ISR == SCH_Tasks[index].Context){
+				/* SysTick counts down at the CPU clock, the task is much shorter than one tick */
+				start = STK->VAL;
+				SCH_Tasks[index].Task();
+				cycles = start - STK->VAL;
+				if(cycles > STK->LOAD){
+					cycles += STK->LOAD + 1;
+				}
+				else{ /* Do Nothing */ }
+				if(cycles > SCH_Tasks[index].Max_Cycles){
+					SCH_Tasks[index].Max_Cycles = cycles;
+				}
+				else{ /* Do Nothing */ }
+			}
+			else{
+				SCH_Tasks[index].Ready = 1;
+			}
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+/* Clock change callback, keeps the 1 ms tick, the running tick is restarted so one tick can come early */
+static void SCH_Reclock(void){
+	RCC_ClockTree_t tree;
+
+	MCAL_RCC_Get_Clock_Tree(&tree);
+	MCAL_STK_SetReload(((tree.HCLK / 1000UL) * SCH_TICK_MS) - 1);
+
+	/* Writing VAL clears it, the new reload is loaded at the next SysTick clock */
+	STK->VAL = 0;
+}
+
+//----------------------------------------------
+// Section: API Definitions
+//----------------------------------------------
+
+/**=============================================
+ * @Fn			- SCH_Init
+ * @brief 		- Starts the SysTick timer as a periodic 1 ms tick
+ * @param [in] 	- None
+ * @retval 		- None
+ * Note			- MCAL_STK_Delay must not be used after the tick is started as it reprograms SysTick
+ */
+void SCH_Init(void){
+	STK_config_t Tick_cfg;
+	RCC_ClockTree_t tree;
+
+	MCAL_RCC_Get_Clock_Tree(&tree);
+
+	Tick_cfg.running_mode = STK_PERIODIC_MODE;
+	Tick_cfg.clock_config = STK_CLK_AHB;
+	Tick_cfg.interrupt_config = STK_INTERRUPT_ENABLED;
+	Tick_cfg.reload_value = ((tree.HCLK / 1000UL) * SCH_TICK_MS) - 1;
+	Tick_cfg.Callback_Function = SCH_Tick;
+	MCAL_STK_Config(&Tick_cfg);
+	MCAL_STK_StartTimer();
+	MCAL_RCC_Add_Clock_CallBack(SCH_Reclock);
+}
+
+/**=============================================
+ * @Fn			- SCH_Add_Task
+ * @brief 		- Registers a periodic task
+ * @param [in] 	- task: Function to be called every period
+ * @param [in] 	- period_ms: Period of the task in milliseconds
+ * @param [in] 	- context: Where the task is executed @ref SCH_Context_t
+ * @retval 		- Task ID, or SCH_INVALID_TASK if the task table is full
+ * Note			- None
+ */
+uint8 SCH_Add_Task(void (*task)(void), uint16 period_ms, SCH_Context_t context){
+	uint8 task_id = SCH_INVALID_TASK;
+
+	if((NULL != task) && (SCH_Tasks_Count < SCH_MAX_TASKS)){
+		task_id = SCH_Tasks_Count;
+		SCH_Tasks[task_id].Task = task;
+		SCH_Tasks[task_id].Period_ms = (period_ms > 0) ? period_ms : SCH_TICK_MS;
+		SCH_Tasks[task_id].Elapsed_ms = 0;
+		SCH_Tasks[task_id].Context = context;
+		SCH_Tasks[task_id].Ready = 0;
+		SCH_Tasks[task_id].Max_Cycles = 0;
+
+		/* Publish the entry only when it is complete, the tick may be running */
+		SCH_Tasks_Count++;
+	}
+	else{ /* Do Nothing */ }
+
+	return task_id;
+}
+
+/**=============================================
+ * @Fn			- SCH_Dispatch
+ * @brief 		- Runs the main context tasks whose period elapsed
+ * @param [in] 	- None
+ * @retval 		- None
+ * Note			- Must be called from the main loop
+ */
+void SCH_Dispatch(void){
+	uint8 index;
+
+	for(index = 0; index < SCH_Tasks_Count; index++){
+		if(SCH_Tasks[index].Ready){
+			SCH_Tasks[index].Ready = 0;
+			SCH_Tasks[index].Task();
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+/**=============================================
+ * @Fn			- SCH_Get_Ticks
+ * @brief 		- Returns the number of milliseconds since SCH_Init
+ * @param [in] 	- None
+ * @retval 		- Tick counter
+ * Note			- None
+ */
+uint32 SCH_Get_Ticks(void){
+	return SCH_Ticks;
+}
+
+/**=============================================
+ * @Fn			- SCH_Get_Task_Cycles
+ * @brief 		- Returns the worst case execution time measured for a task
+ * @param [in] 	- task_id: ID returned by SCH_Add_Task
+ * @retval 		- Execution time in CPU cycles, 0 if unknown
+ * Note			- Measured on the SysTick counter, only for ISR context tasks
+ */
+uint32 SCH_Get_Task_Cycles(uint8 task_id){
+	return (task_id < SCH_Tasks_Count) ? SCH_Tasks[task_id].Max_Cycles : 0;
+}
@@ -12,17 +12,44 @@
 
 #include "STM32F103x8.h"
 #include "gpio_driver.h"
-#include "Timer.h"
-
-#define SERVO_UP		0
-#define SERVO_DOWN		1
-
-
-void Servo1_Entry_Gate_Init(void);
-void Servo1_Entry_Gate(uint8 Direction);
-
-void Servo2_Exit_Gate_Init(void);
-void Servo2_Exit_Gate(uint8 Direction);
+#include "PWM_driver.h"
+#include "motion_profile.h"
+
+//One servo output: pin, timer channel and calibration of the arm
+typedef struct
+{
+	GPIO_TypeDef*	Port;
+	uint16			Pin;			//Must be the output pin of the timer channel
+	TIM_TypeDef*	Timer;
+	uint8			Channel;		//@ref PWM_CHANNEL_define
+	uint16			Min_Pulse_us;	//Pulse width at one end of the travel
+	uint16			Max_Pulse_us;	//Pulse width at the other end
+	uint8			Inverted;		//0: 0 degree is Min_Pulse_us, 1: 0 degree is Max_Pulse_us
+	uint8			Initial_Angle;	//Angle held from power up
+}Servo_t;
+
+#define SERVO_MAX_COUNT			8
+#define SERVO_MAX_ANGLE			90			//Angle of Max_Pulse_us (or Min_Pulse_us if inverted)
+
+//All servo timers run at 50HZ with a 1us tick
+#define SERVO_TICK_FREQUENCY	1000000UL
+#define SERVO_PERIOD_US			20000
+#define SERVO_PERIOD_MS			20
+#define SERVO_CRITICAL_LEVEL	NVIC_PRIO_0010	//BASEPRI level masking the TIM4 update that steps the motion
+
+//Arm motion, positions are pulse widths so speeds are in us of pulse width
+#define SERVO_MOTION_SHAPE		MOTION_SCURVE
+#define SERVO_MAX_VELOCITY		1000		//us per second
+#define SERVO_ACCELERATION		2000		//us per second^2
+
+
+//Servos[] must stay valid, the IDs used by the other functions are indexes in it
+void Servo_Init(const Servo_t* Servos, uint8 Count);
+void Servo_Set(uint8 Servo, uint8 Angle);
+uint8 Servo_Is_Moving(uint8 Servo);
+
+//CallBack is called from the timer interrupt with the servo ID and the reached angle
+void Servo_Set_Done_CallBack(void (*CallBack)(uint8 Servo, uint8 Angle));
 
 
 
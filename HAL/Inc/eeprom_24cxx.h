@@ -0,0 +1,74 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : eeprom_24cxx.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_EEPROM_24CXX_H_
+#define INC_EEPROM_24CXX_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "I2C_driver.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#define AT24_I2C_INSTANT		I2C1
+#define AT24_I2C_SPEED			I2C_SPEED_FAST
+#define AT24_ADDRESS			0x50	// A2...A0 tied low
+#define AT24_SIZE				4096UL	// 24C32, two address bytes
+#define AT24_PAGE_SIZE			32		// A write must not cross a page, the address wraps inside it
+#define AT24_ACK_POLL_TRIES		500		// About 30 us each at 400 kHz, covers the 5 ms write cycle
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref AT24_RETURN_define
+#define AT24_OK					1
+#define AT24_ERROR				0
+
+/*
+ * =============================================
+ * APIs Supported by "24Cxx EEPROM"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- AT24_Init
+  * @brief 			- Initializes the I2C bus of the EEPROM
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- AT24_OK if the EEPROM answers, AT24_ERROR otherwise @ref AT24_RETURN_define
+  * Note			- None
+  */
+uint8 AT24_Init(void);
+
+/**=============================================
+  * @Fn				- AT24_Read
+  * @brief 			- Reads consecutive bytes in one sequential read
+  * @param [in] 	- address: First byte address
+  * @param [out] 	- data: Buffer of length bytes
+  * @param [in] 	- length: Number of bytes
+  * @retval 		- AT24_OK or AT24_ERROR @ref AT24_RETURN_define
+  * Note			- Waits for the end of a previous write cycle first
+  */
+uint8 AT24_Read(uint16 address, uint8* data, uint16 length);
+
+/**=============================================
+  * @Fn				- AT24_Write
+  * @brief 			- Writes consecutive bytes, one page write per page touched
+  * @param [in] 	- address: First byte address
+  * @param [in] 	- data: Pointer to the bytes
+  * @param [in] 	- length: Number of bytes
+  * @retval 		- AT24_OK or AT24_ERROR @ref AT24_RETURN_define
+  * Note			- Returns once the last page is sent, its write cycle is awaited by the next access (ACK polling)
+  * 				  Main context only
+  */
+uint8 AT24_Write(uint16 address, const uint8* data, uint16 length);
+
+#endif /* INC_EEPROM_24CXX_H_ */
@@ -0,0 +1,76 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : eeprom_emul.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_EEPROM_EMUL_H_
+#define INC_EEPROM_EMUL_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "FLASH_driver.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+/* Last two pages of the flash, the linker FLASH region must stop before them (LENGTH = 62K on the C8)
+ * EEPROM_Init refuses to touch them if the program image reaches page 0 */
+#define EEPROM_PAGE0_ADDRESS	(FLASH_MEMORY_BASE + FLASH_MEMORY_SIZE - (2UL * FLASH_PAGE_SIZE))
+#define EEPROM_PAGE1_ADDRESS	(EEPROM_PAGE0_ADDRESS + FLASH_PAGE_SIZE)
+#define EEPROM_MAX_KEYS			16		// Keys are 0...EEPROM_MAX_KEYS-1
+#define EEPROM_MAX_LENGTH		16		// Bytes per value
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref EEPROM_RETURN_define
+#define EEPROM_OK				1
+#define EEPROM_ERROR			0
+
+/*
+ * =============================================
+ * APIs Supported by "Emulated EEPROM"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- EEPROM_Init
+  * @brief 			- Finds the active page, finishes an interrupted page transfer and indexes the saved values
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- EEPROM_OK or EEPROM_ERROR @ref EEPROM_RETURN_define
+  * Note			- Formats both pages if none is valid (first boot), one page scan otherwise
+  * 				  Fails without any flash access if the program image ends after EEPROM_PAGE0_ADDRESS
+  */
+uint8 EEPROM_Init(void);
+
+/**=============================================
+  * @Fn				- EEPROM_Read
+  * @brief 			- Reads the last value written to a key
+  * @param [in] 	- key: Key of the value (0...EEPROM_MAX_KEYS-1)
+  * @param [out] 	- data: Buffer of EEPROM_MAX_LENGTH bytes
+  * @param [out] 	- length: Number of bytes read
+  * @retval 		- EEPROM_OK if the key has a value, EEPROM_ERROR otherwise @ref EEPROM_RETURN_define
+  * Note			- None
+  */
+uint8 EEPROM_Read(uint8 key, uint8* data, uint8* length);
+
+/**=============================================
+  * @Fn				- EEPROM_Write
+  * @brief 			- Appends a new value of a key to the active page
+  * @param [in] 	- key: Key of the value (0...EEPROM_MAX_KEYS-1)
+  * @param [in] 	- data: Pointer to the value bytes
+  * @param [in] 	- length: Number of bytes (0...EEPROM_MAX_LENGTH), 0 deletes the key
+  * @param [out] 	- None
+  * @retval 		- EEPROM_OK or EEPROM_ERROR @ref EEPROM_RETURN_define
+  * Note			- Writing the saved value again costs nothing, a full page is compacted to the other one first
+  * 				  Main context only, the flash stalls the core for about 20 ms per page erase
+  */
+uint8 EEPROM_Write(uint8 key, const uint8* data, uint8 length);
+
+#endif /* INC_EEPROM_EMUL_H_ */
@@ -0,0 +1,162 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : fmt.h 			                             		 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_FMT_H_
+#define INC_FMT_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <stdarg.h>
+#include "lcd_driver.h"
+#include "USART_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	void	(*Put)(void* Context, uint8 Char); // Output function of the sink
+	void*	Context;						   // Passed back to Put (LCD, USART instance or buffer)
+	uint16	Count;							   // Number of characters written so far
+}Fmt_Sink_t;
+
+typedef struct{
+	uint8*	Data;	// Caller provided storage, always kept null terminated
+	uint16	Size;	// Size of Data in bytes including the terminator
+	uint16	Length;	// Number of characters stored
+}Fmt_Buffer_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref FMT_FLAGS_define
+#define FMT_FLAG_NONE			(0x00U)
+#define FMT_FLAG_ZERO_PAD		(0x01U) // Pad numbers with '0' instead of ' '
+#define FMT_FLAG_LEFT			(0x02U) // Left align inside the field width
+#define FMT_FLAG_PLUS			(0x04U) // Always print the sign of signed numbers
+#define FMT_FLAG_UPPER			(0x08U) // Upper case hexadecimal digits
+
+/* Lets GCC check the format string of Fmt_Print against its arguments at compile time */
+#if defined(__GNUC__)
+#define FMT_PRINTF_CHECK(_FMT_, _ARGS_)	__attribute__((format(printf, _FMT_, _ARGS_)))
+#else
+#define FMT_PRINTF_CHECK(_FMT_, _ARGS_)
+#endif
+
+/*
+ * =============================================
+ * APIs Supported by "Formatter"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Fmt_Sink_LCD
+  * @brief 			- Initializes a sink that writes at the current cursor of an LCD
+  * @param [out] 	- sink: Pointer to the sink to be initialized
+  * @param [in] 	- LCD_cfg: Pointer to the LCD, its shadow buffer is updated with every character
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_Sink_LCD(Fmt_Sink_t* sink, LCD_t* LCD_cfg);
+
+/**=============================================
+  * @Fn				- Fmt_Sink_USART
+  * @brief 			- Initializes a sink that transmits on a USART
+  * @param [out] 	- sink: Pointer to the sink to be initialized
+  * @param [in] 	- USARTx: Pointer to the USART peripheral instance
+  * @retval 		- None
+  * Note			- Characters are sent with polling on the TXE flag
+  */
+void Fmt_Sink_USART(Fmt_Sink_t* sink, USART_TypeDef* USARTx);
+
+/**=============================================
+  * @Fn				- Fmt_Sink_Buffer
+  * @brief 			- Initializes a sink that stores characters in a caller provided buffer
+  * @param [out] 	- sink: Pointer to the sink to be initialized
+  * @param [out] 	- buffer: Pointer to the buffer descriptor
+  * @param [in] 	- data: Storage for the characters
+  * @param [in] 	- size: Size of data in bytes including the null terminator
+  * @retval 		- None
+  * Note			- Output that does not fit is dropped
+  */
+void Fmt_Sink_Buffer(Fmt_Sink_t* sink, Fmt_Buffer_t* buffer, uint8* data, uint16 size);
+
+/**=============================================
+  * @Fn				- Fmt_String
+  * @brief 			- Writes a null terminated string padded to a field width
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- str: String to be written
+  * @param [in] 	- width: Minimum field width (0 = no padding)
+  * @param [in] 	- flags: Formatting flags @ref FMT_FLAGS_define
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_String(Fmt_Sink_t* sink, const uint8* str, uint8 width, uint8 flags);
+
+/**=============================================
+  * @Fn				- Fmt_Uint
+  * @brief 			- Writes an unsigned integer
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- value: Value to be written
+  * @param [in] 	- base: Numeric base (2...16)
+  * @param [in] 	- width: Minimum field width (0 = no padding)
+  * @param [in] 	- flags: Formatting flags @ref FMT_FLAGS_define
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_Uint(Fmt_Sink_t* sink, uint32 value, uint8 base, uint8 width, uint8 flags);
+
+/**=============================================
+  * @Fn				- Fmt_Int
+  * @brief 			- Writes a signed decimal integer
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- value: Value to be written
+  * @param [in] 	- width: Minimum field width (0 = no padding)
+  * @param [in] 	- flags: Formatting flags @ref FMT_FLAGS_define
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_Int(Fmt_Sink_t* sink, sint32 value, uint8 width, uint8 flags);
+
+/**=============================================
+  * @Fn				- Fmt_Fixed
+  * @brief 			- Writes a fixed-point decimal number
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- value: Value scaled by 10^frac_digits (1234 with 2 digits prints 12.34)
+  * @param [in] 	- frac_digits: Number of digits after the decimal point (0...9)
+  * @param [in] 	- width: Minimum field width (0 = no padding)
+  * @param [in] 	- flags: Formatting flags @ref FMT_FLAGS_define
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_Fixed(Fmt_Sink_t* sink, sint32 value, uint8 frac_digits, uint8 width, uint8 flags);
+
+/**=============================================
+  * @Fn				- Fmt_Print
+  * @brief 			- Writes a formatted string, printf compatible subset
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- format: Format string supporting %d %i %u %x %X %c %s %% with the
+  * 				  '-', '+' and '0' flags, a field width and the 'l'/'h' length modifiers
+  * @retval 		- None
+  * Note			- No heap and no libc printf is used, the format string is checked by the compiler
+  */
+void Fmt_Print(Fmt_Sink_t* sink, const char* format, ...) FMT_PRINTF_CHECK(2, 3);
+
+/**=============================================
+  * @Fn				- Fmt_VPrint
+  * @brief 			- Same as Fmt_Print taking a va_list
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- format: Format string, see Fmt_Print
+  * @param [in] 	- args: Arguments of the format string
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_VPrint(Fmt_Sink_t* sink, const char* format, va_list args) FMT_PRINTF_CHECK(2, 0);
+
+#endif /* INC_FMT_H_ */
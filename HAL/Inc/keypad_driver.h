@@ -13,10 +13,32 @@
 // Section: Includes
 //----------------------------------------------
 #include "gpio_driver.h"
+#include "EXTI_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	KEYPAD_EVENT_PRESS,			// Key became pressed after debouncing
+	KEYPAD_EVENT_RELEASE,		// Key became released after debouncing
+	KEYPAD_EVENT_LONG_PRESS,	// Key held for KEYPAD_LONG_PRESS_MS
+	KEYPAD_EVENT_REPEAT			// Key still held, sent every KEYPAD_REPEAT_MS after the long press
+}Keypad_Event_Type_t;
+
+typedef struct{
+	uint8				Key;	// Value of the key from the keypad layout
+	Keypad_Event_Type_t	Type;
+}Keypad_Event_t;
 
 //----------------------------------------------
 // Section: User Configurations
 //----------------------------------------------
+#define KEYPAD_SCAN_PERIOD_MS	5		// keypad_Scan_Tick must be called with this period
+#define KEYPAD_DEBOUNCE_SAMPLES	4		// Consecutive agreeing samples needed to change a key state
+#define KEYPAD_LONG_PRESS_MS	1000
+#define KEYPAD_REPEAT_MS		200
+#define KEYPAD_FIFO_SIZE		16		// Must be a power of 2
+#define KEYPAD_SETTLE_READS		1		// Port reads thrown away after a row write, the columns need 2 APB2 clocks to reach IDR
 
 
 //----------------------------------------------
@@ -29,10 +51,20 @@
 #define ROW1		GPIO_PIN_1
 #define ROW2		GPIO_PIN_3
 #define ROW3		GPIO_PIN_4
+#define ROWS_MASK	(ROW0 | ROW1 | ROW2 | ROW3)
 #define KEYPAD_COLS	3
 #define COL0		GPIO_PIN_5
 #define COL1		GPIO_PIN_6
 #define COL2		GPIO_PIN_7
+#define COLS_MASK	(COL0 | COL1 | COL2)
+#define COLS_SHIFT	5	// Pin number of COL0, columns must be consecutive pins
+#define COL0_LINE	5	// EXTI line of each column, equal to its pin number
+#define COL1_LINE	6
+#define COL2_LINE	7
+
+#define KEYPAD_KEYS		(KEYPAD_ROWS * KEYPAD_COLS)
+
+#define KEYPAD_NO_KEY	'F'
 
 /*
  * =============================================
@@ -47,16 +79,39 @@
   * @param [out] 	- None
   * @retval 		- None
   * Note			- User must define GPIO pins for rows and columns in @ref Keypad_PINS_define
+  * 				  All rows are kept driven high while idle, any key press raises its column
+  * 				  and triggers the EXTI interrupt that starts the periodic scanning
   */
 void keypad_init();
 
+/**=============================================
+  * @Fn				- keypad_Scan_Tick
+  * @brief 			- Samples the whole matrix, debounces every key and queues the resulting events
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Must be called every KEYPAD_SCAN_PERIOD_MS from an interrupt (timer or SysTick)
+  * 				  Returns immediately while the keypad is idle, scanning stops once all keys are released
+  * 				  Any number of keys can be held, without diodes three keys on a rectangle also show the fourth
+  */
+void keypad_Scan_Tick(void);
+
+/**=============================================
+  * @Fn				- keypad_Get_Event
+  * @brief 			- Takes the oldest event out of the keypad event queue
+  * @param [out] 	- event: Pointer to where the event is stored
+  * @retval 		- 1 if an event was returned, 0 if the queue is empty
+  * Note			- Events are dropped while the queue is full
+  */
+uint8 keypad_Get_Event(Keypad_Event_t* event);
+
 /**=============================================
   * @Fn				- keypad_Get_Pressed_Key
-  * @brief 			- Checks for any pressed key and returns the value of it
+  * @brief 			- Returns the next key press from the event queue
   * @param [in] 	- None
   * @param [out] 	- None
-  * @retval 		- Value of the pressed key, or F if no key is pressed
-  * Note			- None
+  * @retval 		- Value of the pressed key, or KEYPAD_NO_KEY if no key was pressed
+  * Note			- Other queued event types are discarded, use keypad_Get_Event to receive them
   */
 uint8 keypad_Get_Pressed_Key();
 
@@ -13,7 +13,17 @@
 // Section: Includes
 //----------------------------------------------
 #include "gpio_driver.h"
-#include "systick_driver.h"
+#include "Timer.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+
+// @ref LCD_GEOMETRY_define
+#define LCD_MAX_ROWS								4
+#define LCD_MAX_COLUMNS								16
+#define LCD_CGRAM_SLOTS								8
+#define LCD_GLYPH_ROWS								8
 
 //----------------------------------------------
 // Section: User type definitions
@@ -28,9 +38,28 @@ typedef enum{
 	LCD_4ROWS
 }LCD_ROWS_t;
 
+typedef enum{
+	LCD_HD44780,
+	LCD_KS0066,
+	LCD_ST7066U,
+	LCD_CONTROLLER_MAX
+}LCD_Controller_t;
+
+/* Execution times in microseconds taken from the controller datasheets */
+typedef struct{
+	uint16	Power_On_us;	 // Wait after VDD rises before the first instruction
+	uint16	Reset_Wait1_us;	 // Wait after the first function set of the initialization by instruction
+	uint16	Reset_Wait2_us;	 // Wait after the second function set of the initialization by instruction
+	uint16	Clear_Home_us;	 // Execution time of clear display and return home
+	uint16	Command_us;		 // Execution time of all other instructions
+	uint16	Data_us;		 // Execution time of a data write including the address counter update
+	uint8	Enable_Pulse_us; // Minimum enable high and low widths
+}LCD_Timing_t;
+
 typedef struct{
 	LCD_MODE_t		Mode;
 	LCD_ROWS_t		Rows;
+	LCD_Controller_t Controller;  // Selects the timing profile, HD44780 by default
 	uint8			Display_Mode; // @ref LCD_COMMANDS_define
 	uint8			Entry_Mode;   // @ref LCD_COMMANDS_define
 	GPIO_TypeDef*	GPIO_PORT;
@@ -44,6 +73,9 @@ typedef struct{
 	uint16 			D5_PIN; // @ref GPIO_PINS_define
 	uint16 			D6_PIN; // @ref GPIO_PINS_define
 	uint16 			D7_PIN; // @ref GPIO_PINS_define
+	uint8			Cursor; // Current address counter, maintained by the driver @ref LCD_CURSOR_define
+	uint8			Shadow[LCD_MAX_ROWS][LCD_MAX_COLUMNS]; // Mirror of the characters currently on screen, maintained by the driver
+	uint16			Nibble_Pins[16]; // D4-D7 pins set for each nibble value, built by LCD_Init, [15] is the whole group
 }LCD_t;
 
 //----------------------------------------------
@@ -69,6 +101,12 @@ typedef struct{
 #define LCD_DISPLAY_OFF_CURSOR_OFF                 	(0x08)
 #define LCD_8BIT_MODE_2_LINE           				(0x38)
 #define LCD_4BIT_MODE_2_LINE           				(0x28)
+#define LCD_SET_CGRAM_ADDRESS          				(0x40)
+#define LCD_SET_DDRAM_ADDRESS          				(0x80)
+
+// @ref LCD_CURSOR_define
+
+#define LCD_CURSOR_CGRAM							(0xFF) // Address counter points to CGRAM
 
 // @ref LCD_ROWS_POS_define
 
@@ -167,5 +205,28 @@ void LCD_Send_Enable_Signal(LCD_t* LCD_cfg);
   */
 void LCD_Set_Cursor(LCD_t* LCD_cfg, uint8 row, uint8 column);
 
+/**=============================================
+  * @Fn				- LCD_Update_Char
+  * @brief 			- Displays a char at a specific location only if it differs from what is on screen
+  * @param [in] 	- LCD_cfg: Pointer to the structure containing LCD configuration
+  * @param [in] 	- Char: ASCII character to be displayed on screen
+  * @param [in] 	- row: Selects the row number of the displayed character @ref LCD_ROWS_POS_define
+  * @param [in] 	- column: Selects the column number of the displayed character (1...16)
+  * @retval 		- None
+  * Note			- The cursor command is skipped when the address counter already points to the cell
+  */
+void LCD_Update_Char(LCD_t* LCD_cfg, uint8 Char, uint8 row, uint8 column);
+
+/**=============================================
+  * @Fn				- LCD_Write_CGRAM
+  * @brief 			- Uploads a 5x8 custom character bitmap into one of the CGRAM slots
+  * @param [in] 	- LCD_cfg: Pointer to the structure containing LCD configuration
+  * @param [in] 	- slot: CGRAM slot to be written (0...7)
+  * @param [in] 	- bitmap: 8 rows of the glyph, only the lower 5 bits of each row are used
+  * @retval 		- None
+  * Note			- The cursor is restored to its previous DDRAM address after the upload
+  */
+void LCD_Write_CGRAM(LCD_t* LCD_cfg, uint8 slot, const uint8* bitmap);
+
 
 #endif /* INCLCD_DRIVER_H_ */
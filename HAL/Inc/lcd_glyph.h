@@ -0,0 +1,68 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : lcd_glyph.h 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_LCD_GLYPH_H_
+#define INC_LCD_GLYPH_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "lcd_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint8	Bitmap[LCD_GLYPH_ROWS]; // Glyph currently stored in the CGRAM slot
+	uint8	Loaded;					// 1 if the slot holds a valid glyph
+	uint32	Last_Used;				// Value of the cache clock when the glyph was last requested
+}LCD_Glyph_Slot_t;
+
+typedef struct{
+	LCD_t*				LCD;						// LCD owning the CGRAM
+	LCD_Glyph_Slot_t	Slots[LCD_CGRAM_SLOTS];
+	uint32				Clock;						// Incremented on every request, used for LRU ordering
+	uint32				CGRAM_Uploads;				// Number of glyphs uploaded to CGRAM since init
+}LCD_Glyph_Cache_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref LCD_GLYPH_CODE_define
+#define LCD_GLYPH_CODE_BASE		(0x08) // Codes 0x08-0x0F alias CGRAM slots 0-7 and never collide with '\0'
+#define LCD_GLYPH_NONE			(0xFF) // All slots are in use by characters on screen
+
+/*
+ * =============================================
+ * APIs Supported by "LCD Glyph Cache"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- LCD_Glyph_Cache_Init
+  * @brief 			- Initializes an empty glyph cache for the given LCD
+  * @param [in] 	- cache: Pointer to the glyph cache
+  * @param [in] 	- LCD_cfg: Pointer to the LCD that owns the CGRAM
+  * @retval 		- None
+  * Note			- Must be called after LCD_Init
+  */
+void LCD_Glyph_Cache_Init(LCD_Glyph_Cache_t* cache, LCD_t* LCD_cfg);
+
+/**=============================================
+  * @Fn				- LCD_Glyph_Get
+  * @brief 			- Returns the character code that displays the given bitmap
+  * @param [in] 	- cache: Pointer to the glyph cache
+  * @param [in] 	- bitmap: 8 rows of the 5x8 glyph
+  * @retval 		- Character code @ref LCD_GLYPH_CODE_define, or LCD_GLYPH_NONE if no slot can be freed
+  * Note			- The bitmap is uploaded only on a miss, replacing the least recently used
+  * 				  glyph that is not currently shown on screen
+  */
+uint8 LCD_Glyph_Get(LCD_Glyph_Cache_t* cache, const uint8* bitmap);
+
+#endif /* INC_LCD_GLYPH_H_ */
@@ -0,0 +1,71 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : lcd_input.h 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_LCD_INPUT_H_
+#define INC_LCD_INPUT_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "lcd_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	LCD_INPUT_EDITING,	// Waiting for more keys
+	LCD_INPUT_DONE		// Enter key accepted, Buffer holds the entered text
+}LCD_Input_Status_t;
+
+typedef struct{
+	LCD_t*				LCD;
+	uint8				Row;		// @ref LCD_ROWS_POS_define
+	uint8				Column;		// Column of the first character (1...16)
+	uint8				Max_Length;
+	uint8				Buffer[LCD_MAX_COLUMNS];
+	uint8				Length;
+	LCD_Input_Status_t	Status;
+}LCD_Input_t;
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+#define LCD_INPUT_KEY_ENTER		'#'
+#define LCD_INPUT_KEY_BACKSPACE	'*'
+#define LCD_INPUT_CURSOR_CHAR	'_'
+
+/*
+ * =============================================
+ * APIs Supported by "LCD Input Field"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- LCD_Input_Start
+  * @brief 			- Clears an input field on the LCD and starts editing it
+  * @param [out] 	- input: Pointer to the input field state
+  * @param [in] 	- LCD_cfg: Pointer to the structure containing LCD configuration
+  * @param [in] 	- row: Row of the field @ref LCD_ROWS_POS_define
+  * @param [in] 	- column: Column of the first character of the field (1...16)
+  * @param [in] 	- max_length: Maximum number of characters, limited to the end of the row
+  * @retval 		- None
+  * Note			- None
+  */
+void LCD_Input_Start(LCD_Input_t* input, LCD_t* LCD_cfg, uint8 row, uint8 column, uint8 max_length);
+
+/**=============================================
+  * @Fn				- LCD_Input_Process_Key
+  * @brief 			- Applies one key to the input field and echoes the change on the LCD
+  * @param [in] 	- input: Pointer to the input field state
+  * @param [in] 	- key: Pressed key, LCD_INPUT_KEY_ENTER and LCD_INPUT_KEY_BACKSPACE edit the field
+  * @retval 		- Status of the field @ref LCD_Input_Status_t
+  * Note			- Enter is ignored while the field is empty, keys are ignored once the field is done
+  */
+LCD_Input_Status_t LCD_Input_Process_Key(LCD_Input_t* input, uint8 key);
+
+#endif /* INC_LCD_INPUT_H_ */
@@ -0,0 +1,84 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : lcd_text.h 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_LCD_TEXT_H_
+#define INC_LCD_TEXT_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "lcd_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	LCD_TEXT_PAGE,		// Word wrapped over the rows, flips to the next page every step
+	LCD_TEXT_MARQUEE	// Single row scrolling left by one column every step
+}LCD_Text_Mode_t;
+
+typedef struct{
+	LCD_t*			LCD;
+	const uint8*	Text;
+	uint16			Length;
+	LCD_Text_Mode_t	Mode;
+	uint8			First_Row;	// Index of the first row used (0...3)
+	uint8			Rows;		// Number of rows used
+	uint16			Position;	// Current page or scroll offset
+	uint16			Step_ms;	// Time between two frames
+	uint16			Elapsed_ms;
+	uint8			Active;
+}LCD_Text_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+#define LCD_TEXT_MARQUEE_GAP	4 // Blank columns between the end of the text and its next repetition
+
+/*
+ * =============================================
+ * APIs Supported by "LCD Text Layout"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- LCD_Text_Start
+  * @brief 			- Lays out a string over a region of the LCD and draws the first frame
+  * @param [out] 	- text: Pointer to the text layout state
+  * @param [in] 	- LCD_cfg: Pointer to the structure containing LCD configuration
+  * @param [in] 	- string: Null terminated string, must stay valid while the text is active
+  * @param [in] 	- mode: Layout mode @ref LCD_Text_Mode_t
+  * @param [in] 	- row: First row of the region @ref LCD_ROWS_POS_define
+  * @param [in] 	- rows: Number of rows of the region (forced to 1 in marquee mode)
+  * @param [in] 	- step_ms: Time between two pages or scroll steps
+  * @retval 		- None
+  * Note			- Text that fits in the region is drawn once and never redrawn
+  */
+void LCD_Text_Start(LCD_Text_t* text, LCD_t* LCD_cfg, const uint8* string, LCD_Text_Mode_t mode, uint8 row, uint8 rows, uint16 step_ms);
+
+/**=============================================
+  * @Fn				- LCD_Text_Stop
+  * @brief 			- Stops updating the text, the last frame stays on screen
+  * @param [in] 	- text: Pointer to the text layout state
+  * @retval 		- None
+  * Note			- None
+  */
+void LCD_Text_Stop(LCD_Text_t* text);
+
+/**=============================================
+  * @Fn				- LCD_Text_Update
+  * @brief 			- Advances the text by the elapsed time and draws the new frame if due
+  * @param [in] 	- text: Pointer to the text layout state
+  * @param [in] 	- elapsed_ms: Time since the previous call
+  * @retval 		- None
+  * Note			- Only the cells that differ from the previous frame are written to the LCD
+  */
+void LCD_Text_Update(LCD_Text_t* text, uint16 elapsed_ms);
+
+#endif /* INC_LCD_TEXT_H_ */
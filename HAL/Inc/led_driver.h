@@ -13,6 +13,7 @@
 // Section: Includes
 //----------------------------------------------
 #include "gpio_driver.h"
+#include "PWM_driver.h"
 
 //----------------------------------------------
 // Section: User type definitions
@@ -28,8 +29,18 @@ typedef struct{
 	GPIO_TypeDef *LED_Port;
 	GPIO_PinConfig_t LED_Pin;
 	LED_Mode_t LED_Mode;
+	TIM_TypeDef *LED_Timer;		/* NULL for a plain GPIO LED, otherwise the timer driving the pin (pin in AF push-pull mode) */
+	uint8 LED_Channel;			/* Timer channel of the pin @ref PWM_CHANNEL_define */
 }LED_cfg_t;
 
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+#define LED_PWM_TICK_FREQUENCY	1000000UL	/* 1us tick */
+#define LED_PWM_PERIOD			1000		/* 1KHZ, no visible flicker */
+#define LED_BRIGHTNESS_MAX		63			/* Brightness levels are 0...LED_BRIGHTNESS_MAX, gamma corrected */
+
 
 /*
  * =============================================
@@ -44,6 +55,7 @@ typedef struct{
   * @param [out] 	- 
   * @retval 		- 
   * Note			- LED is initially off
+  * 				  A PWM LED also starts its timer at LED_PWM_PERIOD, LEDs on the same timer share it
   */
 void LED_Init(const LED_cfg_t *led_cfg);
 
@@ -67,13 +79,24 @@ void LED_TurnOn(const LED_cfg_t *led_cfg);
   */
 void LED_TurnOff(const LED_cfg_t *led_cfg);
 
+/**=============================================
+  * @Fn				- LED_Set_Brightness
+  * @brief 			- This function shall set the perceived brightness of the LED
+  * @param [in] 	- led_cfg: Pointer to the struct holding the LED configuration
+  * @param [in] 	- level: Brightness from 0 (off) to LED_BRIGHTNESS_MAX (fully on)
+  * @param [out] 	-
+  * @retval 		-
+  * Note			- A GPIO LED is on for levels above half of LED_BRIGHTNESS_MAX
+  */
+void LED_Set_Brightness(const LED_cfg_t *led_cfg, uint8 level);
+
 /**=============================================
   * @Fn				- LED_Toggle
   * @brief 			- This function shall toggle the status of the LED
   * @param [in] 	- led_cfg: Pointer to the struct holding the LED configuration
   * @param [out] 	-
   * @retval 		-
-  * Note			-
+  * Note			- A dimmed PWM LED is considered on
   */
 void LED_Toggle(const LED_cfg_t *led_cfg);
 
@@ -0,0 +1,125 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : led_pattern.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_LED_PATTERN_H_
+#define INC_LED_PATTERN_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "led_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	const uint16*	Steps;		// Durations in ms, even entries are on times and odd entries off times
+	uint8			Count;		// Number of entries in Steps
+	uint8			Repeat;		// Number of runs of Steps, LED_PATTERN_FOREVER to loop
+	uint8			Priority;	// A pattern only replaces one of the same or lower priority
+	uint8			Fade;		// 1: even steps fade in and odd steps fade out instead of switching (PWM LEDs)
+}LED_Pattern_t;
+
+typedef struct{
+	const LED_cfg_t*					LED;
+	const LED_Pattern_t* volatile		Pattern;	// NULL when no pattern is running
+	const LED_Pattern_t*				Resume;		// Looping pattern preempted by the running one
+	uint8								Step;
+	uint8								Runs;
+	uint16								Elapsed_ms;
+	void (*Done_CallBack)(const LED_Pattern_t* pattern);	// Called when a finite pattern plays to its end
+}LED_Pattern_Player_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+#define LED_PATTERN_FOREVER			0
+
+/* BASEPRI level masking the SysTick that runs LED_Pattern_Update */
+#define LED_PATTERN_CRITICAL_LEVEL	NVIC_PRIO_0010
+
+/* @ref LED_PATTERN_PRIORITY_define */
+#define LED_PATTERN_PRIORITY_IDLE	0
+#define LED_PATTERN_PRIORITY_INFO	1
+#define LED_PATTERN_PRIORITY_ALARM	2
+
+//----------------------------------------------
+// Section: Predefined patterns
+//----------------------------------------------
+extern const LED_Pattern_t LED_PATTERN_BLINK3;		// Three 100ms flashes
+extern const LED_Pattern_t LED_PATTERN_HEARTBEAT;	// Double pulse every second, loops
+extern const LED_Pattern_t LED_PATTERN_FAST_ALARM;	// Ten 50ms flashes
+extern const LED_Pattern_t LED_PATTERN_BREATHE;		// Slow gamma corrected fade in and out, loops
+
+/*
+ * =============================================
+ * APIs Supported by "LED Pattern"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- LED_Pattern_Init
+  * @brief 			- Attaches a pattern player to an initialized LED
+  * @param [out] 	- player: Pointer to the pattern player
+  * @param [in] 	- led_cfg: Pointer to the LED configuration, must stay valid
+  * @retval 		- None
+  * Note			- No pattern is running after this call
+  */
+void LED_Pattern_Init(LED_Pattern_Player_t* player, const LED_cfg_t* led_cfg);
+
+/**=============================================
+  * @Fn				- LED_Pattern_Start
+  * @brief 			- Starts a pattern from its first step
+  * @param [in] 	- player: Pointer to the pattern player
+  * @param [in] 	- pattern: Pattern to play, must stay valid while it runs
+  * @retval 		- 1 if the pattern was started, 0 if a higher priority pattern is running
+  * Note			- A preempted looping pattern is restarted when the new pattern ends
+  */
+uint8 LED_Pattern_Start(LED_Pattern_Player_t* player, const LED_Pattern_t* pattern);
+
+/**=============================================
+  * @Fn				- LED_Pattern_Stop
+  * @brief 			- Stops the running pattern and any preempted one, the LED is turned off
+  * @param [in] 	- player: Pointer to the pattern player
+  * @retval 		- None
+  * Note			- None
+  */
+void LED_Pattern_Stop(LED_Pattern_Player_t* player);
+
+/**=============================================
+  * @Fn				- LED_Pattern_Update
+  * @brief 			- Advances the running pattern by the elapsed time
+  * @param [in] 	- player: Pointer to the pattern player
+  * @param [in] 	- elapsed_ms: Time since the previous call
+  * @retval 		- None
+  * Note			- Called periodically from the scheduler, the LED only changes at step boundaries
+  * 				  except for fading patterns which update the brightness on every call
+  */
+void LED_Pattern_Update(LED_Pattern_Player_t* player, uint16 elapsed_ms);
+
+/**=============================================
+  * @Fn				- LED_Pattern_Set_Done_CallBack
+  * @brief 			- Sets the function called when a finite pattern of the player plays to its end
+  * @param [in] 	- player: Pointer to the pattern player
+  * @param [in] 	- callback: Function receiving the finished pattern, NULL to remove it
+  * @retval 		- None
+  * Note			- Called from LED_Pattern_Update (tick interrupt), not for stopped or preempted patterns
+  */
+void LED_Pattern_Set_Done_CallBack(LED_Pattern_Player_t* player, void (*callback)(const LED_Pattern_t* pattern));
+
+/**=============================================
+  * @Fn				- LED_Pattern_Is_Active
+  * @brief 			- Checks if a pattern is running
+  * @param [in] 	- player: Pointer to the pattern player
+  * @retval 		- 1 if a pattern is running, 0 otherwise
+  * Note			- None
+  */
+uint8 LED_Pattern_Is_Active(const LED_Pattern_Player_t* player);
+
+#endif /* INC_LED_PATTERN_H_ */
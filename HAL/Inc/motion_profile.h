@@ -0,0 +1,91 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : motion_profile.h 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_MOTION_PROFILE_H_
+#define INC_MOTION_PROFILE_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Platform_Types.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef enum{
+	MOTION_TRAPEZOID,	// Constant acceleration, cruise at max velocity, constant deceleration
+	MOTION_SCURVE		// Quintic smootherstep, zero velocity and acceleration at both ends
+}Motion_Shape_t;
+
+typedef struct{
+	Motion_Shape_t	Shape;
+	uint32			Max_Velocity;	// Position units per second
+	uint32			Acceleration;	// Position units per second^2
+}Motion_Limits_t;
+
+typedef struct{
+	const Motion_Limits_t*	Limits;
+	uint16					Start;
+	uint16					Target;
+	uint16					Position;		// Current position on the trajectory
+	uint32					Distance;
+	uint32					Accel_ms;		// Trapezoid acceleration (and deceleration) time
+	uint32					Cruise_ms;		// Trapezoid constant velocity time
+	uint32					Peak_Velocity;	// Trapezoid reached velocity, units per second
+	uint32					Duration_ms;
+	uint32					Elapsed_ms;
+	volatile uint8			Active;			// Cleared first when replanning, the step may run in an interrupt
+}Motion_t;
+
+/*
+ * =============================================
+ * APIs Supported by "Motion Profile"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- Motion_Init
+  * @brief 			- Initializes a motion at rest at a given position
+  * @param [out] 	- motion: Pointer to the motion state
+  * @param [in] 	- limits: Pointer to the shape and limits, must stay valid while the motion is used
+  * @param [in] 	- position: Initial position
+  * @retval 		- None
+  * Note			- None
+  */
+void Motion_Init(Motion_t* motion, const Motion_Limits_t* limits, uint16 position);
+
+/**=============================================
+  * @Fn				- Motion_Start
+  * @brief 			- Plans a trajectory from the current position to a target
+  * @param [in] 	- motion: Pointer to the motion state
+  * @param [in] 	- target: Final position
+  * @retval 		- None
+  * Note			- A running motion is replanned from where it is, starting again from rest
+  */
+void Motion_Start(Motion_t* motion, uint16 target);
+
+/**=============================================
+  * @Fn				- Motion_Step
+  * @brief 			- Advances the trajectory and returns the new position
+  * @param [in] 	- motion: Pointer to the motion state
+  * @param [in] 	- elapsed_ms: Time since the previous step
+  * @retval 		- Position at the new time
+  * Note			- The motion becomes inactive once the target is reached
+  */
+uint16 Motion_Step(Motion_t* motion, uint16 elapsed_ms);
+
+/**=============================================
+  * @Fn				- Motion_Is_Active
+  * @brief 			- Checks if the trajectory is still running
+  * @param [in] 	- motion: Pointer to the motion state
+  * @retval 		- 1 while moving, 0 at rest
+  * Note			- None
+  */
+uint8 Motion_Is_Active(const Motion_t* motion);
+
+#endif /* INC_MOTION_PROFILE_H_ */
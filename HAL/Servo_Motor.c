@@ -8,71 +8,115 @@
 #include "Servo_Motor.h"
 
 
-//Direction of motion
-#define UP   1
-#define Down 2
+static const Servo_t* Servo_Table;
+static uint8 Servo_Count = 0;
 
+//Arm trajectories, positions are pulse widths in us
+static const Motion_Limits_t Servo_Limits = {SERVO_MOTION_SHAPE, SERVO_MAX_VELOCITY, SERVO_ACCELERATION};
+static Motion_t Servo_Motion[SERVO_MAX_COUNT];
+static volatile uint8 Servo_Angle[SERVO_MAX_COUNT];
+static void (*Servo_Done_CallBack)(uint8 Servo, uint8 Angle);
 
-//B8 SERVO1
-void Servo1_Entry_Gate_Init(void)
+//Pulse width of an angle using the calibration of the servo
+static uint16 Servo_Pulse(const Servo_t* Servo, uint8 Angle)
 {
-	/*SERVO MOTOR 1*/
-	GPIO_PinConfig_t PinCinfg;
-	PinCinfg.GPIO_PinNumber=GPIO_PIN_8;
-	PinCinfg.GPIO_MODE = GPIO_MODE_OUTPUT_PP;
-	PinCinfg.GPIO_OUTPUT_SPEED =GPIO_SPEED_10M;
-	MCAL_GPIO_Init(GPIOB, &PinCinfg);
+	uint32 offset = ((uint32)(Servo->Max_Pulse_us - Servo->Min_Pulse_us) * Angle) / SERVO_MAX_ANGLE;
+
+	return Servo->Inverted ? (uint16)(Servo->Max_Pulse_us - offset) : (uint16)(Servo->Min_Pulse_us + offset);
 }
 
-//Direction Up or Down
-void Servo1_Entry_Gate(uint8 Direction)
+//Timer update interrupt, every 20ms: moves each arm one step along its trajectory
+static void Servo_Update(void)
 {
-	if(Direction == SERVO_UP)
-	{
-		//servo1 Enter gate up +90
-		MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_8, 1);
-		dus(500);
-		MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_8, 0);
-	}
-	if(Direction==SERVO_DOWN)
-	{
-		//servo1 Enter gate down -90
-		MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_8, 1);
-		dus(1488);
-		MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_8, 0);
-	}
+	uint8 servo;
 
+	for(servo = 0; servo < Servo_Count; servo++)
+	{
+		if(Motion_Is_Active(&Servo_Motion[servo]))
+		{
+			MCAL_PWM_Set_Compare(Servo_Table[servo].Timer, Servo_Table[servo].Channel, Motion_Step(&Servo_Motion[servo], SERVO_PERIOD_MS));
 
+			//Arm reached its target
+			if(!Motion_Is_Active(&Servo_Motion[servo]) && Servo_Done_CallBack)
+			{
+				Servo_Done_CallBack(servo, Servo_Angle[servo]);
+			}
+		}
+	}
 }
 
-//B9 SERVO2
-void Servo2_Exit_Gate_Init(void)
+void Servo_Init(const Servo_t* Servos, uint8 Count)
 {
-	/*SERVO MOTOR 2*/
 	GPIO_PinConfig_t PinCinfg;
-	PinCinfg.GPIO_PinNumber=GPIO_PIN_9;
-	PinCinfg.GPIO_MODE = GPIO_MODE_OUTPUT_PP;
-	PinCinfg.GPIO_OUTPUT_SPEED =GPIO_SPEED_10M;
-	MCAL_GPIO_Init(GPIOB, &PinCinfg);
-}
+	PWM_cfg_t PWM_Cfg;
+	uint8 servo, other;
+	uint16 pulse;
 
-//Direction Up or Down
-void Servo2_Exit_Gate(uint8 Direction)
-{
-	if(Direction == SERVO_UP)
+	Servo_Table = Servos;
+	Servo_Count = (Count > SERVO_MAX_COUNT) ? SERVO_MAX_COUNT : Count;
+
+	PWM_Cfg.Tick_Frequency = SERVO_TICK_FREQUENCY;
+	PWM_Cfg.Period = SERVO_PERIOD_US;
+
+	for(servo = 0; servo < Servo_Count; servo++)
+	{
+		PinCinfg.GPIO_PinNumber = Servos[servo].Pin;
+		PinCinfg.GPIO_MODE = GPIO_MODE_OUTPUT_AF_PP;
+		PinCinfg.GPIO_OUTPUT_SPEED = GPIO_SPEED_10M;
+		MCAL_GPIO_Init(Servos[servo].Port, &PinCinfg);
+
+		//Each timer is started once, servos on the same timer share its time base
+		for(other = 0; (other < servo) && (Servos[other].Timer != Servos[servo].Timer); other++);
+		if(other == servo)
+		{
+			MCAL_PWM_Init(Servos[servo].Timer, &PWM_Cfg);
+		}
+
+		Servo_Angle[servo] = Servos[servo].Initial_Angle;
+		pulse = Servo_Pulse(&Servos[servo], Servos[servo].Initial_Angle);
+		Motion_Init(&Servo_Motion[servo], &Servo_Limits, pulse);
+		MCAL_PWM_Channel_Init(Servos[servo].Timer, Servos[servo].Channel, pulse);
+	}
+
+	//All timers have the same period, one update interrupt steps every servo
+	if(Servo_Count > 0)
 	{
-		//servo2 Exit gate up +90
-		MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_9, 1);
-		dus(500);
-		MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_9, 0);
+		MCAL_PWM_Enable_Update_IRQ(Servos[0].Timer, Servo_Update);
 	}
+}
+
+//The arm moves smoothly to the angle and the callback reports when it arrives
+void Servo_Set(uint8 Servo, uint8 Angle)
+{
+	uint8 Moving;
 
-	if(Direction == SERVO_DOWN)
+	if(Servo < Servo_Count)
 	{
-		//servo2 Exit gate down -90
-		MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_9, 1);
-		dus(1488);
-		MCAL_GPIO_WritePin(GPIOB, GPIO_PIN_9, 0);
+		if(Angle > SERVO_MAX_ANGLE)
+		{
+			Angle = SERVO_MAX_ANGLE;
+		}
+		//The TIM4 update must not step a half restarted motion
+		CRITICAL_ENTER(SERVO_CRITICAL_LEVEL);
+		Servo_Angle[Servo] = Angle;
+		Motion_Start(&Servo_Motion[Servo], Servo_Pulse(&Servo_Table[Servo], Angle));
+		Moving = Motion_Is_Active(&Servo_Motion[Servo]);
+		CRITICAL_EXIT();
+
+		//Already there, report it now as no update will
+		if(!Moving && Servo_Done_CallBack)
+		{
+			Servo_Done_CallBack(Servo, Angle);
+		}
 	}
+}
+
+uint8 Servo_Is_Moving(uint8 Servo)
+{
+	return (Servo < Servo_Count) ? Motion_Is_Active(&Servo_Motion[Servo]) : 0;
+}
 
+void Servo_Set_Done_CallBack(void (*CallBack)(uint8 Servo, uint8 Angle))
+{
+	Servo_Done_CallBack = CallBack;
 }
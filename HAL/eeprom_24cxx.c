@@ -0,0 +1,145 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : eeprom_24cxx.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "eeprom_24cxx.h"
+
+/* Sits on the I2C driver, built with it only, see I2C_DRIVER_ENABLE */
+#if I2C_DRIVER_ENABLE
+
+#define AT24_ADDRESS_BYTES		2
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+static uint8 AT24_Write_Pending;	// A page write cycle may still be running
+static uint8 AT24_Buffer[AT24_ADDRESS_BYTES + AT24_PAGE_SIZE];
+
+//----------------------------------------------
+// Section: Static Functions Definitions
+//----------------------------------------------
+
+/* The EEPROM ignores its address during a write cycle, poll it until it acknowledges */
+static uint8 AT24_Wait_Ready(void){
+	I2C_Transfer_t poll = {AT24_ADDRESS, NULL, 0, NULL, 0};
+	uint8 status = I2C_STATUS_DONE;
+	uint16 tries;
+
+	if(AT24_Write_Pending){
+		status = I2C_STATUS_NACK;
+		for(tries = 0; (I2C_STATUS_NACK == status) && (tries < AT24_ACK_POLL_TRIES); tries++){
+			status = MCAL_I2C_Transfer(AT24_I2C_INSTANT, &poll);
+		}
+		AT24_Write_Pending = (I2C_STATUS_DONE == status) ? 0 : 1;
+	}
+	else{ /* Do Nothing */ }
+
+	return (I2C_STATUS_DONE == status) ? AT24_OK : AT24_ERROR;
+}
+
+//----------------------------------------------
+// Section: API Definitions
+//----------------------------------------------
+
+/**=============================================
+  * @Fn				- AT24_Init
+  * @brief 			- Initializes the I2C bus of the EEPROM
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- AT24_OK if the EEPROM answers, AT24_ERROR otherwise @ref AT24_RETURN_define
+  * Note			- None
+  */
+uint8 AT24_Init(void){
+	I2C_cfg_t I2C_cfg;
+
+	I2C_cfg.ClockSpeed = AT24_I2C_SPEED;
+	MCAL_I2C_Init(AT24_I2C_INSTANT, &I2C_cfg);
+
+	/* A write cut by the reset may still be running */
+	AT24_Write_Pending = 1;
+
+	return AT24_Wait_Ready();
+}
+
+/**=============================================
+  * @Fn				- AT24_Read
+  * @brief 			- Reads consecutive bytes in one sequential read
+  * @param [in] 	- address: First byte address
+  * @param [out] 	- data: Buffer of length bytes
+  * @param [in] 	- length: Number of bytes
+  * @retval 		- AT24_OK or AT24_ERROR @ref AT24_RETURN_define
+  * Note			- Waits for the end of a previous write cycle first
+  */
+uint8 AT24_Read(uint16 address, uint8* data, uint16 length){
+	I2C_Transfer_t transfer;
+	uint8 return_value = AT24_ERROR;
+
+	if(((uint32)address + length <= AT24_SIZE) && (AT24_OK == AT24_Wait_Ready())){
+		AT24_Buffer[0] = (uint8)(address >> 8);
+		AT24_Buffer[1] = (uint8)address;
+		transfer.Address = AT24_ADDRESS;
+		transfer.TX = AT24_Buffer;
+		transfer.TX_Length = AT24_ADDRESS_BYTES;
+		transfer.RX = data;
+		transfer.RX_Length = length;
+		return_value = (I2C_STATUS_DONE == MCAL_I2C_Transfer(AT24_I2C_INSTANT, &transfer)) ? AT24_OK : AT24_ERROR;
+	}
+	else{ /* Do Nothing */ }
+
+	return return_value;
+}
+
+/**=============================================
+  * @Fn				- AT24_Write
+  * @brief 			- Writes consecutive bytes, one page write per page touched
+  * @param [in] 	- address: First byte address
+  * @param [in] 	- data: Pointer to the bytes
+  * @param [in] 	- length: Number of bytes
+  * @retval 		- AT24_OK or AT24_ERROR @ref AT24_RETURN_define
+  * Note			- Returns once the last page is sent, its write cycle is awaited by the next access (ACK polling)
+  * 				  Main context only
+  */
+uint8 AT24_Write(uint16 address, const uint8* data, uint16 length){
+	I2C_Transfer_t transfer;
+	uint16 chunk, index;
+	uint8 return_value = ((uint32)address + length <= AT24_SIZE) ? AT24_OK : AT24_ERROR;
+
+	transfer.Address = AT24_ADDRESS;
+	transfer.TX = AT24_Buffer;
+	transfer.RX = NULL;
+	transfer.RX_Length = 0;
+	while((AT24_OK == return_value) && (length > 0)){
+		/* Up to the end of the page, the EEPROM would wrap to its start */
+		chunk = AT24_PAGE_SIZE - (address % AT24_PAGE_SIZE);
+		chunk = (chunk < length) ? chunk : length;
+
+		return_value = AT24_Wait_Ready();
+		if(AT24_OK == return_value){
+			AT24_Buffer[0] = (uint8)(address >> 8);
+			AT24_Buffer[1] = (uint8)address;
+			for(index = 0; index < chunk; index++){
+				AT24_Buffer[AT24_ADDRESS_BYTES + index] = data[index];
+			}
+			transfer.TX_Length = AT24_ADDRESS_BYTES + chunk;
+			return_value = (I2C_STATUS_DONE == MCAL_I2C_Transfer(AT24_I2C_INSTANT, &transfer)) ? AT24_OK : AT24_ERROR;
+			AT24_Write_Pending = 1;
+		}
+		else{ /* Do Nothing */ }
+
+		address += chunk;
+		data += chunk;
+		length -= chunk;
+	}
+
+	return return_value;
+}
+
+#endif /* I2C_DRIVER_ENABLE */
@@ -0,0 +1,367 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : eeprom_emul.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "eeprom_emul.h"
+
+/* Page layout: status, sequence number, then the records appended one after the other
+ * Record layout: key | (length << 8), data bytes padded to half-words, CRC16 of both */
+#define EEPROM_PAGE_ERASED		0xFFFFU
+#define EEPROM_PAGE_RECEIVING	0xEEEEU		// Records are being copied in
+#define EEPROM_PAGE_ACTIVE		0x0000U		// Can be programmed over any status
+
+#define EEPROM_SEQUENCE_OFFSET	2
+#define EEPROM_RECORDS_OFFSET	4
+#define EEPROM_RECORD_SIZE(_LENGTH_)	(4U + (((_LENGTH_) + 1U) & ~1U))
+
+/* Every key at its largest size must fit in a page with the next record */
+#if ((EEPROM_MAX_KEYS + 1) * EEPROM_RECORD_SIZE(EEPROM_MAX_LENGTH) + EEPROM_RECORDS_OFFSET) > FLASH_PAGE_SIZE
+#error "EEPROM_MAX_KEYS values of EEPROM_MAX_LENGTH bytes do not fit in a flash page"
+#endif
+
+/* Both pages must be whole flash pages of the device */
+#if ((EEPROM_PAGE0_ADDRESS - FLASH_MEMORY_BASE) % FLASH_PAGE_SIZE) || (EEPROM_PAGE1_ADDRESS != (EEPROM_PAGE0_ADDRESS + FLASH_PAGE_SIZE))
+#error "EEPROM pages are not two consecutive flash pages"
+#endif
+#if (EEPROM_PAGE0_ADDRESS < FLASH_MEMORY_BASE) || ((EEPROM_PAGE1_ADDRESS + FLASH_PAGE_SIZE) > (FLASH_MEMORY_BASE + FLASH_MEMORY_SIZE))
+#error "EEPROM pages are outside the flash"
+#endif
+
+/* End of the program image in flash: code and constants, then the initial values of .data
+ * (symbols of the linker script) */
+#ifndef EEPROM_IMAGE_END
+extern uint32 _sidata, _sdata, _edata;
+#define EEPROM_IMAGE_END		((uint32)&_sidata + ((uint32)&_edata - (uint32)&_sdata))
+#endif
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+static const uint32 EEPROM_Pages[2] = {EEPROM_PAGE0_ADDRESS, EEPROM_PAGE1_ADDRESS};
+
+static uint8 EEPROM_Active;						// Index of the active page in EEPROM_Pages
+static uint16 EEPROM_Sequence;					// Incremented on every page transfer
+static uint16 EEPROM_Free;						// Offset of the first free half-word in the active page
+static uint16 EEPROM_Index[EEPROM_MAX_KEYS];	// Offset of the last record of each key, 0 if none
+static uint8 EEPROM_Ready;
+
+//----------------------------------------------
+// Section: Static Functions Definitions
+//----------------------------------------------
+
+/* CRC16-CCITT, 0xFFFF is never returned so a record cut before its CRC never matches */
+static uint16 EEPROM_CRC(uint16 header, const uint8* data, uint8 length){
+	uint16 crc = 0xFFFF;
+	uint8 index, bit, byte;
+
+	for(index = 0; index < (length + 2); index++){
+		byte = (index < 2) ? (uint8)(header >> (8 * index)) : data[index - 2];
+		crc ^= (uint16)byte << 8;
+		for(bit = 0; bit < 8; bit++){
+			crc = (crc & 0x8000) ? (uint16)((crc << 1) ^ 0x1021) : (uint16)(crc << 1);
+		}
+	}
+
+	return (0xFFFF == crc) ? 0x0000 : crc;
+}
+
+static uint16 EEPROM_Read_HalfWord(uint8 page, uint16 offset){
+	return MCAL_FLASH_Read_HalfWord(EEPROM_Pages[page] + offset);
+}
+
+/* Reads the data of the record at offset in the active page */
+static void EEPROM_Read_Record(uint16 offset, uint8* data, uint8 length){
+	uint8 index;
+	uint16 half_word = 0;
+
+	for(index = 0; index < length; index++){
+		if(0 == (index & 1)){
+			half_word = EEPROM_Read_HalfWord(EEPROM_Active, offset + 2 + index);
+		}
+		else{ /* Do Nothing */ }
+		data[index] = (uint8)(half_word >> (8 * (index & 1)));
+	}
+}
+
+static uint8 EEPROM_Page_Is_Blank(uint8 page){
+	uint16 offset;
+
+	for(offset = 0; (offset < FLASH_PAGE_SIZE) && (FLASH_ERASED_HALFWORD == EEPROM_Read_HalfWord(page, offset)); offset += 2);
+
+	return (offset >= FLASH_PAGE_SIZE) ? 1 : 0;
+}
+
+/* Erases a page unless it already is, saves an erase cycle on most page transfers */
+static uint8 EEPROM_Erase(uint8 page){
+	return EEPROM_Page_Is_Blank(page) ? FLASH_OK : MCAL_FLASH_Erase_Page(EEPROM_Pages[page]);
+}
+
+/* Rebuilds the index and the free offset from the records of the active page */
+static void EEPROM_Scan(void){
+	uint16 offset = EEPROM_RECORDS_OFFSET;
+	uint16 header, size;
+	uint8 key, length;
+	uint8 data[EEPROM_MAX_LENGTH];
+
+	for(key = 0; key < EEPROM_MAX_KEYS; key++){
+		EEPROM_Index[key] = 0;
+	}
+
+	EEPROM_Free = FLASH_PAGE_SIZE;
+	while(offset < FLASH_PAGE_SIZE){
+		header = EEPROM_Read_HalfWord(EEPROM_Active, offset);
+		key = (uint8)header;
+		length = (uint8)(header >> 8);
+		size = EEPROM_RECORD_SIZE(length);
+		if(FLASH_ERASED_HALFWORD == header){
+			EEPROM_Free = offset;
+			break;
+		}
+		else if((key >= EEPROM_MAX_KEYS) || (length > EEPROM_MAX_LENGTH) || ((offset + size) > FLASH_PAGE_SIZE)){
+			/* Unknown size, nothing can be appended after it, the next write transfers the page */
+			break;
+		}
+		else{
+			/* A record cut by a reset fails its CRC and is skipped, the older value stays */
+			EEPROM_Read_Record(offset, data, length);
+			if(EEPROM_CRC(header, data, length) == EEPROM_Read_HalfWord(EEPROM_Active, offset + size - 2)){
+				EEPROM_Index[key] = offset;
+			}
+			else{ /* Do Nothing */ }
+			offset += size;
+		}
+	}
+}
+
+/* Programs a record at offset in a page, the header first and the CRC last */
+static uint8 EEPROM_Program_Record(uint8 page, uint16 offset, uint8 key, const uint8* data, uint8 length){
+	uint16 header = (uint16)key | ((uint16)length << 8);
+	uint8 return_value;
+	uint8 index;
+
+	return_value = MCAL_FLASH_Program_HalfWord(EEPROM_Pages[page] + offset, header);
+	for(index = 0; (FLASH_OK == return_value) && (index < length); index += 2){
+		return_value = MCAL_FLASH_Program_HalfWord(EEPROM_Pages[page] + offset + 2 + index,
+				(uint16)data[index] | (((index + 1) < length) ? (uint16)((uint16)data[index + 1] << 8) : (uint16)0xFF00U));
+	}
+	if(FLASH_OK == return_value){
+		return_value = MCAL_FLASH_Program_HalfWord(EEPROM_Pages[page] + offset + EEPROM_RECORD_SIZE(length) - 2,
+				EEPROM_CRC(header, data, length));
+	}
+	else{ /* Do Nothing */ }
+
+	return return_value;
+}
+
+/* Copies the last value of every key to the other page and makes it the active one
+ * The key being written is copied too, its old value must survive a reset before the new record */
+static uint8 EEPROM_Transfer(void){
+	uint8 target = EEPROM_Active ^ 1;
+	uint16 index[EEPROM_MAX_KEYS];
+	uint16 offset = EEPROM_RECORDS_OFFSET;
+	uint8 data[EEPROM_MAX_LENGTH];
+	uint8 key, length;
+	uint8 return_value;
+
+	/* The sequence number tells the newer page if a reset hits between the status update and the erase */
+	return_value = EEPROM_Erase(target);
+	if(FLASH_OK == return_value){
+		return_value = MCAL_FLASH_Program_HalfWord(EEPROM_Pages[target] + EEPROM_SEQUENCE_OFFSET, EEPROM_Sequence + 1);
+	}
+	else{ /* Do Nothing */ }
+	if(FLASH_OK == return_value){
+		return_value = MCAL_FLASH_Program_HalfWord(EEPROM_Pages[target], EEPROM_PAGE_RECEIVING);
+	}
+	else{ /* Do Nothing */ }
+
+	/* Deleted keys are dropped */
+	for(key = 0; key < EEPROM_MAX_KEYS; key++){
+		index[key] = 0;
+		length = (0 != EEPROM_Index[key]) ? (uint8)(EEPROM_Read_HalfWord(EEPROM_Active, EEPROM_Index[key]) >> 8) : 0;
+		if((FLASH_OK == return_value) && (0 != length)){
+			EEPROM_Read_Record(EEPROM_Index[key], data, length);
+			return_value = EEPROM_Program_Record(target, offset, key, data, length);
+			index[key] = offset;
+			offset += EEPROM_RECORD_SIZE(length);
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	if(FLASH_OK == return_value){
+		return_value = MCAL_FLASH_Program_HalfWord(EEPROM_Pages[target], EEPROM_PAGE_ACTIVE);
+	}
+	else{ /* Do Nothing */ }
+
+	/* The new page holds everything from here, the old one is only erased after */
+	if(FLASH_OK == return_value){
+		for(key = 0; key < EEPROM_MAX_KEYS; key++){
+			EEPROM_Index[key] = index[key];
+		}
+		EEPROM_Free = offset;
+		EEPROM_Sequence++;
+		EEPROM_Active = target;
+		return_value = MCAL_FLASH_Erase_Page(EEPROM_Pages[target ^ 1]);
+	}
+	else{ /* Do Nothing */ }
+
+	return return_value;
+}
+
+/* Erases both pages and starts again from an empty page 0 */
+static uint8 EEPROM_Format(void){
+	uint8 return_value = EEPROM_Erase(0);
+
+	if(FLASH_OK == return_value){
+		return_value = EEPROM_Erase(1);
+	}
+	else{ /* Do Nothing */ }
+	if(FLASH_OK == return_value){
+		return_value = MCAL_FLASH_Program_HalfWord(EEPROM_Pages[0] + EEPROM_SEQUENCE_OFFSET, 0);
+	}
+	else{ /* Do Nothing */ }
+	if(FLASH_OK == return_value){
+		return_value = MCAL_FLASH_Program_HalfWord(EEPROM_Pages[0], EEPROM_PAGE_ACTIVE);
+	}
+	else{ /* Do Nothing */ }
+	EEPROM_Active = 0;
+
+	return return_value;
+}
+
+//----------------------------------------------
+// Section: API Definitions
+//----------------------------------------------
+
+/**=============================================
+  * @Fn				- EEPROM_Init
+  * @brief 			- Finds the active page, finishes an interrupted page transfer and indexes the saved values
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- EEPROM_OK or EEPROM_ERROR @ref EEPROM_RETURN_define
+  * Note			- Formats both pages if none is valid (first boot), one page scan otherwise
+  */
+uint8 EEPROM_Init(void){
+	uint16 status[2], sequence[2];
+	uint8 page;
+	uint8 return_value = FLASH_OK;
+
+	if(EEPROM_IMAGE_END > EEPROM_PAGE0_ADDRESS){
+		/* A program grown into the pages would be erased by the format below */
+		EEPROM_Ready = 0;
+	}
+	else{
+		for(page = 0; page < 2; page++){
+			status[page] = EEPROM_Read_HalfWord(page, 0);
+			sequence[page] = EEPROM_Read_HalfWord(page, EEPROM_SEQUENCE_OFFSET);
+		}
+
+		MCAL_FLASH_Unlock();
+		if((EEPROM_PAGE_ACTIVE == status[0]) && (EEPROM_PAGE_ACTIVE == status[1])){
+			/* Reset between the end of a transfer and the erase of the old page, the newer one wins */
+			EEPROM_Active = ((sint16)(sequence[1] - sequence[0]) > 0) ? 1 : 0;
+			return_value = MCAL_FLASH_Erase_Page(EEPROM_Pages[EEPROM_Active ^ 1]);
+		}
+		else if((EEPROM_PAGE_ACTIVE == status[0]) || (EEPROM_PAGE_ACTIVE == status[1])){
+			/* A half received page is dropped, the active one still has all the values */
+			EEPROM_Active = (EEPROM_PAGE_ACTIVE == status[1]) ? 1 : 0;
+			if(EEPROM_PAGE_ERASED != status[EEPROM_Active ^ 1]){
+				return_value = MCAL_FLASH_Erase_Page(EEPROM_Pages[EEPROM_Active ^ 1]);
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{
+			/* First boot or both pages corrupted */
+			return_value = EEPROM_Format();
+		}
+		MCAL_FLASH_Lock();
+
+		EEPROM_Sequence = EEPROM_Read_HalfWord(EEPROM_Active, EEPROM_SEQUENCE_OFFSET);
+		EEPROM_Scan();
+		EEPROM_Ready = (FLASH_OK == return_value) ? 1 : 0;
+	}
+
+	return EEPROM_Ready ? EEPROM_OK : EEPROM_ERROR;
+}
+
+/**=============================================
+  * @Fn				- EEPROM_Read
+  * @brief 			- Reads the last value written to a key
+  * @param [in] 	- key: Key of the value (0...EEPROM_MAX_KEYS-1)
+  * @param [out] 	- data: Buffer of EEPROM_MAX_LENGTH bytes
+  * @param [out] 	- length: Number of bytes read
+  * @retval 		- EEPROM_OK if the key has a value, EEPROM_ERROR otherwise @ref EEPROM_RETURN_define
+  * Note			- None
+  */
+uint8 EEPROM_Read(uint8 key, uint8* data, uint8* length){
+	uint8 return_value = EEPROM_ERROR;
+
+	*length = 0;
+	if((key < EEPROM_MAX_KEYS) && (0 != EEPROM_Index[key])){
+		*length = (uint8)(EEPROM_Read_HalfWord(EEPROM_Active, EEPROM_Index[key]) >> 8);
+		EEPROM_Read_Record(EEPROM_Index[key], data, *length);
+		return_value = (0 != *length) ? EEPROM_OK : EEPROM_ERROR;
+	}
+	else{ /* Do Nothing */ }
+
+	return return_value;
+}
+
+/**=============================================
+  * @Fn				- EEPROM_Write
+  * @brief 			- Appends a new value of a key to the active page
+  * @param [in] 	- key: Key of the value (0...EEPROM_MAX_KEYS-1)
+  * @param [in] 	- data: Pointer to the value bytes
+  * @param [in] 	- length: Number of bytes (0...EEPROM_MAX_LENGTH), 0 deletes the key
+  * @param [out] 	- None
+  * @retval 		- EEPROM_OK or EEPROM_ERROR @ref EEPROM_RETURN_define
+  * Note			- Writing the saved value again costs nothing, a full page is compacted to the other one first
+  * 				  Main context only, the flash stalls the core for about 20 ms per page erase
+  */
+uint8 EEPROM_Write(uint8 key, const uint8* data, uint8 length){
+	uint8 saved[EEPROM_MAX_LENGTH];
+	uint8 saved_length, index;
+	uint8 return_value = FLASH_ERROR;
+
+	if(EEPROM_Ready && (key < EEPROM_MAX_KEYS) && (length <= EEPROM_MAX_LENGTH)){
+		EEPROM_Read(key, saved, &saved_length);
+		for(index = 0; (index < length) && (length == saved_length) && (data[index] == saved[index]); index++);
+
+		if((length == saved_length) && (index == length)){
+			/* Same value, no flash wear */
+			return_value = FLASH_OK;
+		}
+		else{
+			MCAL_FLASH_Unlock();
+			return_value = FLASH_OK;
+			if((EEPROM_Free + EEPROM_RECORD_SIZE(length)) > FLASH_PAGE_SIZE){
+				return_value = EEPROM_Transfer();
+			}
+			else{ /* Do Nothing */ }
+
+			if(FLASH_OK == return_value){
+				return_value = EEPROM_Program_Record(EEPROM_Active, EEPROM_Free, key, data, length);
+				if(FLASH_OK == return_value){
+					EEPROM_Index[key] = EEPROM_Free;
+					EEPROM_Free += EEPROM_RECORD_SIZE(length);
+				}
+				else{
+					/* Nothing can follow a half programmed record, the next write transfers the page */
+					EEPROM_Free = FLASH_PAGE_SIZE;
+				}
+			}
+			else{ /* Do Nothing */ }
+			MCAL_FLASH_Lock();
+		}
+	}
+	else{ /* Do Nothing */ }
+
+	return (FLASH_OK == return_value) ? EEPROM_OK : EEPROM_ERROR;
+}
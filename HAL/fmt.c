@@ -0,0 +1,361 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : fmt.c 			                             		 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "fmt.h"
+
+/* Longest field body: 32 binary digits, or 10 integer digits + '.' + 9 fraction digits */
+#define FMT_MAX_DIGITS		32
+
+static const uint8 Fmt_Digits_Lower[16] = "0123456789abcdef";
+static const uint8 Fmt_Digits_Upper[16] = "0123456789ABCDEF";
+
+static const uint32 Fmt_Pow10[10] = {
+		1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+static void Fmt_Put(Fmt_Sink_t* sink, uint8 Char){
+	sink->Put(sink->Context, Char);
+	sink->Count++;
+}
+
+static void Fmt_Put_LCD(void* Context, uint8 Char){
+	LCD_Send_Char((LCD_t*)Context, Char);
+}
+
+static void Fmt_Put_USART(void* Context, uint8 Char){
+	uint16 data = Char;
+	MCAL_USART_SendData((USART_TypeDef*)Context, &data, enable);
+}
+
+static void Fmt_Put_Buffer(void* Context, uint8 Char){
+	Fmt_Buffer_t* buffer = (Fmt_Buffer_t*)Context;
+	if((buffer->Length + 1U) < buffer->Size){
+		buffer->Data[buffer->Length] = Char;
+		buffer->Length++;
+		buffer->Data[buffer->Length] = '\0';
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Converts value to digits in the given base, most significant first, returns number of digits */
+static uint8 Fmt_Convert(uint32 value, uint8 base, uint8 flags, uint8* out){
+	uint8 reversed[FMT_MAX_DIGITS];
+	uint8 length = 0;
+	uint8 index;
+	const uint8* digits = (flags & FMT_FLAG_UPPER) ? Fmt_Digits_Upper : Fmt_Digits_Lower;
+
+	do{
+		reversed[length++] = digits[value % base];
+		value /= base;
+	}while(value != 0);
+
+	for(index = 0; index < length; index++){
+		out[index] = reversed[length - 1 - index];
+	}
+	return length;
+}
+
+/* Writes sign and body padded to width according to flags */
+static void Fmt_Field(Fmt_Sink_t* sink, const uint8* body, uint8 length, uint8 sign, uint8 width, uint8 flags){
+	uint8 index;
+	uint8 total = length + ((sign != 0) ? 1 : 0);
+	uint8 padding = (width > total) ? (width - total) : 0;
+
+	if(flags & FMT_FLAG_LEFT){
+		if(sign){ Fmt_Put(sink, sign); }
+		for(index = 0; index < length; index++){ Fmt_Put(sink, body[index]); }
+		for(index = 0; index < padding; index++){ Fmt_Put(sink, ' '); }
+	}
+	else if(flags & FMT_FLAG_ZERO_PAD){
+		if(sign){ Fmt_Put(sink, sign); }
+		for(index = 0; index < padding; index++){ Fmt_Put(sink, '0'); }
+		for(index = 0; index < length; index++){ Fmt_Put(sink, body[index]); }
+	}
+	else{
+		for(index = 0; index < padding; index++){ Fmt_Put(sink, ' '); }
+		if(sign){ Fmt_Put(sink, sign); }
+		for(index = 0; index < length; index++){ Fmt_Put(sink, body[index]); }
+	}
+}
+
+static uint8 Fmt_Sign(uint8 negative, uint8 flags){
+	uint8 sign = 0;
+	if(negative){
+		sign = '-';
+	}
+	else if(flags & FMT_FLAG_PLUS){
+		sign = '+';
+	}
+	else{ /* Do Nothing */ }
+	return sign;
+}
+
+/**=============================================
+  * @Fn				- Fmt_Sink_LCD
+  * @brief 			- Initializes a sink that writes at the current cursor of an LCD
+  * @param [out] 	- sink: Pointer to the sink to be initialized
+  * @param [in] 	- LCD_cfg: Pointer to the LCD, its shadow buffer is updated with every character
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_Sink_LCD(Fmt_Sink_t* sink, LCD_t* LCD_cfg){
+	sink->Put = Fmt_Put_LCD;
+	sink->Context = LCD_cfg;
+	sink->Count = 0;
+}
+
+/**=============================================
+  * @Fn				- Fmt_Sink_USART
+  * @brief 			- Initializes a sink that transmits on a USART
+  * @param [out] 	- sink: Pointer to the sink to be initialized
+  * @param [in] 	- USARTx: Pointer to the USART peripheral instance
+  * @retval 		- None
+  * Note			- Characters are sent with polling on the TXE flag
+  */
+void Fmt_Sink_USART(Fmt_Sink_t* sink, USART_TypeDef* USARTx){
+	sink->Put = Fmt_Put_USART;
+	sink->Context = USARTx;
+	sink->Count = 0;
+}
+
+/**=============================================
+  * @Fn				- Fmt_Sink_Buffer
+  * @brief 			- Initializes a sink that stores characters in a caller provided buffer
+  * @param [out] 	- sink: Pointer to the sink to be initialized
+  * @param [out] 	- buffer: Pointer to the buffer descriptor
+  * @param [in] 	- data: Storage for the characters
+  * @param [in] 	- size: Size of data in bytes including the null terminator
+  * @retval 		- None
+  * Note			- Output that does not fit is dropped
+  */
+void Fmt_Sink_Buffer(Fmt_Sink_t* sink, Fmt_Buffer_t* buffer, uint8* data, uint16 size){
+	buffer->Data = data;
+	buffer->Size = size;
+	buffer->Length = 0;
+	if(size > 0){
+		data[0] = '\0';
+	}
+	else{ /* Do Nothing */ }
+
+	sink->Put = Fmt_Put_Buffer;
+	sink->Context = buffer;
+	sink->Count = 0;
+}
+
+/**=============================================
+  * @Fn				- Fmt_String
+  * @brief 			- Writes a null terminated string padded to a field width
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- str: String to be written
+  * @param [in] 	- width: Minimum field width (0 = no padding)
+  * @param [in] 	- flags: Formatting flags @ref FMT_FLAGS_define
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_String(Fmt_Sink_t* sink, const uint8* str, uint8 width, uint8 flags){
+	uint8 length = 0;
+	uint8 index;
+
+	while((str[length] != '\0') && (length < 0xFF)){
+		length++;
+	}
+
+	if(!(flags & FMT_FLAG_LEFT)){
+		for(index = length; index < width; index++){ Fmt_Put(sink, ' '); }
+	}
+	else{ /* Do Nothing */ }
+
+	for(index = 0; index < length; index++){
+		Fmt_Put(sink, str[index]);
+	}
+
+	if(flags & FMT_FLAG_LEFT){
+		for(index = length; index < width; index++){ Fmt_Put(sink, ' '); }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- Fmt_Uint
+  * @brief 			- Writes an unsigned integer
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- value: Value to be written
+  * @param [in] 	- base: Numeric base (2...16)
+  * @param [in] 	- width: Minimum field width (0 = no padding)
+  * @param [in] 	- flags: Formatting flags @ref FMT_FLAGS_define
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_Uint(Fmt_Sink_t* sink, uint32 value, uint8 base, uint8 width, uint8 flags){
+	uint8 body[FMT_MAX_DIGITS];
+	uint8 length;
+
+	if((base < 2) || (base > 16)){
+		base = 10;
+	}
+	else{ /* Do Nothing */ }
+
+	length = Fmt_Convert(value, base, flags, body);
+	Fmt_Field(sink, body, length, 0, width, flags);
+}
+
+/**=============================================
+  * @Fn				- Fmt_Int
+  * @brief 			- Writes a signed decimal integer
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- value: Value to be written
+  * @param [in] 	- width: Minimum field width (0 = no padding)
+  * @param [in] 	- flags: Formatting flags @ref FMT_FLAGS_define
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_Int(Fmt_Sink_t* sink, sint32 value, uint8 width, uint8 flags){
+	uint8 body[FMT_MAX_DIGITS];
+	uint8 length;
+	uint32 magnitude = (value < 0) ? (0UL - (uint32)value) : (uint32)value;
+
+	length = Fmt_Convert(magnitude, 10, flags, body);
+	Fmt_Field(sink, body, length, Fmt_Sign((value < 0), flags), width, flags);
+}
+
+/**=============================================
+  * @Fn				- Fmt_Fixed
+  * @brief 			- Writes a fixed-point decimal number
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- value: Value scaled by 10^frac_digits (1234 with 2 digits prints 12.34)
+  * @param [in] 	- frac_digits: Number of digits after the decimal point (0...9)
+  * @param [in] 	- width: Minimum field width (0 = no padding)
+  * @param [in] 	- flags: Formatting flags @ref FMT_FLAGS_define
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_Fixed(Fmt_Sink_t* sink, sint32 value, uint8 frac_digits, uint8 width, uint8 flags){
+	uint8 body[FMT_MAX_DIGITS];
+	uint8 fraction[FMT_MAX_DIGITS];
+	uint8 length, frac_length, index;
+	uint32 magnitude = (value < 0) ? (0UL - (uint32)value) : (uint32)value;
+
+	if(frac_digits > 9){
+		frac_digits = 9;
+	}
+	else{ /* Do Nothing */ }
+
+	/* Integer part */
+	length = Fmt_Convert(magnitude / Fmt_Pow10[frac_digits], 10, flags, body);
+
+	/* Fractional part, left padded with zeros to frac_digits */
+	if(frac_digits > 0){
+		frac_length = Fmt_Convert(magnitude % Fmt_Pow10[frac_digits], 10, flags, fraction);
+		body[length++] = '.';
+		for(index = frac_length; index < frac_digits; index++){
+			body[length++] = '0';
+		}
+		for(index = 0; index < frac_length; index++){
+			body[length++] = fraction[index];
+		}
+	}
+	else{ /* Do Nothing */ }
+
+	Fmt_Field(sink, body, length, Fmt_Sign((value < 0), flags), width, flags);
+}
+
+/**=============================================
+  * @Fn				- Fmt_Print
+  * @brief 			- Writes a formatted string, printf compatible subset
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- format: Format string supporting %d %i %u %x %X %c %s %% with the
+  * 				  '-', '+' and '0' flags, a field width and the 'l'/'h' length modifiers
+  * @retval 		- None
+  * Note			- No heap and no libc printf is used, the format string is checked by the compiler
+  */
+void Fmt_Print(Fmt_Sink_t* sink, const char* format, ...){
+	va_list args;
+	va_start(args, format);
+	Fmt_VPrint(sink, format, args);
+	va_end(args);
+}
+
+/**=============================================
+  * @Fn				- Fmt_VPrint
+  * @brief 			- Same as Fmt_Print taking a va_list
+  * @param [in] 	- sink: Pointer to the output sink
+  * @param [in] 	- format: Format string, see Fmt_Print
+  * @param [in] 	- args: Arguments of the format string
+  * @retval 		- None
+  * Note			- None
+  */
+void Fmt_VPrint(Fmt_Sink_t* sink, const char* format, va_list args){
+	uint8 flags, width, is_long;
+
+	while(*format != '\0'){
+		if('%' != *format){
+			Fmt_Put(sink, (uint8)*format++);
+			continue;
+		}
+		else{ format++; }
+
+		/* Flags */
+		flags = FMT_FLAG_NONE;
+		while(1){
+			if('0' == *format){ flags |= FMT_FLAG_ZERO_PAD; }
+			else if('-' == *format){ flags |= FMT_FLAG_LEFT; }
+			else if('+' == *format){ flags |= FMT_FLAG_PLUS; }
+			else{ break; }
+			format++;
+		}
+
+		/* Field width */
+		width = 0;
+		while((*format >= '0') && (*format <= '9')){
+			width = (width * 10) + (*format - '0');
+			format++;
+		}
+
+		/* Length modifiers, all integers are 32 bits wide on the target */
+		is_long = 0;
+		while(('l' == *format) || ('h' == *format)){
+			is_long = ('l' == *format) ? 1 : is_long;
+			format++;
+		}
+
+		switch(*format){
+		case 'd':
+		case 'i':
+			Fmt_Int(sink, (is_long ? (sint32)va_arg(args, long) : (sint32)va_arg(args, int)), width, flags);
+			break;
+		case 'u':
+			Fmt_Uint(sink, (is_long ? (uint32)va_arg(args, unsigned long) : (uint32)va_arg(args, unsigned int)), 10, width, flags);
+			break;
+		case 'X':
+			flags |= FMT_FLAG_UPPER;
+			/* fall through */
+		case 'x':
+			Fmt_Uint(sink, (is_long ? (uint32)va_arg(args, unsigned long) : (uint32)va_arg(args, unsigned int)), 16, width, flags);
+			break;
+		case 'c':
+			Fmt_Put(sink, (uint8)va_arg(args, int));
+			break;
+		case 's':
+			Fmt_String(sink, (const uint8*)va_arg(args, const char*), width, flags);
+			break;
+		case '%':
+			Fmt_Put(sink, '%');
+			break;
+		case '\0':
+			/* Dangling '%' at the end of the format string */
+			return;
+		default:
+			/* Unsupported conversion, print it as is */
+			Fmt_Put(sink, '%');
+			Fmt_Put(sink, (uint8)*format);
+			break;
+		}
+		format++;
+	}
+}
@@ -18,7 +18,72 @@ static uint8 Keypad_Buttons [KEYPAD_ROWS][KEYPAD_COLS] = {
 };
 
 static uint16 Keypad_ROWS_GPIO [KEYPAD_ROWS] = {ROW0, ROW1, ROW2, ROW3};
-static uint16 Keypad_COLS_GPIO [KEYPAD_COLS] = {COL0, COL1, COL2};
+static uint8  Keypad_COLS_LINE [KEYPAD_COLS] = {COL0_LINE, COL1_LINE, COL2_LINE};
+
+/* Debounce state of every key, indexed by (row * KEYPAD_COLS + col) */
+static uint8  Keypad_Integrator[KEYPAD_KEYS];
+static uint16 Keypad_Hold_ms[KEYPAD_KEYS];
+static uint16 Keypad_Pressed;
+static volatile uint8 Keypad_Scanning;
+
+/* Events queue, written by the scan interrupt and read by the application */
+static Keypad_Event_t Keypad_FIFO[KEYPAD_FIFO_SIZE];
+static volatile uint8 Keypad_FIFO_Head, Keypad_FIFO_Tail;
+
+static void keypad_Push_Event(uint8 key_index, Keypad_Event_Type_t type){
+	uint8 next = (Keypad_FIFO_Head + 1) & (KEYPAD_FIFO_SIZE - 1);
+
+	if(next != Keypad_FIFO_Tail){
+		Keypad_FIFO[Keypad_FIFO_Head].Key = Keypad_Buttons[key_index / KEYPAD_COLS][key_index % KEYPAD_COLS];
+		Keypad_FIFO[Keypad_FIFO_Head].Type = type;
+		Keypad_FIFO_Head = next;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Drives one row at a time and returns a bit per pressed key, rows are left low
+ * Each row costs one port write and 1 + KEYPAD_SETTLE_READS port reads, the column
+ * bits of the read are placed at (row * KEYPAD_COLS) to index Keypad_Buttons directly */
+static uint16 keypad_Sample(void){
+	uint16 sample = 0;
+	uint8 row_index, settle;
+
+	for(row_index = 0; row_index < KEYPAD_ROWS; row_index++){
+		/* Raise this row and lower the previous one in a single store */
+		GPIO_PORT_SET_RESET(KEYPAD_PORT, Keypad_ROWS_GPIO[row_index], ROWS_MASK & ~Keypad_ROWS_GPIO[row_index]);
+
+		/* A read back waits for the buffered store to reach the port and gives the
+		 * input synchronizer its clocks, a read right after would see the old row */
+		for(settle = 0; settle < KEYPAD_SETTLE_READS; settle++){
+			(void)GPIO_PORT_READ(KEYPAD_PORT);
+		}
+		sample |= ((GPIO_PORT_READ(KEYPAD_PORT) & COLS_MASK) >> COLS_SHIFT) << (row_index * KEYPAD_COLS);
+	}
+	GPIO_PORT_SET_RESET(KEYPAD_PORT, 0, ROWS_MASK);
+
+	return sample;
+}
+
+/* Column edge interrupt, wakes the keypad up from idle */
+static void keypad_Column_Handler(void){
+	MCAL_EXTI_Disable_Lines(COLS_MASK);
+	GPIO_PORT_SET_RESET(KEYPAD_PORT, 0, ROWS_MASK);
+	Keypad_Scanning = 1;
+}
+
+/* Returns to idle, all rows high waiting for a column edge */
+static void keypad_Idle(void){
+	Keypad_Scanning = 0;
+	GPIO_PORT_SET_RESET(KEYPAD_PORT, ROWS_MASK, 0);
+	MCAL_EXTI_Clear_Pending(COLS_MASK);
+	MCAL_EXTI_Enable_Lines(COLS_MASK);
+
+	/* A key pressed after the last sample raised its column before the edge was armed */
+	if(GPIO_PORT_READ(KEYPAD_PORT) & COLS_MASK){
+		keypad_Column_Handler();
+	}
+	else{ /* Do Nothing */ }
+}
 
 /**=============================================
   * @Fn				- keypad_init
@@ -27,61 +92,134 @@ static uint16 Keypad_COLS_GPIO [KEYPAD_COLS] = {COL0, COL1, COL2};
   * @param [out] 	- None
   * @retval 		- None
   * Note			- User must define GPIO pins for rows and columns in @ref Keypad_PINS_define
+  * 				  All rows are kept driven high while idle, any key press raises its column
+  * 				  and triggers the EXTI interrupt that starts the periodic scanning
   */
 void keypad_init(){
-	GPIO_PinConfig_t Pin_Cfg;
-	Pin_Cfg.GPIO_MODE = GPIO_MODE_OUTPUT_PP;
-	Pin_Cfg.GPIO_OUTPUT_SPEED = GPIO_SPEED_10M;
+	EXTI_PinConfig_t EXTI_Cfg;
+	uint8 col_index;
+
+	/* Rows idle high, the level is latched before the pins become outputs */
+	GPIO_PORT_SET_RESET(KEYPAD_PORT, ROWS_MASK, 0);
+	MCAL_GPIO_InitMask(KEYPAD_PORT, ROWS_MASK, GPIO_MODE_OUTPUT_PP, GPIO_SPEED_10M);
+	MCAL_GPIO_InitMask(KEYPAD_PORT, COLS_MASK, GPIO_MODE_INPUT_PD, GPIO_SPEED_10M);
+
+	/* Columns interrupt on press only, releases are seen by the scan */
+	EXTI_Cfg.GPIO_Port = KEYPAD_PORT;
+	EXTI_Cfg.Trigger = EXTI_TRIGGER_RISING;
+	EXTI_Cfg.IRQ_EN = EXTI_IRQ_ENABLE;
+	EXTI_Cfg.P_IRQ_CallBack = keypad_Column_Handler;
+	for(col_index = 0; col_index < KEYPAD_COLS; col_index++){
+		EXTI_Cfg.Line = Keypad_COLS_LINE[col_index];
+		MCAL_EXTI_Init(&EXTI_Cfg);
+	}
+}
 
-	Pin_Cfg.GPIO_PinNumber = ROW0;
-	MCAL_GPIO_Init(KEYPAD_PORT, &Pin_Cfg);
-	MCAL_GPIO_WritePin(KEYPAD_PORT, ROW0, GPIO_PIN_RESET);
+/**=============================================
+  * @Fn				- keypad_Scan_Tick
+  * @brief 			- Samples the whole matrix, debounces every key and queues the resulting events
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Must be called every KEYPAD_SCAN_PERIOD_MS from an interrupt (timer or SysTick)
+  * 				  Returns immediately while the keypad is idle, scanning stops once all keys are released
+  * 				  Any number of keys can be held, without diodes three keys on a rectangle also show the fourth
+  */
+void keypad_Scan_Tick(void){
+	uint16 sample, key_mask;
+	uint8 key_index;
+	uint8 active = 0;
+
+	if(Keypad_Scanning){
+		sample = keypad_Sample();
 
-	Pin_Cfg.GPIO_PinNumber = ROW1;
-	MCAL_GPIO_Init(KEYPAD_PORT, &Pin_Cfg);
-	MCAL_GPIO_WritePin(KEYPAD_PORT, ROW1, GPIO_PIN_RESET);
+		for(key_index = 0; key_index < KEYPAD_KEYS; key_index++){
+			key_mask = (1U << key_index);
+
+			/* Integrating debounce, the state only flips at either end of the count */
+			if(sample & key_mask){
+				if(Keypad_Integrator[key_index] < KEYPAD_DEBOUNCE_SAMPLES){
+					Keypad_Integrator[key_index]++;
+				}
+				else{ /* Do Nothing */ }
+			}
+			else if(Keypad_Integrator[key_index] > 0){
+				Keypad_Integrator[key_index]--;
+			}
+			else{ /* Do Nothing */ }
+
+			if((KEYPAD_DEBOUNCE_SAMPLES == Keypad_Integrator[key_index]) && !(Keypad_Pressed & key_mask)){
+				Keypad_Pressed |= key_mask;
+				Keypad_Hold_ms[key_index] = 0;
+				keypad_Push_Event(key_index, KEYPAD_EVENT_PRESS);
+			}
+			else if((0 == Keypad_Integrator[key_index]) && (Keypad_Pressed & key_mask)){
+				Keypad_Pressed &= ~key_mask;
+				keypad_Push_Event(key_index, KEYPAD_EVENT_RELEASE);
+			}
+			else if(Keypad_Pressed & key_mask){
+				Keypad_Hold_ms[key_index] += KEYPAD_SCAN_PERIOD_MS;
+				if(KEYPAD_LONG_PRESS_MS == Keypad_Hold_ms[key_index]){
+					keypad_Push_Event(key_index, KEYPAD_EVENT_LONG_PRESS);
+				}
+				else if(Keypad_Hold_ms[key_index] >= (KEYPAD_LONG_PRESS_MS + KEYPAD_REPEAT_MS)){
+					/* Step back to the long press time so the hold counter never overflows */
+					Keypad_Hold_ms[key_index] = KEYPAD_LONG_PRESS_MS;
+					keypad_Push_Event(key_index, KEYPAD_EVENT_REPEAT);
+				}
+				else{ /* Do Nothing */ }
+			}
+			else{ /* Do Nothing */ }
 
-	Pin_Cfg.GPIO_PinNumber = ROW2;
-	MCAL_GPIO_Init(KEYPAD_PORT, &Pin_Cfg);
-	MCAL_GPIO_WritePin(KEYPAD_PORT, ROW2, GPIO_PIN_RESET);
+			active |= Keypad_Integrator[key_index];
+		}
 
-	Pin_Cfg.GPIO_PinNumber = ROW3;
-	MCAL_GPIO_Init(KEYPAD_PORT, &Pin_Cfg);
-	MCAL_GPIO_WritePin(KEYPAD_PORT, ROW3, GPIO_PIN_RESET);
+		if(0 == active){
+			keypad_Idle();
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
 
-	Pin_Cfg.GPIO_MODE = GPIO_MODE_INPUT_PD;
-	Pin_Cfg.GPIO_PinNumber = COL0;
-	MCAL_GPIO_Init(KEYPAD_PORT, &Pin_Cfg);
+/**=============================================
+  * @Fn				- keypad_Get_Event
+  * @brief 			- Takes the oldest event out of the keypad event queue
+  * @param [out] 	- event: Pointer to where the event is stored
+  * @retval 		- 1 if an event was returned, 0 if the queue is empty
+  * Note			- Events are dropped while the queue is full
+  */
+uint8 keypad_Get_Event(Keypad_Event_t* event){
+	uint8 return_value = 0;
 
-	Pin_Cfg.GPIO_PinNumber = COL1;
-	MCAL_GPIO_Init(KEYPAD_PORT, &Pin_Cfg);
+	if(Keypad_FIFO_Tail != Keypad_FIFO_Head){
+		*event = Keypad_FIFO[Keypad_FIFO_Tail];
+		Keypad_FIFO_Tail = (Keypad_FIFO_Tail + 1) & (KEYPAD_FIFO_SIZE - 1);
+		return_value = 1;
+	}
+	else{ /* Do Nothing */ }
 
-	Pin_Cfg.GPIO_PinNumber = COL2;
-	MCAL_GPIO_Init(KEYPAD_PORT, &Pin_Cfg);
+	return return_value;
 }
 
 /**=============================================
   * @Fn				- keypad_Get_Pressed_Key
-  * @brief 			- Checks for any pressed key and returns the value of it
+  * @brief 			- Returns the next key press from the event queue
   * @param [in] 	- None
   * @param [out] 	- None
-  * @retval 		- Value of the pressed key, or F if no key is pressed
-  * Note			- None
+  * @retval 		- Value of the pressed key, or KEYPAD_NO_KEY if no key was pressed
+  * Note			- Other queued event types are discarded, use keypad_Get_Event to receive them
   */
 uint8 keypad_Get_Pressed_Key(){
-	uint8 return_char = 'F';
-	uint8 row_index, col_index;
-	for(row_index = 0; row_index < KEYPAD_ROWS; row_index++){
-		MCAL_GPIO_WritePin(KEYPAD_PORT, Keypad_ROWS_GPIO[row_index], GPIO_PIN_SET);
-		for(col_index = 0; col_index < KEYPAD_COLS; col_index++){
-			if(MCAL_GPIO_ReadPin(KEYPAD_PORT, Keypad_COLS_GPIO[col_index]) == GPIO_PIN_SET){
-				while(MCAL_GPIO_ReadPin(KEYPAD_PORT, Keypad_COLS_GPIO[col_index]) == GPIO_PIN_SET);
-				return_char = Keypad_Buttons[row_index][col_index];
-				MCAL_GPIO_WritePin(KEYPAD_PORT, Keypad_ROWS_GPIO[row_index], GPIO_PIN_RESET);
-				return return_char;
-			}
+	Keypad_Event_t event;
+	uint8 return_char = KEYPAD_NO_KEY;
+
+	while((KEYPAD_NO_KEY == return_char) && keypad_Get_Event(&event)){
+		if(KEYPAD_EVENT_PRESS == event.Type){
+			return_char = event.Key;
 		}
-		MCAL_GPIO_WritePin(KEYPAD_PORT, Keypad_ROWS_GPIO[row_index], GPIO_PIN_RESET);
+		else{ /* Do Nothing */ }
 	}
+
 	return return_char;
 }
@@ -9,43 +9,118 @@
 
 #include "lcd_driver.h"
 
-static void LCD_GPIO_Init(LCD_t* LCD_cfg){
-	GPIO_PinConfig_t PIN_CFG;
-	PIN_CFG.GPIO_MODE = GPIO_MODE_OUTPUT_PP;
-	PIN_CFG.GPIO_OUTPUT_SPEED = GPIO_SPEED_10M;
+/* DDRAM address of the first column of each row */
+static const uint8 LCD_Row_Address[LCD_MAX_ROWS] = {0x00, 0x40, 0x14, 0x54};
+
+/* Execution times per controller, indexed by @ref LCD_Controller_t */
+static const LCD_Timing_t LCD_Timing_Profiles[LCD_CONTROLLER_MAX] = {
+		/* Power_On, Reset_Wait1, Reset_Wait2, Clear_Home, Command, Data, Enable_Pulse */
+		{  15000,      4100,         100,         1520,       37,     41,      1 }, /* LCD_HD44780 (fosc = 270 kHz) */
+		{  30000,      4100,         100,         1530,       39,     43,      1 }, /* LCD_KS0066  (fosc = 250 kHz) */
+		{  40000,      4100,         100,         1520,       37,     41,      1 }  /* LCD_ST7066U (fosc = 270 kHz) */
+};
 
-	PIN_CFG.GPIO_PinNumber = LCD_cfg->RS_PIN;
-	MCAL_GPIO_Init(LCD_cfg->GPIO_PORT, &PIN_CFG);
+static const LCD_Timing_t* LCD_Get_Timing(LCD_t* LCD_cfg){
+	return (LCD_cfg->Controller < LCD_CONTROLLER_MAX) ? &LCD_Timing_Profiles[LCD_cfg->Controller] : &LCD_Timing_Profiles[LCD_HD44780];
+}
 
-	PIN_CFG.GPIO_PinNumber = LCD_cfg->EN_PIN;
-	MCAL_GPIO_Init(LCD_cfg->GPIO_PORT, &PIN_CFG);
+/* Puts the upper nibble of value on D4-D7 in one store and latches it */
+static void LCD_Write_Nibble(LCD_t* LCD_cfg, uint8 value){
+	MCAL_GPIO_WriteGroup(LCD_cfg->GPIO_PORT, LCD_cfg->Nibble_Pins[0x0F], LCD_cfg->Nibble_Pins[value >> 4]);
+	LCD_Send_Enable_Signal(LCD_cfg);
+}
 
+/* Transfers one byte on the data bus, RS must be set by the caller */
+static void LCD_Write_Bus(LCD_t* LCD_cfg, uint8 value){
 	if(LCD_8BIT == LCD_cfg->Mode){
-		PIN_CFG.GPIO_PinNumber = LCD_cfg->D0_PIN;
-		MCAL_GPIO_Init(LCD_cfg->GPIO_PORT, &PIN_CFG);
+		/* Low nibble is placed first, the high nibble store latches the whole byte */
+		MCAL_GPIO_WriteGroup(LCD_cfg->GPIO_PORT, LCD_cfg->D0_PIN | LCD_cfg->D1_PIN | LCD_cfg->D2_PIN | LCD_cfg->D3_PIN,
+				((value & 0x01) ? LCD_cfg->D0_PIN : 0) | ((value & 0x02) ? LCD_cfg->D1_PIN : 0) |
+				((value & 0x04) ? LCD_cfg->D2_PIN : 0) | ((value & 0x08) ? LCD_cfg->D3_PIN : 0));
+		LCD_Write_Nibble(LCD_cfg, value);
+	}
+	else if(LCD_4BIT == LCD_cfg->Mode){
+		LCD_Write_Nibble(LCD_cfg, value);
+		LCD_Write_Nibble(LCD_cfg, (uint8)(value << 4));
+	}
+	else{ /* Do Nothing */ }
+}
+
+static void LCD_Clear_Shadow(LCD_t* LCD_cfg){
+	uint8 row, column;
+	for(row = 0; row < LCD_MAX_ROWS; row++){
+		for(column = 0; column < LCD_MAX_COLUMNS; column++){
+			LCD_cfg->Shadow[row][column] = ' ';
+		}
+	}
+}
+
+/* Keeps the address counter copy in sync with the command sent to the LCD */
+static void LCD_Track_Command(LCD_t* LCD_cfg, uint8 command){
+	if(command & LCD_SET_DDRAM_ADDRESS){
+		LCD_cfg->Cursor = (command & 0x7F);
+	}
+	else if(command & LCD_SET_CGRAM_ADDRESS){
+		LCD_cfg->Cursor = LCD_CURSOR_CGRAM;
+	}
+	else if(LCD_CLEAR_DISPLAY == command){
+		LCD_Clear_Shadow(LCD_cfg);
+		LCD_cfg->Cursor = 0;
+	}
+	else if(LCD_RETURN_HOME == (command & 0xFE)){
+		LCD_cfg->Cursor = 0;
+	}
+	else{ /* Do Nothing */ }
+}
 
-		PIN_CFG.GPIO_PinNumber = LCD_cfg->D1_PIN;
-		MCAL_GPIO_Init(LCD_cfg->GPIO_PORT, &PIN_CFG);
+/* Records the written character in the shadow buffer and advances the address counter copy */
+static void LCD_Track_Char(LCD_t* LCD_cfg, uint8 Char){
+	uint8 row;
+	uint8 address = LCD_cfg->Cursor;
 
-		PIN_CFG.GPIO_PinNumber = LCD_cfg->D2_PIN;
-		MCAL_GPIO_Init(LCD_cfg->GPIO_PORT, &PIN_CFG);
+	if(LCD_CURSOR_CGRAM != address){
+		for(row = 0; row < LCD_MAX_ROWS; row++){
+			if((address >= LCD_Row_Address[row]) && (address < (LCD_Row_Address[row] + LCD_MAX_COLUMNS))){
+				LCD_cfg->Shadow[row][address - LCD_Row_Address[row]] = Char;
+				break;
+			}
+			else{ /* Do Nothing */ }
+		}
 
-		PIN_CFG.GPIO_PinNumber = LCD_cfg->D3_PIN;
-		MCAL_GPIO_Init(LCD_cfg->GPIO_PORT, &PIN_CFG);
+		/* Two line mode: each line holds 40 addresses, 0x00-0x27 and 0x40-0x67 */
+		if(LCD_cfg->Entry_Mode & 0x02){
+			address++;
+			if(0x28 == address){ address = 0x40; }
+			else if(0x68 == address){ address = 0x00; }
+			else{ /* Do Nothing */ }
+		}
+		else{
+			if(0x00 == address){ address = 0x67; }
+			else if(0x40 == address){ address = 0x27; }
+			else{ address--; }
+		}
+		LCD_cfg->Cursor = address;
 	}
 	else{ /* Do Nothing */ }
+}
 
-	PIN_CFG.GPIO_PinNumber = LCD_cfg->D4_PIN;
-	MCAL_GPIO_Init(LCD_cfg->GPIO_PORT, &PIN_CFG);
+static void LCD_GPIO_Init(LCD_t* LCD_cfg){
+	uint8 nibble;
+	uint16 Pins = LCD_cfg->RS_PIN | LCD_cfg->EN_PIN | LCD_cfg->D4_PIN | LCD_cfg->D5_PIN | LCD_cfg->D6_PIN | LCD_cfg->D7_PIN;
 
-	PIN_CFG.GPIO_PinNumber = LCD_cfg->D5_PIN;
-	MCAL_GPIO_Init(LCD_cfg->GPIO_PORT, &PIN_CFG);
+	if(LCD_8BIT == LCD_cfg->Mode){
+		Pins |= LCD_cfg->D0_PIN | LCD_cfg->D1_PIN | LCD_cfg->D2_PIN | LCD_cfg->D3_PIN;
+	}
+	else{ /* Do Nothing */ }
 
-	PIN_CFG.GPIO_PinNumber = LCD_cfg->D6_PIN;
-	MCAL_GPIO_Init(LCD_cfg->GPIO_PORT, &PIN_CFG);
+	/* All LCD pins share one port, configured with a single write per configuration register */
+	MCAL_GPIO_InitMask(LCD_cfg->GPIO_PORT, Pins, GPIO_MODE_OUTPUT_PP, GPIO_SPEED_10M);
 
-	PIN_CFG.GPIO_PinNumber = LCD_cfg->D7_PIN;
-	MCAL_GPIO_Init(LCD_cfg->GPIO_PORT, &PIN_CFG);
+	/* Pin pattern of every nibble value, the bus is then written with one BSRR store */
+	for(nibble = 0; nibble < 16; nibble++){
+		LCD_cfg->Nibble_Pins[nibble] = ((nibble & 0x1) ? LCD_cfg->D4_PIN : 0) | ((nibble & 0x2) ? LCD_cfg->D5_PIN : 0) |
+									   ((nibble & 0x4) ? LCD_cfg->D6_PIN : 0) | ((nibble & 0x8) ? LCD_cfg->D7_PIN : 0);
+	}
 }
 
 /**=============================================
@@ -56,45 +131,42 @@ static void LCD_GPIO_Init(LCD_t* LCD_cfg){
   * Note			- User must set configurations @ref LCD_CONFIG_define
   */
 void LCD_Init(LCD_t* LCD_cfg){
+	const LCD_Timing_t* timing = LCD_Get_Timing(LCD_cfg);
+
 	// Initialize GPIO Pins
 	LCD_GPIO_Init(LCD_cfg);
-	MCAL_STK_Delay1ms(2);
+	MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->RS_PIN, GPIO_PIN_RESET);
+	MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->EN_PIN, GPIO_PIN_RESET);
+	dus(timing->Power_On_us);
+
+	// Initialization by instruction, the controller may be in either interface mode after power on
+	LCD_Write_Nibble(LCD_cfg, 0x30);
+	dus(timing->Reset_Wait1_us);
+	LCD_Write_Nibble(LCD_cfg, 0x30);
+	dus(timing->Reset_Wait2_us);
+	LCD_Write_Nibble(LCD_cfg, 0x30);
+	dus(timing->Command_us);
+
 	if(LCD_8BIT == LCD_cfg->Mode){
 		// Send Function Set
 		LCD_Send_Command(LCD_cfg, LCD_8BIT_MODE_2_LINE);
-		MCAL_STK_Delay1ms(1);
-
 	}
 	else if(LCD_4BIT == LCD_cfg->Mode){
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->RS_PIN, GPIO_PIN_RESET);
-		MCAL_STK_Delay1ms(1);
-
-		// Send Function Set
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D4_PIN, (LCD_4BIT_MODE_2_LINE&0x10));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D5_PIN, (LCD_4BIT_MODE_2_LINE&0x20));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D6_PIN, (LCD_4BIT_MODE_2_LINE&0x40));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D7_PIN, (LCD_4BIT_MODE_2_LINE&0x80));
-		MCAL_STK_Delay1ms(1);
-		LCD_Send_Enable_Signal(LCD_cfg);
-
+		// Switch to 4-bit interface, then send the full Function Set
+		LCD_Write_Nibble(LCD_cfg, 0x20);
+		dus(timing->Command_us);
 		LCD_Send_Command(LCD_cfg, LCD_4BIT_MODE_2_LINE);
-		MCAL_STK_Delay1ms(1);
-
-
 	}
 	else{ /* Do Nothing */ }
 
 	// Set Display Settings
 	LCD_Send_Command(LCD_cfg, LCD_cfg->Display_Mode);
-	MCAL_STK_Delay1ms(1);
 
 	// Send clear display command
 	LCD_Send_Command(LCD_cfg, LCD_CLEAR_DISPLAY);
-	MCAL_STK_Delay1ms(2);
 
 	// Set Entry Mode Settings
 	LCD_Send_Command(LCD_cfg, LCD_cfg->Entry_Mode);
-	MCAL_STK_Delay1ms(1);
 }
 
 /**=============================================
@@ -103,38 +175,23 @@ void LCD_Init(LCD_t* LCD_cfg){
   * @param [in] 	- LCD_cfg: Pointer to the structure containing LCD configuration
   * @param [in] 	- command: command to be executed @ref LCD_COMMANDS_define
   * @retval 		- None
-  * Note			- None
+  * Note			- Waits for the execution time of the command from the controller timing profile
   */
 void LCD_Send_Command(LCD_t* LCD_cfg, uint8 command){
+	const LCD_Timing_t* timing = LCD_Get_Timing(LCD_cfg);
+
 	MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->RS_PIN, GPIO_PIN_RESET);
-	MCAL_STK_Delay1ms(1);
-	if(LCD_8BIT == LCD_cfg->Mode){
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D0_PIN, (command&0x01));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D1_PIN, (command&0x02));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D2_PIN, (command&0x04));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D3_PIN, (command&0x08));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D4_PIN, (command&0x10));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D5_PIN, (command&0x20));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D6_PIN, (command&0x40));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D7_PIN, (command&0x80));
+	LCD_Write_Bus(LCD_cfg, command);
+
+	// Clear display and return home are the only long instructions
+	if((LCD_CLEAR_DISPLAY == command) || (LCD_RETURN_HOME == (command & 0xFE))){
+		dus(timing->Clear_Home_us);
 	}
-	else if(LCD_4BIT == LCD_cfg->Mode){
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D4_PIN, (command&0x10));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D5_PIN, (command&0x20));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D6_PIN, (command&0x40));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D7_PIN, (command&0x80));
-		LCD_Send_Enable_Signal(LCD_cfg);
-		MCAL_STK_Delay1ms(1);
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D4_PIN, (command&0x01));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D5_PIN, (command&0x02));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D6_PIN, (command&0x04));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D7_PIN, (command&0x08));
+	else{
+		dus(timing->Command_us);
 	}
-	else{ /* Do Nothing */ }
 
-	MCAL_STK_Delay1ms(1);
-	LCD_Send_Enable_Signal(LCD_cfg);
-	MCAL_STK_Delay1ms(100);
+	LCD_Track_Command(LCD_cfg, command);
 }
 
 /**=============================================
@@ -143,38 +200,14 @@ void LCD_Send_Command(LCD_t* LCD_cfg, uint8 command){
   * @param [in] 	- LCD_cfg: Pointer to the structure containing LCD configuration
   * @param [in] 	- Char: ASCII character to be displayed on screen
   * @retval 		- None
-  * Note			- None
+  * Note			- Waits for the data write time from the controller timing profile
   */
 void LCD_Send_Char(LCD_t* LCD_cfg, uint8 Char){
 	MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->RS_PIN, GPIO_PIN_SET);
-	MCAL_STK_Delay1ms(1);
-	if(LCD_8BIT == LCD_cfg->Mode){
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D0_PIN, (Char&0x01));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D1_PIN, (Char&0x02));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D2_PIN, (Char&0x04));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D3_PIN, (Char&0x08));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D4_PIN, (Char&0x10));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D5_PIN, (Char&0x20));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D6_PIN, (Char&0x40));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D7_PIN, (Char&0x80));
-	}
-	else if(LCD_4BIT == LCD_cfg->Mode){
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D4_PIN, (Char&0x10));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D5_PIN, (Char&0x20));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D6_PIN, (Char&0x40));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D7_PIN, (Char&0x80));
-		MCAL_STK_Delay1ms(1);
-		LCD_Send_Enable_Signal(LCD_cfg);
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D4_PIN, (Char&0x01));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D5_PIN, (Char&0x02));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D6_PIN, (Char&0x04));
-		MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->D7_PIN, (Char&0x08));
-	}
-	else{ /* Do Nothing */ }
+	LCD_Write_Bus(LCD_cfg, Char);
+	dus(LCD_Get_Timing(LCD_cfg)->Data_us);
 
-	MCAL_STK_Delay1ms(1);
-	LCD_Send_Enable_Signal(LCD_cfg);
-	MCAL_STK_Delay1ms(100);
+	LCD_Track_Char(LCD_cfg, Char);
 }
 
 /**=============================================
@@ -230,10 +263,13 @@ void LCD_Send_string_Pos(LCD_t* LCD_cfg, uint8 *string, uint8 row, uint8 column)
   * Note			- None
   */
 void LCD_Send_Enable_Signal(LCD_t* LCD_cfg){
+	const LCD_Timing_t* timing = LCD_Get_Timing(LCD_cfg);
+
+	// Data is latched on the falling edge, both enable high and low times have a minimum width
 	MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->EN_PIN, GPIO_PIN_SET);
-	MCAL_STK_Delay1ms(1);
+	dus(timing->Enable_Pulse_us);
 	MCAL_GPIO_WritePin(LCD_cfg->GPIO_PORT, LCD_cfg->EN_PIN, GPIO_PIN_RESET);
-	MCAL_STK_Delay1ms(1);
+	dus(timing->Enable_Pulse_us);
 }
 
 /**=============================================
@@ -249,3 +285,62 @@ void LCD_Set_Cursor(LCD_t* LCD_cfg, uint8 row, uint8 column){
 	column--;
 	LCD_Send_Command(LCD_cfg, row + column);
 }
+
+/**=============================================
+  * @Fn				- LCD_Update_Char
+  * @brief 			- Displays a char at a specific location only if it differs from what is on screen
+  * @param [in] 	- LCD_cfg: Pointer to the structure containing LCD configuration
+  * @param [in] 	- Char: ASCII character to be displayed on screen
+  * @param [in] 	- row: Selects the row number of the displayed character @ref LCD_ROWS_POS_define
+  * @param [in] 	- column: Selects the column number of the displayed character (1...16)
+  * @retval 		- None
+  * Note			- The cursor command is skipped when the address counter already points to the cell
+  */
+void LCD_Update_Char(LCD_t* LCD_cfg, uint8 Char, uint8 row, uint8 column){
+	uint8 row_index;
+	uint8 address = (row & 0x7F) + (column - 1);
+
+	for(row_index = 0; row_index < LCD_MAX_ROWS; row_index++){
+		if(LCD_Row_Address[row_index] == (row & 0x7F)){
+			break;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	if((row_index < LCD_MAX_ROWS) && (column >= 1) && (column <= LCD_MAX_COLUMNS)){
+		if(LCD_cfg->Shadow[row_index][column - 1] != Char){
+			if(LCD_cfg->Cursor != address){
+				LCD_Send_Command(LCD_cfg, LCD_SET_DDRAM_ADDRESS | address);
+			}
+			else{ /* Do Nothing */ }
+			LCD_Send_Char(LCD_cfg, Char);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LCD_Write_CGRAM
+  * @brief 			- Uploads a 5x8 custom character bitmap into one of the CGRAM slots
+  * @param [in] 	- LCD_cfg: Pointer to the structure containing LCD configuration
+  * @param [in] 	- slot: CGRAM slot to be written (0...7)
+  * @param [in] 	- bitmap: 8 rows of the glyph, only the lower 5 bits of each row are used
+  * @retval 		- None
+  * Note			- The cursor is restored to its previous DDRAM address after the upload
+  */
+void LCD_Write_CGRAM(LCD_t* LCD_cfg, uint8 slot, const uint8* bitmap){
+	uint8 index;
+	uint8 prev_cursor = LCD_cfg->Cursor;
+
+	LCD_Send_Command(LCD_cfg, LCD_SET_CGRAM_ADDRESS | ((slot & 0x07) << 3));
+	for(index = 0; index < LCD_GLYPH_ROWS; index++){
+		LCD_Send_Char(LCD_cfg, (bitmap[index] & 0x1F));
+	}
+
+	/* Point the address counter back to DDRAM so the next characters land on screen */
+	if(LCD_CURSOR_CGRAM != prev_cursor){
+		LCD_Send_Command(LCD_cfg, LCD_SET_DDRAM_ADDRESS | prev_cursor);
+	}
+	else{ /* Do Nothing */ }
+}
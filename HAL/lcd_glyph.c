@@ -0,0 +1,111 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : lcd_glyph.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "lcd_glyph.h"
+
+static uint8 Glyph_Equal(const uint8* first, const uint8* second){
+	uint8 index;
+	for(index = 0; index < LCD_GLYPH_ROWS; index++){
+		if((first[index] & 0x1F) != (second[index] & 0x1F)){
+			return 0;
+		}
+		else{ /* Do Nothing */ }
+	}
+	return 1;
+}
+
+/* Returns a bit mask of the CGRAM slots referenced by characters on screen */
+static uint8 Glyph_On_Screen(LCD_t* LCD_cfg){
+	uint8 row, column, Char;
+	uint8 mask = 0;
+	for(row = 0; row < LCD_MAX_ROWS; row++){
+		for(column = 0; column < LCD_MAX_COLUMNS; column++){
+			Char = LCD_cfg->Shadow[row][column];
+			if(Char < 0x10){
+				mask |= (1U << (Char & 0x07));
+			}
+			else{ /* Do Nothing */ }
+		}
+	}
+	return mask;
+}
+
+/**=============================================
+  * @Fn				- LCD_Glyph_Cache_Init
+  * @brief 			- Initializes an empty glyph cache for the given LCD
+  * @param [in] 	- cache: Pointer to the glyph cache
+  * @param [in] 	- LCD_cfg: Pointer to the LCD that owns the CGRAM
+  * @retval 		- None
+  * Note			- Must be called after LCD_Init
+  */
+void LCD_Glyph_Cache_Init(LCD_Glyph_Cache_t* cache, LCD_t* LCD_cfg){
+	uint8 slot;
+	cache->LCD = LCD_cfg;
+	cache->Clock = 0;
+	cache->CGRAM_Uploads = 0;
+	for(slot = 0; slot < LCD_CGRAM_SLOTS; slot++){
+		cache->Slots[slot].Loaded = 0;
+		cache->Slots[slot].Last_Used = 0;
+	}
+}
+
+/**=============================================
+  * @Fn				- LCD_Glyph_Get
+  * @brief 			- Returns the character code that displays the given bitmap
+  * @param [in] 	- cache: Pointer to the glyph cache
+  * @param [in] 	- bitmap: 8 rows of the 5x8 glyph
+  * @retval 		- Character code @ref LCD_GLYPH_CODE_define, or LCD_GLYPH_NONE if no slot can be freed
+  * Note			- The bitmap is uploaded only on a miss, replacing the least recently used
+  * 				  glyph that is not currently shown on screen
+  */
+uint8 LCD_Glyph_Get(LCD_Glyph_Cache_t* cache, const uint8* bitmap){
+	uint8 slot, index, on_screen;
+	uint8 victim = LCD_GLYPH_NONE;
+
+	cache->Clock++;
+
+	/* Hit: the glyph is already in CGRAM */
+	for(slot = 0; slot < LCD_CGRAM_SLOTS; slot++){
+		if((cache->Slots[slot].Loaded) && Glyph_Equal(cache->Slots[slot].Bitmap, bitmap)){
+			cache->Slots[slot].Last_Used = cache->Clock;
+			return (LCD_GLYPH_CODE_BASE | slot);
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	/* Miss: prefer an empty slot, otherwise the least recently used glyph that is off screen */
+	on_screen = Glyph_On_Screen(cache->LCD);
+	for(slot = 0; slot < LCD_CGRAM_SLOTS; slot++){
+		if(!cache->Slots[slot].Loaded){
+			victim = slot;
+			break;
+		}
+		else if(on_screen & (1U << slot)){
+			/* Evicting it would corrupt the characters on screen */
+		}
+		else if((LCD_GLYPH_NONE == victim) || (cache->Slots[slot].Last_Used < cache->Slots[victim].Last_Used)){
+			victim = slot;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	if(LCD_GLYPH_NONE != victim){
+		for(index = 0; index < LCD_GLYPH_ROWS; index++){
+			cache->Slots[victim].Bitmap[index] = (bitmap[index] & 0x1F);
+		}
+		cache->Slots[victim].Loaded = 1;
+		cache->Slots[victim].Last_Used = cache->Clock;
+		LCD_Write_CGRAM(cache->LCD, victim, cache->Slots[victim].Bitmap);
+		cache->CGRAM_Uploads++;
+		victim |= LCD_GLYPH_CODE_BASE;
+	}
+	else{ /* Do Nothing */ }
+
+	return victim;
+}
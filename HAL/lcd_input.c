@@ -0,0 +1,83 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : lcd_input.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "lcd_input.h"
+
+/* Draws the cursor mark after the last character while there is room for one more */
+static void LCD_Input_Draw_Cursor(LCD_Input_t* input, uint8 Char){
+	if(input->Length < input->Max_Length){
+		LCD_Update_Char(input->LCD, Char, input->Row, input->Column + input->Length);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LCD_Input_Start
+  * @brief 			- Clears an input field on the LCD and starts editing it
+  * @param [out] 	- input: Pointer to the input field state
+  * @param [in] 	- LCD_cfg: Pointer to the structure containing LCD configuration
+  * @param [in] 	- row: Row of the field @ref LCD_ROWS_POS_define
+  * @param [in] 	- column: Column of the first character of the field (1...16)
+  * @param [in] 	- max_length: Maximum number of characters, limited to the end of the row
+  * @retval 		- None
+  * Note			- None
+  */
+void LCD_Input_Start(LCD_Input_t* input, LCD_t* LCD_cfg, uint8 row, uint8 column, uint8 max_length){
+	uint8 index;
+
+	input->LCD = LCD_cfg;
+	input->Row = row;
+	input->Column = column;
+	input->Max_Length = ((column + max_length - 1) > LCD_MAX_COLUMNS) ? (LCD_MAX_COLUMNS - column + 1) : max_length;
+	input->Length = 0;
+	input->Status = LCD_INPUT_EDITING;
+
+	for(index = 0; index < input->Max_Length; index++){
+		LCD_Update_Char(LCD_cfg, ' ', row, column + index);
+	}
+	LCD_Input_Draw_Cursor(input, LCD_INPUT_CURSOR_CHAR);
+}
+
+/**=============================================
+  * @Fn				- LCD_Input_Process_Key
+  * @brief 			- Applies one key to the input field and echoes the change on the LCD
+  * @param [in] 	- input: Pointer to the input field state
+  * @param [in] 	- key: Pressed key, LCD_INPUT_KEY_ENTER and LCD_INPUT_KEY_BACKSPACE edit the field
+  * @retval 		- Status of the field @ref LCD_Input_Status_t
+  * Note			- Enter is ignored while the field is empty, keys are ignored once the field is done
+  */
+LCD_Input_Status_t LCD_Input_Process_Key(LCD_Input_t* input, uint8 key){
+	if(LCD_INPUT_EDITING == input->Status){
+		if(LCD_INPUT_KEY_ENTER == key){
+			if(input->Length > 0){
+				LCD_Input_Draw_Cursor(input, ' ');
+				input->Status = LCD_INPUT_DONE;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else if(LCD_INPUT_KEY_BACKSPACE == key){
+			if(input->Length > 0){
+				LCD_Input_Draw_Cursor(input, ' ');
+				input->Length--;
+				LCD_Input_Draw_Cursor(input, LCD_INPUT_CURSOR_CHAR);
+			}
+			else{ /* Do Nothing */ }
+		}
+		else if(input->Length < input->Max_Length){
+			input->Buffer[input->Length] = key;
+			LCD_Update_Char(input->LCD, key, input->Row, input->Column + input->Length);
+			input->Length++;
+			LCD_Input_Draw_Cursor(input, LCD_INPUT_CURSOR_CHAR);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+
+	return input->Status;
+}
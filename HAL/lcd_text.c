@@ -0,0 +1,194 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : lcd_text.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "lcd_text.h"
+
+static const uint8 LCD_Text_Row_Pos[LCD_MAX_ROWS] = {LCD_FIRST_ROW, LCD_SECOND_ROW, LCD_THIRD_ROW, LCD_FOURTH_ROW};
+
+/* Returns the length of the wrapped line starting at start and the start of the line after it */
+static uint16 LCD_Text_Wrap_Line(const LCD_Text_t* text, uint16 start, uint16* next){
+	uint16 index;
+	uint16 remaining = text->Length - start;
+	uint16 limit = (remaining < LCD_MAX_COLUMNS) ? remaining : LCD_MAX_COLUMNS;
+
+	/* Explicit line break */
+	for(index = 0; index < limit; index++){
+		if('\n' == text->Text[start + index]){
+			*next = start + index + 1;
+			return index;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	if(remaining <= LCD_MAX_COLUMNS){
+		*next = text->Length;
+		return remaining;
+	}
+	else{ /* Do Nothing */ }
+
+	/* Break at the last space that keeps the word on this line */
+	for(index = LCD_MAX_COLUMNS; index > 0; index--){
+		if(' ' == text->Text[start + index]){
+			*next = start + index + 1;
+			return index;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	/* Word longer than a line, hard break */
+	*next = start + LCD_MAX_COLUMNS;
+	return LCD_MAX_COLUMNS;
+}
+
+/* Returns the text index of the first line of the given page, or Length if the page is empty */
+static uint16 LCD_Text_Page_Start(const LCD_Text_t* text, uint16 page){
+	uint16 start = 0;
+	uint16 next;
+	uint32 lines = (uint32)page * text->Rows;
+
+	while((lines > 0) && (start < text->Length)){
+		(void)LCD_Text_Wrap_Line(text, start, &next);
+		start = next;
+		lines--;
+	}
+	return start;
+}
+
+static void LCD_Text_Draw_Page(LCD_Text_t* text){
+	uint8 row, column;
+	uint16 start = LCD_Text_Page_Start(text, text->Position);
+	uint16 next = start;
+	uint16 length;
+
+	for(row = 0; row < text->Rows; row++){
+		length = (start < text->Length) ? LCD_Text_Wrap_Line(text, start, &next) : 0;
+		for(column = 0; column < LCD_MAX_COLUMNS; column++){
+			LCD_Update_Char(text->LCD, ((column < length) ? text->Text[start + column] : ' '),
+					LCD_Text_Row_Pos[text->First_Row + row], column + 1);
+		}
+		start = next;
+	}
+}
+
+static void LCD_Text_Draw_Marquee(LCD_Text_t* text){
+	uint8 column;
+	uint16 index;
+	uint16 cycle = text->Length + LCD_TEXT_MARQUEE_GAP;
+
+	for(column = 0; column < LCD_MAX_COLUMNS; column++){
+		index = (text->Position + column) % cycle;
+		LCD_Update_Char(text->LCD, ((index < text->Length) ? text->Text[index] : ' '),
+				LCD_Text_Row_Pos[text->First_Row], column + 1);
+	}
+}
+
+static void LCD_Text_Draw(LCD_Text_t* text){
+	if(LCD_TEXT_MARQUEE == text->Mode){
+		LCD_Text_Draw_Marquee(text);
+	}
+	else{
+		LCD_Text_Draw_Page(text);
+	}
+}
+
+/**=============================================
+  * @Fn				- LCD_Text_Start
+  * @brief 			- Lays out a string over a region of the LCD and draws the first frame
+  * @param [out] 	- text: Pointer to the text layout state
+  * @param [in] 	- LCD_cfg: Pointer to the structure containing LCD configuration
+  * @param [in] 	- string: Null terminated string, must stay valid while the text is active
+  * @param [in] 	- mode: Layout mode @ref LCD_Text_Mode_t
+  * @param [in] 	- row: First row of the region @ref LCD_ROWS_POS_define
+  * @param [in] 	- rows: Number of rows of the region (forced to 1 in marquee mode)
+  * @param [in] 	- step_ms: Time between two pages or scroll steps
+  * @retval 		- None
+  * Note			- Text that fits in the region is drawn once and never redrawn
+  */
+void LCD_Text_Start(LCD_Text_t* text, LCD_t* LCD_cfg, const uint8* string, LCD_Text_Mode_t mode, uint8 row, uint8 rows, uint16 step_ms){
+	uint8 row_index;
+
+	for(row_index = 0; row_index < LCD_MAX_ROWS; row_index++){
+		if(LCD_Text_Row_Pos[row_index] == row){
+			break;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	text->Active = 0;
+	if(row_index < LCD_MAX_ROWS){
+		text->LCD = LCD_cfg;
+		text->Text = string;
+		text->Length = 0;
+		while('\0' != string[text->Length]){
+			text->Length++;
+		}
+		text->Mode = mode;
+		text->First_Row = row_index;
+		text->Rows = (LCD_TEXT_MARQUEE == mode) ? 1 : rows;
+		if((text->Rows == 0) || ((row_index + text->Rows) > LCD_MAX_ROWS)){
+			text->Rows = LCD_MAX_ROWS - row_index;
+		}
+		else{ /* Do Nothing */ }
+		text->Position = 0;
+		text->Step_ms = step_ms;
+		text->Elapsed_ms = 0;
+
+		LCD_Text_Draw(text);
+
+		/* Only text that overflows its region needs further frames */
+		if(LCD_TEXT_MARQUEE == mode){
+			text->Active = (text->Length > LCD_MAX_COLUMNS);
+		}
+		else{
+			text->Active = (LCD_Text_Page_Start(text, 1) < text->Length);
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LCD_Text_Stop
+  * @brief 			- Stops updating the text, the last frame stays on screen
+  * @param [in] 	- text: Pointer to the text layout state
+  * @retval 		- None
+  * Note			- None
+  */
+void LCD_Text_Stop(LCD_Text_t* text){
+	text->Active = 0;
+}
+
+/**=============================================
+  * @Fn				- LCD_Text_Update
+  * @brief 			- Advances the text by the elapsed time and draws the new frame if due
+  * @param [in] 	- text: Pointer to the text layout state
+  * @param [in] 	- elapsed_ms: Time since the previous call
+  * @retval 		- None
+  * Note			- Only the cells that differ from the previous frame are written to the LCD
+  */
+void LCD_Text_Update(LCD_Text_t* text, uint16 elapsed_ms){
+	if(text->Active){
+		text->Elapsed_ms += elapsed_ms;
+		if(text->Elapsed_ms >= text->Step_ms){
+			text->Elapsed_ms = 0;
+			if(LCD_TEXT_MARQUEE == text->Mode){
+				text->Position = (text->Position + 1) % (text->Length + LCD_TEXT_MARQUEE_GAP);
+			}
+			else{
+				text->Position++;
+				if(LCD_Text_Page_Start(text, text->Position) >= text->Length){
+					text->Position = 0;
+				}
+				else{ /* Do Nothing */ }
+			}
+			LCD_Text_Draw(text);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
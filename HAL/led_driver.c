@@ -9,6 +9,27 @@
 
 #include "led_driver.h"
 
+/* Pulse width of each brightness level, (level / LED_BRIGHTNESS_MAX)^2.2 * LED_PWM_PERIOD */
+static const uint16 LED_Gamma[LED_BRIGHTNESS_MAX + 1] = {
+	   0,    0,    1,    1,    2,    4,    6,    8,
+	  11,   14,   17,   22,   26,   31,   37,   43,
+	  49,   56,   64,   72,   80,   89,   99,  109,
+	 120,  131,  143,  155,  168,  181,  195,  210,
+	 225,  241,  257,  274,  292,  310,  329,  348,
+	 368,  389,  410,  432,  454,  477,  501,  525,
+	 550,  575,  601,  628,  656,  684,  712,  742,
+	 772,  802,  834,  866,  898,  931,  965, 1000
+};
+
+/* Writes the pulse width of a PWM LED, the output is high for the pulse so active low LEDs use the rest of the period */
+static void LED_Set_Pulse(const LED_cfg_t *led_cfg, uint16 pulse){
+	if(led_cfg->LED_Mode == LED_Active_Low){
+		pulse = LED_PWM_PERIOD - pulse;
+	}
+	else{ /* Do Nothing */ }
+	MCAL_PWM_Set_Compare(led_cfg->LED_Timer, led_cfg->LED_Channel, pulse);
+}
+
 /**=============================================
   * @Fn				- LED_Init
   * @brief 			- This function shall initialize the LED by setting the GPIO pin to the configuration provided in led_cfg
@@ -16,13 +37,22 @@
   * @param [out] 	- None
   * @retval 		- None
   * Note			- LED is initially off
+  * 				  A PWM LED also starts its timer at LED_PWM_PERIOD, LEDs on the same timer share it
   */
 void LED_Init(const LED_cfg_t *led_cfg){
+	PWM_cfg_t PWM_Cfg;
+
 	/* Validate that led_cfg is not a NULL pointer */
 	if(NULL != led_cfg){
 		MCAL_GPIO_Init(led_cfg->LED_Port, (GPIO_PinConfig_t*)&(led_cfg->LED_Pin));
 		/* Set LED initial state */
-		if(led_cfg->LED_Mode == LED_Active_High){
+		if(NULL != led_cfg->LED_Timer){
+			PWM_Cfg.Tick_Frequency = LED_PWM_TICK_FREQUENCY;
+			PWM_Cfg.Period = LED_PWM_PERIOD;
+			MCAL_PWM_Init(led_cfg->LED_Timer, &PWM_Cfg);
+			MCAL_PWM_Channel_Init(led_cfg->LED_Timer, led_cfg->LED_Channel, (led_cfg->LED_Mode == LED_Active_Low) ? LED_PWM_PERIOD : 0);
+		}
+		else if(led_cfg->LED_Mode == LED_Active_High){
 			MCAL_GPIO_WritePin(led_cfg->LED_Port, led_cfg->LED_Pin.GPIO_PinNumber, GPIO_PIN_RESET);
 		}
 		else if(led_cfg->LED_Mode == LED_Active_Low){
@@ -44,7 +74,10 @@ void LED_Init(const LED_cfg_t *led_cfg){
 void LED_TurnOn(const LED_cfg_t *led_cfg){
 	/* Validate that led_cfg is not a NULL pointer */
 	if(NULL != led_cfg){
-		if(led_cfg->LED_Mode == LED_Active_High){
+		if(NULL != led_cfg->LED_Timer){
+			LED_Set_Pulse(led_cfg, LED_PWM_PERIOD);
+		}
+		else if(led_cfg->LED_Mode == LED_Active_High){
 			MCAL_GPIO_WritePin(led_cfg->LED_Port, led_cfg->LED_Pin.GPIO_PinNumber, GPIO_PIN_SET);
 		}
 		else if(led_cfg->LED_Mode == LED_Active_Low){
@@ -66,7 +99,10 @@ void LED_TurnOn(const LED_cfg_t *led_cfg){
 void LED_TurnOff(const LED_cfg_t *led_cfg){
 	/* Validate that led_cfg is not a NULL pointer */
 	if(NULL != led_cfg){
-		if(led_cfg->LED_Mode == LED_Active_High){
+		if(NULL != led_cfg->LED_Timer){
+			LED_Set_Pulse(led_cfg, 0);
+		}
+		else if(led_cfg->LED_Mode == LED_Active_High){
 			MCAL_GPIO_WritePin(led_cfg->LED_Port, led_cfg->LED_Pin.GPIO_PinNumber, GPIO_PIN_RESET);
 		}
 		else if(led_cfg->LED_Mode == LED_Active_Low){
@@ -77,18 +113,59 @@ void LED_TurnOff(const LED_cfg_t *led_cfg){
 	else{ /* Do Nothing */ }
 }
 
+/**=============================================
+  * @Fn				- LED_Set_Brightness
+  * @brief 			- This function shall set the perceived brightness of the LED
+  * @param [in] 	- led_cfg: Pointer to the struct holding the LED configuration
+  * @param [in] 	- level: Brightness from 0 (off) to LED_BRIGHTNESS_MAX (fully on)
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- A GPIO LED is on for levels above half of LED_BRIGHTNESS_MAX
+  */
+void LED_Set_Brightness(const LED_cfg_t *led_cfg, uint8 level){
+	/* Validate that led_cfg is not a NULL pointer */
+	if(NULL != led_cfg){
+		if(level > LED_BRIGHTNESS_MAX){
+			level = LED_BRIGHTNESS_MAX;
+		}
+		else{ /* Do Nothing */ }
+		if(NULL != led_cfg->LED_Timer){
+			LED_Set_Pulse(led_cfg, LED_Gamma[level]);
+		}
+		else if(level > (LED_BRIGHTNESS_MAX / 2)){
+			LED_TurnOn(led_cfg);
+		}
+		else{
+			LED_TurnOff(led_cfg);
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
 /**=============================================
   * @Fn				- LED_Toggle
   * @brief 			- This function shall toggle the status of the LED
   * @param [in] 	- led_cfg: Pointer to the struct holding the LED configuration
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- A dimmed PWM LED is considered on
   */
 void LED_Toggle(const LED_cfg_t *led_cfg){
+	uint16 pulse;
+
 	/* Validate that led_cfg is not a NULL pointer */
 	if(NULL != led_cfg){
-		MCAL_GPIO_TogglePin(led_cfg->LED_Port, led_cfg->LED_Pin.GPIO_PinNumber);
+		if(NULL != led_cfg->LED_Timer){
+			pulse = MCAL_PWM_Get_Compare(led_cfg->LED_Timer, led_cfg->LED_Channel);
+			if(led_cfg->LED_Mode == LED_Active_Low){
+				pulse = LED_PWM_PERIOD - pulse;
+			}
+			else{ /* Do Nothing */ }
+			LED_Set_Pulse(led_cfg, (0 == pulse) ? LED_PWM_PERIOD : 0);
+		}
+		else{
+			MCAL_GPIO_ToggleGroup(led_cfg->LED_Port, led_cfg->LED_Pin.GPIO_PinNumber);
+		}
 	}
 	else{ /* Do Nothing */ }
 }
@@ -0,0 +1,208 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : led_pattern.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "led_pattern.h"
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+static const uint16 Blink_Steps[]		= {100, 100};
+static const uint16 Heartbeat_Steps[]	= {100, 150, 100, 650};
+static const uint16 Fast_Alarm_Steps[]	= {50, 50};
+static const uint16 Breathe_Steps[]		= {1500, 1500};
+
+const LED_Pattern_t LED_PATTERN_BLINK3		= {Blink_Steps, 2, 3, LED_PATTERN_PRIORITY_INFO, 0};
+const LED_Pattern_t LED_PATTERN_HEARTBEAT	= {Heartbeat_Steps, 4, LED_PATTERN_FOREVER, LED_PATTERN_PRIORITY_IDLE, 0};
+const LED_Pattern_t LED_PATTERN_FAST_ALARM	= {Fast_Alarm_Steps, 2, 10, LED_PATTERN_PRIORITY_ALARM, 0};
+const LED_Pattern_t LED_PATTERN_BREATHE		= {Breathe_Steps, 2, LED_PATTERN_FOREVER, LED_PATTERN_PRIORITY_IDLE, 1};
+
+//----------------------------------------------
+// Section: Private Functions
+//----------------------------------------------
+
+/* Drives the LED to the level of the current step, even steps are on (or fading in) */
+static void LED_Pattern_Apply(LED_Pattern_Player_t* player, const LED_Pattern_t* pattern){
+	uint8 level;
+
+	if(pattern->Fade){
+		/* Only the compare value changes, the timer keeps generating the PWM */
+		level = (uint8)(((uint32)player->Elapsed_ms * LED_BRIGHTNESS_MAX) / pattern->Steps[player->Step]);
+		LED_Set_Brightness(player->LED, (0 == (player->Step & 1)) ? level : (LED_BRIGHTNESS_MAX - level));
+	}
+	else if(0 == (player->Step & 1)){
+		LED_TurnOn(player->LED);
+	}
+	else{
+		LED_TurnOff(player->LED);
+	}
+}
+
+/* Restarts the player on a pattern, NULL stops it */
+static void LED_Pattern_Load(LED_Pattern_Player_t* player, const LED_Pattern_t* pattern){
+	player->Pattern = NULL;	// Keeps the tick from using a half loaded player
+	player->Step = 0;
+	player->Runs = 0;
+	player->Elapsed_ms = 0;
+	if(NULL != pattern){
+		LED_Pattern_Apply(player, pattern);
+	}
+	else{
+		LED_TurnOff(player->LED);
+	}
+	player->Pattern = pattern;
+}
+
+//----------------------------------------------
+// Section: API Definitions
+//----------------------------------------------
+
+/**=============================================
+  * @Fn				- LED_Pattern_Init
+  * @brief 			- Attaches a pattern player to an initialized LED
+  * @param [out] 	- player: Pointer to the pattern player
+  * @param [in] 	- led_cfg: Pointer to the LED configuration, must stay valid
+  * @retval 		- None
+  * Note			- No pattern is running after this call
+  */
+void LED_Pattern_Init(LED_Pattern_Player_t* player, const LED_cfg_t* led_cfg){
+	if((NULL != player) && (NULL != led_cfg)){
+		player->LED = led_cfg;
+		player->Resume = NULL;
+		player->Done_CallBack = NULL;
+		LED_Pattern_Load(player, NULL);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LED_Pattern_Start
+  * @brief 			- Starts a pattern from its first step
+  * @param [in] 	- player: Pointer to the pattern player
+  * @param [in] 	- pattern: Pattern to play, must stay valid while it runs
+  * @retval 		- 1 if the pattern was started, 0 if a higher priority pattern is running
+  * Note			- A preempted looping pattern is restarted when the new pattern ends
+  */
+uint8 LED_Pattern_Start(LED_Pattern_Player_t* player, const LED_Pattern_t* pattern){
+	const LED_Pattern_t* current;
+	uint8 started = 0;
+
+	if((NULL != player) && (NULL != pattern) && (0 != pattern->Count)){
+		CRITICAL_ENTER(LED_PATTERN_CRITICAL_LEVEL);
+		current = player->Pattern;
+		if((NULL == current) || (pattern->Priority >= current->Priority)){
+			/* Keep the looping background pattern to come back to it */
+			if((NULL != current) && (LED_PATTERN_FOREVER == current->Repeat) && (LED_PATTERN_FOREVER != pattern->Repeat)){
+				player->Resume = current;
+			}
+			else if(LED_PATTERN_FOREVER == pattern->Repeat){
+				player->Resume = NULL;
+			}
+			else{ /* Do Nothing */ }
+			LED_Pattern_Load(player, pattern);
+			started = 1;
+		}
+		else{ /* Do Nothing */ }
+		CRITICAL_EXIT();
+	}
+	else{ /* Do Nothing */ }
+	return started;
+}
+
+/**=============================================
+  * @Fn				- LED_Pattern_Stop
+  * @brief 			- Stops the running pattern and any preempted one, the LED is turned off
+  * @param [in] 	- player: Pointer to the pattern player
+  * @retval 		- None
+  * Note			- None
+  */
+void LED_Pattern_Stop(LED_Pattern_Player_t* player){
+	if(NULL != player){
+		CRITICAL_ENTER(LED_PATTERN_CRITICAL_LEVEL);
+		player->Resume = NULL;
+		LED_Pattern_Load(player, NULL);
+		CRITICAL_EXIT();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LED_Pattern_Update
+  * @brief 			- Advances the running pattern by the elapsed time
+  * @param [in] 	- player: Pointer to the pattern player
+  * @param [in] 	- elapsed_ms: Time since the previous call
+  * @retval 		- None
+  * Note			- Called periodically from the scheduler, the LED only changes at step boundaries
+  */
+void LED_Pattern_Update(LED_Pattern_Player_t* player, uint16 elapsed_ms){
+	const LED_Pattern_t* pattern = player->Pattern;
+	const LED_Pattern_t* next;
+
+	if(NULL != pattern){
+		player->Elapsed_ms += elapsed_ms;
+		/* Several steps may end in one call if the update period is longer than a step */
+		while((NULL != pattern) && (player->Elapsed_ms >= pattern->Steps[player->Step])){
+			player->Elapsed_ms -= pattern->Steps[player->Step];
+			player->Step++;
+			if(player->Step >= pattern->Count){
+				player->Step = 0;
+				player->Runs++;
+				if((LED_PATTERN_FOREVER != pattern->Repeat) && (player->Runs >= pattern->Repeat)){
+					/* Pattern finished, go back to the preempted one if any */
+					next = player->Resume;
+					player->Resume = NULL;
+					LED_Pattern_Load(player, next);
+					if(NULL != player->Done_CallBack){
+						player->Done_CallBack(pattern);
+					}
+					else{ /* Do Nothing */ }
+					pattern = next;
+					continue;
+				}
+				else{ /* Do Nothing */ }
+			}
+			else{ /* Do Nothing */ }
+			LED_Pattern_Apply(player, pattern);
+		}
+		/* Fading steps change the brightness on every call */
+		if((NULL != pattern) && pattern->Fade){
+			LED_Pattern_Apply(player, pattern);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LED_Pattern_Set_Done_CallBack
+  * @brief 			- Sets the function called when a finite pattern of the player plays to its end
+  * @param [in] 	- player: Pointer to the pattern player
+  * @param [in] 	- callback: Function receiving the finished pattern, NULL to remove it
+  * @retval 		- None
+  * Note			- Called from LED_Pattern_Update (tick interrupt), not for stopped or preempted patterns
+  */
+void LED_Pattern_Set_Done_CallBack(LED_Pattern_Player_t* player, void (*callback)(const LED_Pattern_t* pattern)){
+	if(NULL != player){
+		player->Done_CallBack = callback;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- LED_Pattern_Is_Active
+  * @brief 			- Checks if a pattern is running
+  * @param [in] 	- player: Pointer to the pattern player
+  * @retval 		- 1 if a pattern is running, 0 otherwise
+  * Note			- None
+  */
+uint8 LED_Pattern_Is_Active(const LED_Pattern_Player_t* player){
+	return (NULL != player->Pattern);
+}
@@ -0,0 +1,186 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : motion_profile.c 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "motion_profile.h"
+
+/* Peak velocity and acceleration of the smootherstep, relative to Distance/T and Distance/T^2 */
+#define MOTION_SCURVE_VELOCITY_x1000		1875UL		// 15/8
+#define MOTION_SCURVE_ACCELERATION_x1M		5773503UL	// 10/sqrt(3)
+
+#define MOTION_Q16_ONE						65536UL
+
+static uint32 Motion_Sqrt(uint32 value){
+	uint32 root = 0;
+	uint32 bit = 1UL << 30;
+
+	while(bit > value){
+		bit >>= 2;
+	}
+	while(bit != 0){
+		if(value >= (root + bit)){
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return root;
+}
+
+/* Distance covered t ms after the start of a trapezoid profile */
+static uint32 Motion_Trapezoid_Distance(const Motion_t* motion, uint32 t){
+	uint32 accel = motion->Limits->Acceleration;
+	uint32 distance;
+
+	if(t <= motion->Accel_ms){
+		distance = (uint32)(((uint64)accel * t * t) / 2000000UL);
+	}
+	else if(t <= (motion->Accel_ms + motion->Cruise_ms)){
+		distance = (uint32)(((uint64)accel * motion->Accel_ms * motion->Accel_ms) / 2000000UL)
+				 + (uint32)(((uint64)motion->Peak_Velocity * (t - motion->Accel_ms)) / 1000UL);
+	}
+	else{
+		t = motion->Duration_ms - t;
+		distance = motion->Distance - (uint32)(((uint64)accel * t * t) / 2000000UL);
+	}
+
+	return (distance > motion->Distance) ? motion->Distance : distance;
+}
+
+/* Distance covered t ms after the start of a smootherstep profile, s(u) = 10u^3 - 15u^4 + 6u^5 */
+static uint32 Motion_SCurve_Distance(const Motion_t* motion, uint32 t){
+	uint64 u = ((uint64)t * MOTION_Q16_ONE) / motion->Duration_ms;
+	uint64 u2 = (u * u) >> 16;
+	uint64 u3 = (u2 * u) >> 16;
+	uint64 poly = (10 * MOTION_Q16_ONE) - (15 * u) + (6 * u2);
+	uint64 s = (u3 * poly) >> 16;
+
+	return (uint32)((motion->Distance * s) >> 16);
+}
+
+/**=============================================
+  * @Fn				- Motion_Init
+  * @brief 			- Initializes a motion at rest at a given position
+  * @param [out] 	- motion: Pointer to the motion state
+  * @param [in] 	- limits: Pointer to the shape and limits, must stay valid while the motion is used
+  * @param [in] 	- position: Initial position
+  * @retval 		- None
+  * Note			- None
+  */
+void Motion_Init(Motion_t* motion, const Motion_Limits_t* limits, uint16 position){
+	motion->Limits = limits;
+	motion->Start = position;
+	motion->Target = position;
+	motion->Position = position;
+	motion->Distance = 0;
+	motion->Duration_ms = 0;
+	motion->Elapsed_ms = 0;
+	motion->Active = 0;
+}
+
+/**=============================================
+  * @Fn				- Motion_Start
+  * @brief 			- Plans a trajectory from the current position to a target
+  * @param [in] 	- motion: Pointer to the motion state
+  * @param [in] 	- target: Final position
+  * @retval 		- None
+  * Note			- A running motion is replanned from where it is, starting again from rest
+  */
+void Motion_Start(Motion_t* motion, uint16 target){
+	uint32 velocity = motion->Limits->Max_Velocity;
+	uint32 accel = motion->Limits->Acceleration;
+	uint32 scurve_accel_ms;
+
+	motion->Active = 0;
+	motion->Start = motion->Position;
+	motion->Target = target;
+	motion->Distance = (target > motion->Position) ? (target - motion->Position) : (motion->Position - target);
+	motion->Elapsed_ms = 0;
+
+	if(MOTION_SCURVE == motion->Limits->Shape){
+		/* Shortest time that respects both the velocity and the acceleration limits */
+		motion->Duration_ms = (MOTION_SCURVE_VELOCITY_x1000 * motion->Distance) / velocity;
+		scurve_accel_ms = Motion_Sqrt((uint32)(((uint64)MOTION_SCURVE_ACCELERATION_x1M * motion->Distance) / accel));
+		if(scurve_accel_ms > motion->Duration_ms){
+			motion->Duration_ms = scurve_accel_ms;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{
+		if(((uint64)motion->Distance * accel) >= ((uint64)velocity * velocity)){
+			/* Max velocity is reached, cruise for the remaining distance */
+			motion->Peak_Velocity = velocity;
+			motion->Accel_ms = (velocity * 1000UL) / accel;
+			motion->Cruise_ms = (uint32)((((uint64)motion->Distance * accel) - ((uint64)velocity * velocity)) * 1000UL / ((uint64)velocity * accel));
+		}
+		else{
+			/* Too short to reach max velocity, triangular profile */
+			motion->Accel_ms = Motion_Sqrt((uint32)(((uint64)motion->Distance * 1000000UL) / accel));
+			motion->Peak_Velocity = (accel * motion->Accel_ms) / 1000UL;
+			motion->Cruise_ms = 0;
+		}
+		motion->Duration_ms = (2 * motion->Accel_ms) + motion->Cruise_ms;
+	}
+
+	if((motion->Distance > 0) && (motion->Duration_ms > 0)){
+		motion->Active = 1;
+	}
+	else{
+		motion->Position = target;
+	}
+}
+
+/**=============================================
+  * @Fn				- Motion_Step
+  * @brief 			- Advances the trajectory and returns the new position
+  * @param [in] 	- motion: Pointer to the motion state
+  * @param [in] 	- elapsed_ms: Time since the previous step
+  * @retval 		- Position at the new time
+  * Note			- The motion becomes inactive once the target is reached
+  */
+uint16 Motion_Step(Motion_t* motion, uint16 elapsed_ms){
+	uint32 distance, covered;
+
+	if(motion->Active){
+		motion->Elapsed_ms += elapsed_ms;
+		if(motion->Elapsed_ms >= motion->Duration_ms){
+			motion->Position = motion->Target;
+			motion->Active = 0;
+		}
+		else{
+			distance = (MOTION_SCURVE == motion->Limits->Shape) ?
+					Motion_SCurve_Distance(motion, motion->Elapsed_ms) :
+					Motion_Trapezoid_Distance(motion, motion->Elapsed_ms);
+			covered = (motion->Target > motion->Start) ?
+					(uint32)(motion->Position - motion->Start) : (uint32)(motion->Start - motion->Position);
+			/* Near the ends the fixed-point rounding can give one unit less than the previous step */
+			if(distance > covered){
+				motion->Position = (motion->Target > motion->Start) ?
+						(uint16)(motion->Start + distance) : (uint16)(motion->Start - distance);
+			}
+			else{ /* Do Nothing */ }
+		}
+	}
+	else{ /* Do Nothing */ }
+
+	return motion->Position;
+}
+
+/**=============================================
+  * @Fn				- Motion_Is_Active
+  * @brief 			- Checks if the trajectory is still running
+  * @param [in] 	- motion: Pointer to the motion state
+  * @retval 		- 1 while moving, 0 at rest
+  * Note			- None
+  */
+uint8 Motion_Is_Active(const Motion_t* motion){
+	return motion->Active;
+}
@@ -0,0 +1,55 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : AFIO_driver.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "AFIO_driver.h"
+
+/**=============================================
+  * @Fn				- MCAL_AFIO_Init
+  * @brief 			- Takes a reference on the clock of the AFIO peripheral
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Must be called before any AFIO register is written
+  */
+void MCAL_AFIO_Init(void){
+	MCAL_RCC_Acquire_Peripheral(RCC_AFIO);
+}
+
+/**=============================================
+  * @Fn				- MCAL_AFIO_DeInit
+  * @brief 			- Releases the reference taken by MCAL_AFIO_Init
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The EXTI routing keeps working with the AFIO clock gated, only its registers need the clock
+  */
+void MCAL_AFIO_DeInit(void){
+	MCAL_RCC_Release_Peripheral(RCC_AFIO);
+}
+
+/**=============================================
+  * @Fn				- MCAL_AFIO_Set_EXTI_Source
+  * @brief 			- Selects which GPIO port drives an EXTI line
+  * @param [in] 	- line: EXTI line number (0...15), equal to the pin number
+  * @param [in] 	- GPIOx: Port of the source pin, where x can be (A..G depending on device used)
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Only one port can be connected to a line, the last call wins
+  */
+void MCAL_AFIO_Set_EXTI_Source(uint8 line, GPIO_TypeDef* GPIOx){
+	/* Ports are laid out back to back, so the port code is its index from GPIOA */
+	uint32 port_code = ((uint32)GPIOx - GPIOA_BASE) / AFIO_GPIO_PORT_OFFSET;
+	uint8 shift = (line % 4) * 4;
+
+	if(line < 16){
+		AFIO->EXTICR[line / 4] &= ~(AFIO_EXTICR_MASK << shift);
+		AFIO->EXTICR[line / 4] |= ((port_code & AFIO_EXTICR_MASK) << shift);
+	}
+	else{ /* Do Nothing */ }
+}
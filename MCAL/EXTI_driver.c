@@ -0,0 +1,175 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : EXTI_driver.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "EXTI_driver.h"
+
+/* Line groups sharing one IRQ */
+#define EXTI9_5_LINES		((uint16)0x03E0)
+#define EXTI15_10_LINES		((uint16)0xFC00)
+
+/* Variables */
+static void (*GP_IRQ_CallBack[EXTI_LINES_COUNT])(void);
+
+static const uint8 EXTI_IRQ_Numbers[EXTI_LINES_COUNT] = {
+		EXTI0_IRQ,  EXTI1_IRQ,  EXTI2_IRQ,  EXTI3_IRQ,
+		EXTI4_IRQ,  EXTI5_IRQ,  EXTI6_IRQ,  EXTI7_IRQ,
+		EXTI8_IRQ,  EXTI9_IRQ,  EXTI10_IRQ, EXTI11_IRQ,
+		EXTI12_IRQ, EXTI13_IRQ, EXTI14_IRQ, EXTI15_IRQ
+};
+
+/* Clears the pending lines of a group then calls their callbacks */
+static void EXTI_Dispatch(uint16 group){
+	uint8 line;
+	uint16 pending = (uint16)(EXTI->PR & EXTI->IMR & group);
+
+	EXTI->PR = pending;
+
+	for(line = 0; pending != 0; line++, pending >>= 1){
+		if((pending & 1) && (NULL != GP_IRQ_CallBack[line])){
+			GP_IRQ_CallBack[line]();
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+/**=============================================
+  * @Fn				- MCAL_EXTI_Init
+  * @brief 			- Connects a GPIO pin to its EXTI line and configures the line
+  * @param [in] 	- EXTI_cfg: Pointer to the line configuration
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The pin mode is not changed, the GPIO must be configured as input by the caller
+  */
+void MCAL_EXTI_Init(EXTI_PinConfig_t* EXTI_cfg){
+	uint32 line_mask = (1UL << EXTI_cfg->Line);
+
+	if(EXTI_cfg->Line < EXTI_LINES_COUNT){
+		/* Mask the line while it is being reconfigured */
+		EXTI->IMR &= ~line_mask;
+
+		/* Route the pin to the line, AFIO is only clocked while it is written */
+		MCAL_AFIO_Init();
+		MCAL_AFIO_Set_EXTI_Source(EXTI_cfg->Line, EXTI_cfg->GPIO_Port);
+		MCAL_AFIO_DeInit();
+
+		/* Select the trigger edges */
+		EXTI->RTSR &= ~line_mask;
+		EXTI->FTSR &= ~line_mask;
+		if(EXTI_cfg->Trigger & EXTI_TRIGGER_RISING){
+			EXTI->RTSR |= line_mask;
+		}
+		else{ /* Do Nothing */ }
+		if(EXTI_cfg->Trigger & EXTI_TRIGGER_FALLING){
+			EXTI->FTSR |= line_mask;
+		}
+		else{ /* Do Nothing */ }
+
+		GP_IRQ_CallBack[EXTI_cfg->Line] = EXTI_cfg->P_IRQ_CallBack;
+
+		/* Drop any edge seen before the line was configured */
+		EXTI->PR = line_mask;
+
+		if(EXTI_IRQ_ENABLE == EXTI_cfg->IRQ_EN){
+			EXTI->IMR |= line_mask;
+			MCAL_NVIC_EnableIRQ(EXTI_IRQ_Numbers[EXTI_cfg->Line]);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_EXTI_DeInit
+  * @brief 			- Resets all EXTI lines and disables their interrupts
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_EXTI_DeInit(void){
+	EXTI->IMR = 0x00000000;
+	EXTI->EMR = 0x00000000;
+	EXTI->RTSR = 0x00000000;
+	EXTI->FTSR = 0x00000000;
+	EXTI->SWIER = 0x00000000;
+	EXTI->PR = 0xFFFFFFFF; // Cleared by writing 1
+
+	MCAL_NVIC_DisableIRQ(EXTI0_IRQ);
+	MCAL_NVIC_DisableIRQ(EXTI1_IRQ);
+	MCAL_NVIC_DisableIRQ(EXTI2_IRQ);
+	MCAL_NVIC_DisableIRQ(EXTI3_IRQ);
+	MCAL_NVIC_DisableIRQ(EXTI4_IRQ);
+	MCAL_NVIC_DisableIRQ(EXTI5_IRQ);
+	MCAL_NVIC_DisableIRQ(EXTI10_IRQ);
+}
+
+/**=============================================
+  * @Fn				- MCAL_EXTI_Enable_Lines
+  * @brief 			- Unmasks the interrupt of one or more lines
+  * @param [in] 	- lines: Bit mask of lines, values of @ref GPIO_PINS_define can be combined
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_EXTI_Enable_Lines(uint16 lines){
+	EXTI->IMR |= lines;
+}
+
+/**=============================================
+  * @Fn				- MCAL_EXTI_Disable_Lines
+  * @brief 			- Masks the interrupt of one or more lines
+  * @param [in] 	- lines: Bit mask of lines, values of @ref GPIO_PINS_define can be combined
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_EXTI_Disable_Lines(uint16 lines){
+	EXTI->IMR &= ~((uint32)lines);
+}
+
+/**=============================================
+  * @Fn				- MCAL_EXTI_Clear_Pending
+  * @brief 			- Clears the pending flag of one or more lines
+  * @param [in] 	- lines: Bit mask of lines, values of @ref GPIO_PINS_define can be combined
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_EXTI_Clear_Pending(uint16 lines){
+	EXTI->PR = lines;
+}
+
+/* ISRs */
+void EXTI0_IRQHandler(void){
+	EXTI_Dispatch((uint16)(1U<<0));
+}
+
+void EXTI1_IRQHandler(void){
+	EXTI_Dispatch((uint16)(1U<<1));
+}
+
+void EXTI2_IRQHandler(void){
+	EXTI_Dispatch((uint16)(1U<<2));
+}
+
+void EXTI3_IRQHandler(void){
+	EXTI_Dispatch((uint16)(1U<<3));
+}
+
+void EXTI4_IRQHandler(void){
+	EXTI_Dispatch((uint16)(1U<<4));
+}
+
+void EXTI9_5_IRQHandler(void){
+	EXTI_Dispatch(EXTI9_5_LINES);
+}
+
+void EXTI15_10_IRQHandler(void){
+	EXTI_Dispatch(EXTI15_10_LINES);
+}
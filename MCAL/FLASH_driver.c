@@ -0,0 +1,142 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : FLASH_driver.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "FLASH_driver.h"
+
+#define FLASH_KEY1				0x45670123UL
+#define FLASH_KEY2				0xCDEF89ABUL
+
+#define FLASH_SR_BSY			(1UL<<0)
+#define FLASH_SR_PGERR			(1UL<<2)	// Programming a half-word that is not erased
+#define FLASH_SR_WRPRTERR		(1UL<<4)	// Write protected page
+#define FLASH_SR_EOP			(1UL<<5)
+
+#define FLASH_CR_PG				(1UL<<0)
+#define FLASH_CR_PER			(1UL<<1)
+#define FLASH_CR_STRT			(1UL<<6)
+#define FLASH_CR_LOCK			(1UL<<7)
+
+static uint8 FLASH_HSI_Was_On;
+
+/* Waits for the operation to end, clears its flags and reports any error */
+static uint8 FLASH_Wait_Operation(void){
+	uint32 status;
+
+	while(FLASH->SR & FLASH_SR_BSY);
+	status = FLASH->SR;
+	FLASH->SR = FLASH_SR_EOP | FLASH_SR_PGERR | FLASH_SR_WRPRTERR;	// Cleared by writing 1
+
+	return (status & (FLASH_SR_PGERR | FLASH_SR_WRPRTERR)) ? FLASH_ERROR : FLASH_OK;
+}
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Unlock
+  * @brief 			- Unlocks the program/erase controller and starts the HSI it needs
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Every unlock must be followed by MCAL_FLASH_Lock
+  */
+void MCAL_FLASH_Unlock(void){
+	/* The controller is clocked by the HSI whatever the system clock is */
+	FLASH_HSI_Was_On = MCAL_RCC_Enable_HSI();
+
+	if(FLASH->CR & FLASH_CR_LOCK){
+		FLASH->KEYR = FLASH_KEY1;
+		FLASH->KEYR = FLASH_KEY2;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Lock
+  * @brief 			- Locks the program/erase controller again
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The HSI is stopped again if it was off before MCAL_FLASH_Unlock
+  */
+void MCAL_FLASH_Lock(void){
+	FLASH->CR |= FLASH_CR_LOCK;
+
+	if(!FLASH_HSI_Was_On){
+		MCAL_RCC_Disable_HSI();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Erase_Page
+  * @brief 			- Erases the page containing an address, all its half-words read 0xFFFF after it
+  * @param [in] 	- address: Any address inside the page
+  * @param [out] 	- None
+  * @retval 		- FLASH_OK or FLASH_ERROR @ref FLASH_RETURN_define
+  * Note			- Takes about 20 ms, the core stalls on any flash fetch meanwhile (interrupts included)
+  */
+uint8 MCAL_FLASH_Erase_Page(uint32 address){
+	uint8 return_value;
+	uint32 offset;
+
+	while(FLASH->SR & FLASH_SR_BSY);
+	FLASH->CR |= FLASH_CR_PER;
+	FLASH->AR = address;
+	FLASH->CR |= FLASH_CR_STRT;
+	return_value = FLASH_Wait_Operation();
+	FLASH->CR &= ~FLASH_CR_PER;
+
+	/* An erase cut by a reset may leave bits programmed, check the whole page */
+	address &= ~(FLASH_PAGE_SIZE - 1);
+	for(offset = 0; (FLASH_OK == return_value) && (offset < FLASH_PAGE_SIZE); offset += 2){
+		if(FLASH_ERASED_HALFWORD != MCAL_FLASH_Read_HalfWord(address + offset)){
+			return_value = FLASH_ERROR;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	return return_value;
+}
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Program_HalfWord
+  * @brief 			- Programs one half-word
+  * @param [in] 	- address: Half-word aligned address
+  * @param [in] 	- data: Value to program
+  * @param [out] 	- None
+  * @retval 		- FLASH_OK or FLASH_ERROR @ref FLASH_RETURN_define
+  * Note			- The half-word must be erased, only 0x0000 can be written over a programmed value
+  */
+uint8 MCAL_FLASH_Program_HalfWord(uint32 address, uint16 data){
+	uint8 return_value;
+
+	while(FLASH->SR & FLASH_SR_BSY);
+	FLASH->CR |= FLASH_CR_PG;
+	*((vuint16_t*)address) = data;
+	return_value = FLASH_Wait_Operation();
+	FLASH->CR &= ~FLASH_CR_PG;
+
+	/* A value that did not stick is reported too */
+	if((FLASH_OK == return_value) && (data != MCAL_FLASH_Read_HalfWord(address))){
+		return_value = FLASH_ERROR;
+	}
+	else{ /* Do Nothing */ }
+
+	return return_value;
+}
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Read_HalfWord
+  * @brief 			- Reads one half-word of the flash memory
+  * @param [in] 	- address: Half-word aligned address
+  * @param [out] 	- None
+  * @retval 		- Value at the address
+  * Note			- None
+  */
+uint16 MCAL_FLASH_Read_HalfWord(uint32 address){
+	return *((const vuint16_t*)address);
+}
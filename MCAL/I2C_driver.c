@@ -0,0 +1,384 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : I2C_driver.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "I2C_driver.h"
+
+/* Nothing to build without free I2C pins, see I2C_DRIVER_ENABLE */
+#if I2C_DRIVER_ENABLE
+
+#define I2C_CCR_FS				(1UL<<15)	// Fast mode, Tlow/Thigh = 2
+#define I2C_CCR_STANDARD_MIN	4UL
+#define I2C_SR1_ERRORS			(I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR)
+#define I2C_CR2_IRQS			(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN)
+
+/* Timed on the TIM2 count, Timer2_Elapsed_us only spans one period */
+#if (I2C_STOP_TIMEOUT_US >= 50000UL) || (I2C_BYTE_TIMEOUT_US >= 50000UL)
+#error "I2C timeouts must stay below one TIM2 period (50 ms)"
+#endif
+
+/* Transfer being run by the interrupts of each instance */
+typedef struct{
+	uint32					ClockSpeed;	// 0 if the instance is not initialized
+	const I2C_Transfer_t*	Transfer;
+	volatile uint16			Index;		// Next byte of the current direction
+	uint8					Receiving;
+	uint8					Restart;	// Repeated start requested, the events wait for SB
+	volatile uint8			Status;
+}I2C_State_t;
+
+/* Variables */
+static I2C_State_t I2C_States[2];
+
+/* Index of an I2C instance in I2C_States, 2 if unknown */
+static uint8 I2C_Get_Index(I2C_TypeDef* I2Cx){
+	return (I2C1 == I2Cx) ? 0 : ((I2C2 == I2Cx) ? 1 : 2);
+}
+
+/* Sets FREQ, CCR and TRISE from the current PCLK1, they can only be written with the peripheral disabled */
+static void I2C_Set_Timing(I2C_TypeDef* I2Cx, uint32 speed){
+	RCC_ClockTree_t tree;
+	uint32 freq_mhz, ccr;
+
+	MCAL_RCC_Get_Clock_Tree(&tree);
+	freq_mhz = tree.PCLK1 / 1000000UL;
+
+	I2Cx->CR1 &= ~I2C_CR1_PE;
+	I2Cx->CR2 = (I2Cx->CR2 & ~I2C_CR2_FREQ) | freq_mhz;
+	if(speed > I2C_SPEED_STANDARD){
+		ccr = tree.PCLK1 / (3 * speed);
+		I2Cx->CCR = ((ccr > 0) ? ccr : 1) | I2C_CCR_FS;
+		I2Cx->TRISE = ((freq_mhz * 300UL) / 1000UL) + 1;	// 300 ns maximum rise time
+	}
+	else{
+		ccr = tree.PCLK1 / (2 * speed);
+		I2Cx->CCR = (ccr > I2C_CCR_STANDARD_MIN) ? ccr : I2C_CCR_STANDARD_MIN;
+		I2Cx->TRISE = freq_mhz + 1;							// 1000 ns maximum rise time
+	}
+	I2Cx->CR1 |= I2C_CR1_PE;
+}
+
+/* Ends the transfer, the interrupts stay off until the next one */
+static void I2C_Finish(I2C_TypeDef* I2Cx, I2C_State_t* state, uint8 status){
+	I2Cx->CR2 &= ~I2C_CR2_IRQS;
+	I2Cx->CR1 &= ~I2C_CR1_POS;
+	state->Status = status;
+}
+
+/* Clock change callback, a running transfer cannot survive the peripheral being disabled */
+static void I2C_Clock_CallBack(void){
+	if(I2C_States[0].ClockSpeed > 0){
+		if(I2C_STATUS_BUSY == I2C_States[0].Status){
+			I2C_Finish(I2C1, &I2C_States[0], I2C_STATUS_ERROR);
+		}
+		else{ /* Do Nothing */ }
+		I2C_Set_Timing(I2C1, I2C_States[0].ClockSpeed);
+	}
+	else{ /* Do Nothing */ }
+	if(I2C_States[1].ClockSpeed > 0){
+		if(I2C_STATUS_BUSY == I2C_States[1].Status){
+			I2C_Finish(I2C2, &I2C_States[1], I2C_STATUS_ERROR);
+		}
+		else{ /* Do Nothing */ }
+		I2C_Set_Timing(I2C2, I2C_States[1].ClockSpeed);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Receiver side of the event interrupt, the last 3 bytes are read on BTF so the NACK and STOP land on time
+ * The bytes before are read one per event, a late interrupt also sees BTF and must not take it for the end */
+static void I2C_Receive_Event(I2C_TypeDef* I2Cx, I2C_State_t* state, uint32 sr1){
+	const I2C_Transfer_t* transfer = state->Transfer;
+	uint16 remaining = transfer->RX_Length - state->Index;
+
+	if((sr1 & I2C_SR1_BTF) && (3 == remaining)){
+		/* N-2 in DR and N-1 in the shift register, N gets the NACK */
+		I2Cx->CR1 &= ~I2C_CR1_ACK;
+		transfer->RX[state->Index++] = (uint8)I2Cx->DR;
+	}
+	else if((sr1 & I2C_SR1_BTF) && (2 == remaining)){
+		/* N-1 in DR and N in the shift register */
+		I2Cx->CR1 |= I2C_CR1_STOP;
+		transfer->RX[state->Index++] = (uint8)I2Cx->DR;
+		transfer->RX[state->Index++] = (uint8)I2Cx->DR;
+		I2C_Finish(I2Cx, state, I2C_STATUS_DONE);
+	}
+	else if((sr1 & I2C_SR1_RXNE) && ((remaining > 3) || (1 == remaining))){
+		transfer->RX[state->Index++] = (uint8)I2Cx->DR;
+		remaining--;
+		if(0 == remaining){
+			I2C_Finish(I2Cx, state, I2C_STATUS_DONE);
+		}
+		else if(3 == remaining){
+			I2Cx->CR2 &= ~I2C_CR2_ITBUFEN;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Event interrupt state machine (start, address, data), master mode only */
+static void I2C_Event(I2C_TypeDef* I2Cx, I2C_State_t* state){
+	const I2C_Transfer_t* transfer = state->Transfer;
+	uint32 sr1 = I2Cx->SR1;
+
+	if(sr1 & I2C_SR1_SB){
+		state->Restart = 0;
+		I2Cx->DR = (uint32)(transfer->Address << 1) | state->Receiving;
+	}
+	else if(state->Restart){
+		/* TXE and BTF of the last byte sent stay set until the repeated start is on the wire */
+	}
+	else if(sr1 & I2C_SR1_ADDR){
+		if(!state->Receiving){
+			(void)I2Cx->SR2;	// Reading SR2 after SR1 clears ADDR
+			if((0 == transfer->TX_Length) && (0 == transfer->RX_Length)){
+				/* Address acknowledged, nothing else to do */
+				I2Cx->CR1 |= I2C_CR1_STOP;
+				I2C_Finish(I2Cx, state, I2C_STATUS_DONE);
+			}
+			else{ /* Do Nothing */ }
+		}
+		else if(1 == transfer->RX_Length){
+			/* The NACK and STOP must be set before ADDR is cleared */
+			I2Cx->CR1 &= ~I2C_CR1_ACK;
+			(void)I2Cx->SR2;
+			I2Cx->CR1 |= I2C_CR1_STOP;
+		}
+		else if(2 == transfer->RX_Length){
+			/* POS moves the NACK to the second byte, both are read on BTF */
+			I2Cx->CR1 &= ~I2C_CR1_ACK;
+			I2Cx->CR1 |= I2C_CR1_POS;
+			(void)I2Cx->SR2;
+			I2Cx->CR2 &= ~I2C_CR2_ITBUFEN;
+		}
+		else{
+			I2Cx->CR1 |= I2C_CR1_ACK;
+			(void)I2Cx->SR2;
+			if(3 == transfer->RX_Length){
+				I2Cx->CR2 &= ~I2C_CR2_ITBUFEN;
+			}
+			else{ /* Do Nothing */ }
+		}
+	}
+	else if(state->Receiving){
+		I2C_Receive_Event(I2Cx, state, sr1);
+	}
+	else if((sr1 & I2C_SR1_TXE) && (state->Index < transfer->TX_Length)){
+		I2Cx->DR = transfer->TX[state->Index++];
+		if(state->Index == transfer->TX_Length){
+			/* Only BTF is awaited now, TXE would keep firing */
+			I2Cx->CR2 &= ~I2C_CR2_ITBUFEN;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(sr1 & I2C_SR1_BTF){
+		/* Last byte sent */
+		if(transfer->RX_Length > 0){
+			state->Receiving = 1;
+			state->Restart = 1;
+			state->Index = 0;
+			I2Cx->CR2 |= I2C_CR2_ITBUFEN;
+			I2Cx->CR1 |= I2C_CR1_START;
+		}
+		else{
+			I2Cx->CR1 |= I2C_CR1_STOP;
+			I2C_Finish(I2Cx, state, I2C_STATUS_DONE);
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Error interrupt, a NACK still needs the STOP from the master, arbitration loss releases the bus by itself */
+static void I2C_Error(I2C_TypeDef* I2Cx, I2C_State_t* state){
+	uint32 sr1 = I2Cx->SR1;
+
+	I2Cx->SR1 = ~(sr1 & I2C_SR1_ERRORS) & 0xFFFFUL;	// rc_w0 flags
+	if(sr1 & I2C_SR1_AF){
+		I2Cx->CR1 |= I2C_CR1_STOP;
+		I2C_Finish(I2Cx, state, I2C_STATUS_NACK);
+	}
+	else if(sr1 & I2C_SR1_ERRORS){
+		I2C_Finish(I2Cx, state, I2C_STATUS_ERROR);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_I2C_Init
+  * @brief 			- Initializes an I2C peripheral as the bus master
+  * @param [in] 	- I2Cx: Pointer to the I2C peripheral instance, where x can be (1..2)
+  * @param [in] 	- I2C_cfg: Pointer to the I2C configuration
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- I2C1 uses PB6 SCL / PB7 SDA and I2C2 uses PB10 SCL / PB11 SDA
+  * 				  The timing is derived from PCLK1 and follows the clock changes
+  * 				  The transfers are timed on the TIM2 count, Timer2_init must have run
+  */
+void MCAL_I2C_Init(I2C_TypeDef* I2Cx, I2C_cfg_t* I2C_cfg){
+	uint8 index = I2C_Get_Index(I2Cx);
+
+	if(index < 2){
+		MCAL_RCC_Acquire_Peripheral((0 == index) ? RCC_I2C1 : RCC_I2C2);
+		MCAL_RCC_Acquire_Peripheral(RCC_GPIOB);
+
+		/* Open drain, the pull-ups are on the bus */
+		MCAL_GPIO_InitMask(GPIOB, (0 == index) ? (GPIO_PIN_6 | GPIO_PIN_7) : (GPIO_PIN_10 | GPIO_PIN_11),
+				GPIO_MODE_OUTPUT_AF_OD, GPIO_SPEED_10M);
+
+		I2C_States[index].ClockSpeed = I2C_cfg->ClockSpeed;
+		I2C_States[index].Status = I2C_STATUS_IDLE;
+		I2C_Set_Timing(I2Cx, I2C_cfg->ClockSpeed);
+		MCAL_RCC_Add_Clock_CallBack(I2C_Clock_CallBack);
+
+		MCAL_NVIC_EnableIRQ((0 == index) ? I2C1_EV_IRQ : I2C2_EV_IRQ);
+		MCAL_NVIC_EnableIRQ((0 == index) ? I2C1_ER_IRQ : I2C2_ER_IRQ);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_I2C_DeInit
+  * @brief 			- Resets the I2C peripheral and releases its clocks
+  * @param [in] 	- I2Cx: Pointer to the I2C peripheral instance, where x can be (1..2)
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_I2C_DeInit(I2C_TypeDef* I2Cx){
+	uint8 index = I2C_Get_Index(I2Cx);
+
+	if(index < 2){
+		MCAL_NVIC_DisableIRQ((0 == index) ? I2C1_EV_IRQ : I2C2_EV_IRQ);
+		MCAL_NVIC_DisableIRQ((0 == index) ? I2C1_ER_IRQ : I2C2_ER_IRQ);
+		MCAL_RCC_Reset_Peripheral((0 == index) ? RCC_I2C1 : RCC_I2C2);
+		MCAL_RCC_Release_Peripheral((0 == index) ? RCC_I2C1 : RCC_I2C2);
+		MCAL_RCC_Release_Peripheral(RCC_GPIOB);
+		I2C_States[index].ClockSpeed = 0;
+		I2C_States[index].Status = I2C_STATUS_IDLE;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_I2C_Start_Transfer
+  * @brief 			- Starts a transfer, the interrupts run it to its end
+  * @param [in] 	- I2Cx: Pointer to the I2C peripheral instance, where x can be (1..2)
+  * @param [in] 	- transfer: Pointer to the transfer, it and its buffers must stay valid until it ends
+  * @param [out] 	- None
+  * @retval 		- 1 if started, 0 if a transfer is running or the bus stays held for I2C_STOP_TIMEOUT_US
+  * Note			- Follow it with MCAL_I2C_Get_Status
+  * 				  Waits for the STOP of the previous transfer, it is still on the wire when its status is set
+  */
+uint8 MCAL_I2C_Start_Transfer(I2C_TypeDef* I2Cx, const I2C_Transfer_t* transfer){
+	uint8 index = I2C_Get_Index(I2Cx);
+	uint8 started = 0;
+	uint32 start;
+
+	if((index < 2) && (NULL != transfer) && (I2C_STATUS_BUSY != I2C_States[index].Status)){
+		/* The hardware clears STOP once the stop condition is sent and BUSY once it is seen on the bus */
+		start = Timer2_Get_us();
+		while(((I2Cx->CR1 & I2C_CR1_STOP) || (I2Cx->SR2 & I2C_SR2_BUSY)) && (Timer2_Elapsed_us(start) < I2C_STOP_TIMEOUT_US));
+
+		if(!(I2Cx->CR1 & I2C_CR1_STOP) && !(I2Cx->SR2 & I2C_SR2_BUSY)){
+			I2C_States[index].Transfer = transfer;
+			I2C_States[index].Index = 0;
+			I2C_States[index].Receiving = ((0 == transfer->TX_Length) && (transfer->RX_Length > 0)) ? 1 : 0;
+			I2C_States[index].Restart = 0;
+			I2C_States[index].Status = I2C_STATUS_BUSY;
+
+			I2Cx->CR1 &= ~I2C_CR1_POS;
+			I2Cx->CR1 |= I2C_CR1_ACK;
+			I2Cx->CR2 |= I2C_CR2_IRQS;
+			I2Cx->CR1 |= I2C_CR1_START;
+			started = 1;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+
+	return started;
+}
+
+/**=============================================
+  * @Fn				- MCAL_I2C_Get_Status
+  * @brief 			- Returns the state of the last transfer
+  * @param [in] 	- I2Cx: Pointer to the I2C peripheral instance, where x can be (1..2)
+  * @param [out] 	- None
+  * @retval 		- Transfer status @ref I2C_STATUS_define
+  * Note			- None
+  */
+uint8 MCAL_I2C_Get_Status(I2C_TypeDef* I2Cx){
+	uint8 index = I2C_Get_Index(I2Cx);
+
+	return (index < 2) ? I2C_States[index].Status : I2C_STATUS_ERROR;
+}
+
+/**=============================================
+  * @Fn				- MCAL_I2C_Transfer
+  * @brief 			- Runs a transfer and waits for its end
+  * @param [in] 	- I2Cx: Pointer to the I2C peripheral instance, where x can be (1..2)
+  * @param [in] 	- transfer: Pointer to the transfer
+  * @param [out] 	- None
+  * @retval 		- I2C_STATUS_DONE, I2C_STATUS_NACK or I2C_STATUS_ERROR @ref I2C_STATUS_define
+  * Note			- Main context only, the bytes are still moved by the interrupts
+  * 				  I2C_STATUS_ERROR after I2C_BYTE_TIMEOUT_US without a byte moved, the transfer is then stopped
+  */
+uint8 MCAL_I2C_Transfer(I2C_TypeDef* I2Cx, const I2C_Transfer_t* transfer){
+	uint8 index = I2C_Get_Index(I2Cx);
+	uint8 status = I2C_STATUS_ERROR;
+	uint16 moved = 0;
+	uint32 since, primask;
+
+	if(MCAL_I2C_Start_Transfer(I2Cx, transfer)){
+		/* Every byte moved restarts the timeout, a long read only fails if the bus stalls */
+		since = Timer2_Get_us();
+		while((I2C_STATUS_BUSY == (status = MCAL_I2C_Get_Status(I2Cx))) && (Timer2_Elapsed_us(since) < I2C_BYTE_TIMEOUT_US)){
+			if(moved != I2C_States[index].Index){
+				moved = I2C_States[index].Index;
+				since = Timer2_Get_us();
+			}
+			else{ /* Do Nothing */ }
+		}
+
+		if(I2C_STATUS_BUSY == status){
+			/* Slave holding SCL or a lost interrupt, the interrupt may still end the transfer meanwhile */
+			primask = MCAL_NVIC_Disable_Global_IRQ();
+			if(I2C_STATUS_BUSY == I2C_States[index].Status){
+				I2Cx->CR1 |= I2C_CR1_STOP;
+				I2C_Finish(I2Cx, &I2C_States[index], I2C_STATUS_ERROR);
+			}
+			else{ /* Do Nothing */ }
+			MCAL_NVIC_Restore_Global_IRQ(primask);
+			status = I2C_States[index].Status;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+
+	return status;
+}
+
+/* ISRs */
+void I2C1_EV_IRQHandler(void){
+	I2C_Event(I2C1, &I2C_States[0]);
+}
+
+void I2C1_ER_IRQHandler(void){
+	I2C_Error(I2C1, &I2C_States[0]);
+}
+
+void I2C2_EV_IRQHandler(void){
+	I2C_Event(I2C2, &I2C_States[1]);
+}
+
+void I2C2_ER_IRQHandler(void){
+	I2C_Error(I2C2, &I2C_States[1]);
+}
+
+#endif /* I2C_DRIVER_ENABLE */
@@ -0,0 +1,62 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : AFIO_driver.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_AFIO_DRIVER_H_
+#define INC_AFIO_DRIVER_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <STM32F103x8.h>
+#include "RCC_driver.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+#define AFIO_GPIO_PORT_OFFSET	0x400UL // Distance between two GPIO ports base addresses
+#define AFIO_EXTICR_MASK		0xFUL
+
+/*
+ * =============================================
+ * APIs Supported by "AFIO"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- MCAL_AFIO_Init
+  * @brief 			- Takes a reference on the clock of the AFIO peripheral
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Must be called before any AFIO register is written
+  */
+void MCAL_AFIO_Init(void);
+
+/**=============================================
+  * @Fn				- MCAL_AFIO_DeInit
+  * @brief 			- Releases the reference taken by MCAL_AFIO_Init
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The EXTI routing keeps working with the AFIO clock gated, only its registers need the clock
+  */
+void MCAL_AFIO_DeInit(void);
+
+/**=============================================
+  * @Fn				- MCAL_AFIO_Set_EXTI_Source
+  * @brief 			- Selects which GPIO port drives an EXTI line
+  * @param [in] 	- line: EXTI line number (0...15), equal to the pin number
+  * @param [in] 	- GPIOx: Port of the source pin, where x can be (A..G depending on device used)
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Only one port can be connected to a line, the last call wins
+  */
+void MCAL_AFIO_Set_EXTI_Source(uint8 line, GPIO_TypeDef* GPIOx);
+
+#endif /* INC_AFIO_DRIVER_H_ */
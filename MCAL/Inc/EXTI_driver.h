@@ -0,0 +1,102 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : EXTI_driver.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_EXTI_DRIVER_H_
+#define INC_EXTI_DRIVER_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <STM32F103x8.h>
+#include "AFIO_driver.h"
+#include "NVIC_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	GPIO_TypeDef*	GPIO_Port;		// Port of the pin connected to the line
+	uint8			Line;			// EXTI line number (0...15), equal to the pin number
+	uint8			Trigger;		// Specifies the edges that trigger the line
+									// this parameter must be set based on @ref EXTI_Trigger_define
+	uint8			IRQ_EN;			// Enable or Disable the line interrupt @ref EXTI_IRQ_define
+	void (*P_IRQ_CallBack)(void);	// Set the C Function() which will be called once the IRQ happen
+}EXTI_PinConfig_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+#define EXTI_LINES_COUNT		16
+
+// @ref EXTI_Trigger_define
+#define EXTI_TRIGGER_RISING		(uint8)0x01
+#define EXTI_TRIGGER_FALLING	(uint8)0x02
+#define EXTI_TRIGGER_BOTH		(uint8)0x03
+
+// @ref EXTI_IRQ_define
+#define EXTI_IRQ_DISABLE		(uint8)0x00
+#define EXTI_IRQ_ENABLE			(uint8)0x01
+
+/*
+ * =============================================
+ * APIs Supported by "EXTI"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- MCAL_EXTI_Init
+  * @brief 			- Connects a GPIO pin to its EXTI line and configures the line
+  * @param [in] 	- EXTI_cfg: Pointer to the line configuration
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The pin mode is not changed, the GPIO must be configured as input by the caller
+  */
+void MCAL_EXTI_Init(EXTI_PinConfig_t* EXTI_cfg);
+
+/**=============================================
+  * @Fn				- MCAL_EXTI_DeInit
+  * @brief 			- Resets all EXTI lines and disables their interrupts
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_EXTI_DeInit(void);
+
+/**=============================================
+  * @Fn				- MCAL_EXTI_Enable_Lines
+  * @brief 			- Unmasks the interrupt of one or more lines
+  * @param [in] 	- lines: Bit mask of lines, values of @ref GPIO_PINS_define can be combined
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_EXTI_Enable_Lines(uint16 lines);
+
+/**=============================================
+  * @Fn				- MCAL_EXTI_Disable_Lines
+  * @brief 			- Masks the interrupt of one or more lines
+  * @param [in] 	- lines: Bit mask of lines, values of @ref GPIO_PINS_define can be combined
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_EXTI_Disable_Lines(uint16 lines);
+
+/**=============================================
+  * @Fn				- MCAL_EXTI_Clear_Pending
+  * @brief 			- Clears the pending flag of one or more lines
+  * @param [in] 	- lines: Bit mask of lines, values of @ref GPIO_PINS_define can be combined
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_EXTI_Clear_Pending(uint16 lines);
+
+#endif /* INC_EXTI_DRIVER_H_ */
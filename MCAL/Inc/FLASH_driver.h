@@ -0,0 +1,88 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : FLASH_driver.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_FLASH_DRIVER_H_
+#define INC_FLASH_DRIVER_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <STM32F103x8.h>
+#include "RCC_driver.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+#define FLASH_PAGE_SIZE			1024UL	// Low and medium density devices
+#define FLASH_MEMORY_SIZE		(64UL * 1024UL)	// STM32F103C8
+
+// @ref FLASH_RETURN_define
+#define FLASH_OK				1
+#define FLASH_ERROR				0
+
+#define FLASH_ERASED_HALFWORD	0xFFFFU
+
+/*
+ * =============================================
+ * APIs Supported by "FLASH"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Unlock
+  * @brief 			- Unlocks the program/erase controller and starts the HSI it needs
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Every unlock must be followed by MCAL_FLASH_Lock
+  */
+void MCAL_FLASH_Unlock(void);
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Lock
+  * @brief 			- Locks the program/erase controller again
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The HSI is stopped again if it was off before MCAL_FLASH_Unlock
+  */
+void MCAL_FLASH_Lock(void);
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Erase_Page
+  * @brief 			- Erases the page containing an address, all its half-words read 0xFFFF after it
+  * @param [in] 	- address: Any address inside the page
+  * @param [out] 	- None
+  * @retval 		- FLASH_OK or FLASH_ERROR @ref FLASH_RETURN_define
+  * Note			- Takes about 20 ms, the core stalls on any flash fetch meanwhile (interrupts included)
+  */
+uint8 MCAL_FLASH_Erase_Page(uint32 address);
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Program_HalfWord
+  * @brief 			- Programs one half-word
+  * @param [in] 	- address: Half-word aligned address
+  * @param [in] 	- data: Value to program
+  * @param [out] 	- None
+  * @retval 		- FLASH_OK or FLASH_ERROR @ref FLASH_RETURN_define
+  * Note			- The half-word must be erased, only 0x0000 can be written over a programmed value
+  */
+uint8 MCAL_FLASH_Program_HalfWord(uint32 address, uint16 data);
+
+/**=============================================
+  * @Fn				- MCAL_FLASH_Read_HalfWord
+  * @brief 			- Reads one half-word of the flash memory
+  * @param [in] 	- address: Half-word aligned address
+  * @param [out] 	- None
+  * @retval 		- Value at the address
+  * Note			- None
+  */
+uint16 MCAL_FLASH_Read_HalfWord(uint32 address);
+
+#endif /* INC_FLASH_DRIVER_H_ */
@@ -0,0 +1,128 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : I2C_driver.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_I2C_DRIVER_H_
+#define INC_I2C_DRIVER_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <STM32F103x8.h>
+#include "gpio_driver.h"
+#include "RCC_driver.h"
+#include "NVIC_driver.h"
+#include "Timer.h"
+
+//----------------------------------------------
+// Section: User Configurations
+//----------------------------------------------
+
+/* The parking board has no free I2C pins: PB6/PB7 are keypad columns, the PB8/PB9
+ * remap drives the servos and PB10/PB11 are the admin LCD EN/RS. The driver is kept
+ * for the host tests and builds to nothing in the firmware unless this is set to 1 */
+#ifndef I2C_DRIVER_ENABLE
+#define I2C_DRIVER_ENABLE		0
+#endif
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint32	ClockSpeed;		// SCL frequency @ref I2C_SPEED_define
+}I2C_cfg_t;
+
+typedef struct{
+	uint8			Address;	// 7-bit slave address
+	const uint8*	TX;			// Bytes written first
+	uint16			TX_Length;
+	uint8*			RX;			// Bytes read after a repeated start (or after the start if TX_Length is 0)
+	uint16			RX_Length;	// Both lengths 0 only checks that the slave acknowledges its address
+}I2C_Transfer_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref I2C_SPEED_define
+#define I2C_SPEED_STANDARD		100000UL
+#define I2C_SPEED_FAST			400000UL
+
+// @ref I2C_STATUS_define
+#define I2C_STATUS_IDLE			0
+#define I2C_STATUS_BUSY			1
+#define I2C_STATUS_DONE			2
+#define I2C_STATUS_NACK			3		// The slave did not acknowledge its address or a byte
+#define I2C_STATUS_ERROR		4		// Bus error, arbitration lost or timeout
+
+#define I2C_STOP_TIMEOUT_US		1000UL	// A STOP takes a few bit times, longer means another master holds the bus
+#define I2C_BYTE_TIMEOUT_US		10000UL	// Longest wait for the next byte, covers the slave clock stretching
+
+/*
+ * =============================================
+ * APIs Supported by "I2C"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- MCAL_I2C_Init
+  * @brief 			- Initializes an I2C peripheral as the bus master
+  * @param [in] 	- I2Cx: Pointer to the I2C peripheral instance, where x can be (1..2)
+  * @param [in] 	- I2C_cfg: Pointer to the I2C configuration
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- I2C1 uses PB6 SCL / PB7 SDA and I2C2 uses PB10 SCL / PB11 SDA
+  * 				  The timing is derived from PCLK1 and follows the clock changes
+  * 				  The transfers are timed on the TIM2 count, Timer2_init must have run
+  */
+void MCAL_I2C_Init(I2C_TypeDef* I2Cx, I2C_cfg_t* I2C_cfg);
+
+/**=============================================
+  * @Fn				- MCAL_I2C_DeInit
+  * @brief 			- Resets the I2C peripheral and releases its clocks
+  * @param [in] 	- I2Cx: Pointer to the I2C peripheral instance, where x can be (1..2)
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_I2C_DeInit(I2C_TypeDef* I2Cx);
+
+/**=============================================
+  * @Fn				- MCAL_I2C_Start_Transfer
+  * @brief 			- Starts a transfer, the interrupts run it to its end
+  * @param [in] 	- I2Cx: Pointer to the I2C peripheral instance, where x can be (1..2)
+  * @param [in] 	- transfer: Pointer to the transfer, it and its buffers must stay valid until it ends
+  * @param [out] 	- None
+  * @retval 		- 1 if started, 0 if a transfer is running or the bus stays held for I2C_STOP_TIMEOUT_US
+  * Note			- Follow it with MCAL_I2C_Get_Status
+  * 				  Waits for the STOP of the previous transfer, it is still on the wire when its status is set
+  */
+uint8 MCAL_I2C_Start_Transfer(I2C_TypeDef* I2Cx, const I2C_Transfer_t* transfer);
+
+/**=============================================
+  * @Fn				- MCAL_I2C_Get_Status
+  * @brief 			- Returns the state of the last transfer
+  * @param [in] 	- I2Cx: Pointer to the I2C peripheral instance, where x can be (1..2)
+  * @param [out] 	- None
+  * @retval 		- Transfer status @ref I2C_STATUS_define
+  * Note			- None
+  */
+uint8 MCAL_I2C_Get_Status(I2C_TypeDef* I2Cx);
+
+/**=============================================
+  * @Fn				- MCAL_I2C_Transfer
+  * @brief 			- Runs a transfer and waits for its end
+  * @param [in] 	- I2Cx: Pointer to the I2C peripheral instance, where x can be (1..2)
+  * @param [in] 	- transfer: Pointer to the transfer
+  * @param [out] 	- None
+  * @retval 		- I2C_STATUS_DONE, I2C_STATUS_NACK or I2C_STATUS_ERROR @ref I2C_STATUS_define
+  * Note			- Main context only, the bytes are still moved by the interrupts
+  * 				  I2C_STATUS_ERROR after I2C_BYTE_TIMEOUT_US without a byte moved, the transfer is then stopped
+  */
+uint8 MCAL_I2C_Transfer(I2C_TypeDef* I2Cx, const I2C_Transfer_t* transfer);
+
+#endif /* INC_I2C_DRIVER_H_ */
@@ -40,7 +40,8 @@
 #define NVIC_PRIO_2GRP_8SUBGRP		0x600U
 #define NVIC_PRIO_0GRP_8SUBGRP		0x700U
 
-// @ref Interrupt_Priorities_define
+// @ref Interrupt_Priorities_define, lower value is more urgent
+#define NVIC_PRIO_MASK				0xF0U	// Only the upper 4 bits are implemented
 #define NVIC_PRIO_0000              0x00U
 #define NVIC_PRIO_0001              0x10U
 #define NVIC_PRIO_0010              0x20U
@@ -88,6 +89,42 @@
 #define I2C2_EV_IRQ	33
 #define I2C2_ER_IRQ	34
 
+#define TIM1_UP_IRQ	25
+#define TIM1_CC_IRQ	27
+#define TIM2_IRQ	28
+#define TIM3_IRQ	29
+#define TIM4_IRQ	30
+
+// @ref System_Exceptions_define, for MCAL_NVIC_SetSystemPriority
+#define NVIC_SVCALL_EXCEPTION		11
+#define NVIC_PENDSV_EXCEPTION		14
+#define NVIC_SYSTICK_EXCEPTION		15
+
+// Copy of the vector table in SRAM so the handlers can be installed at run time, 0 to keep the flash table
+#define NVIC_VECTOR_TABLE_IN_SRAM	1
+#define NVIC_IRQS_COUNT				43		// Medium density devices, up to the USB wakeup interrupt
+#define NVIC_VECTORS_COUNT			(16 + NVIC_IRQS_COUNT)	// Stack pointer and system exceptions first
+
+// Worst case masked time measured by the critical sections on the DWT cycle counter, 0 to remove the cost
+#define NVIC_CRITICAL_MEASURE		1
+
+/* Masks the interrupts whose priority value is level or higher (less or equally urgent) until CRITICAL_EXIT
+ * level is one of @ref Interrupt_Priorities_define except NVIC_PRIO_0000, both must be in the same block */
+#define CRITICAL_ENTER(level)		do{ uint32 Critical_Saved_BASEPRI = MCAL_NVIC_Critical_Enter(level)
+#define CRITICAL_EXIT()				MCAL_NVIC_Critical_Exit(Critical_Saved_BASEPRI); }while(0)
+
+/* Core registers and barriers used by the driver, the host tests replace them with their model */
+#define NVIC_GET_PRIMASK(value)		__asm volatile ("mrs %0, primask" : "=r" (value))
+#define NVIC_SET_PRIMASK(value)		__asm volatile ("msr primask, %0" :: "r" (value) : "memory")
+#define NVIC_DISABLE_IRQ()			__asm volatile ("cpsid i" ::: "memory")
+#define NVIC_GET_BASEPRI(value)		__asm volatile ("mrs %0, basepri" : "=r" (value))
+#define NVIC_RAISE_BASEPRI(value)	__asm volatile ("msr basepri_max, %0" :: "r" (value) : "memory")	// Written only if it masks more
+#define NVIC_SET_BASEPRI(value)		__asm volatile ("msr basepri, %0" :: "r" (value) : "memory")
+#define NVIC_DSB()					__asm volatile ("dsb" ::: "memory")
+#define NVIC_ISB()					__asm volatile ("isb" ::: "memory")
+#define NVIC_GET_VECTOR_TABLE()		((void (* const *)(void))SCB->VTOR)
+#define NVIC_SET_VECTOR_TABLE(table)	(SCB->VTOR = (uint32)(table))
+
 /*
  * =============================================
  * APIs Supported by "NVIC"
@@ -205,4 +242,129 @@ uint8 MCAL_NVIC_GetPriority(uint8 IRQn);
   */
 void MCAL_NVIC_SystemReset(void);
 
+/**=============================================
+  * @Fn				- MCAL_NVIC_Disable_Global_IRQ
+  * @brief 			- Masks all configurable interrupts (PRIMASK)
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Previous PRIMASK value, to be given to MCAL_NVIC_Restore_Global_IRQ
+  * Note			- Calls can be nested, only the outermost restore unmasks the interrupts
+  */
+uint32 MCAL_NVIC_Disable_Global_IRQ(void);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Restore_Global_IRQ
+  * @brief 			- Restores the interrupt mask saved by MCAL_NVIC_Disable_Global_IRQ
+  * @param [in] 	- primask: Value returned by MCAL_NVIC_Disable_Global_IRQ
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_NVIC_Restore_Global_IRQ(uint32 primask);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_SetSystemPriority
+  * @brief 			- Set priority for a Cortex-M3 system exception
+  * @param [in] 	- exception: Exception number @ref System_Exceptions_define
+  * @param [in] 	- priority: priority of the exception as defined in @ref Interrupt_Priorities_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- SysTick is in SHP[11], the system handlers start at exception 4
+  */
+void MCAL_NVIC_SetSystemPriority(uint8 exception, uint8 priority);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_GetSystemPriority
+  * @brief 			- Read priority of a Cortex-M3 system exception
+  * @param [in] 	- exception: Exception number @ref System_Exceptions_define
+  * @param [out] 	- None
+  * @retval 		- Priority value @ref Interrupt_Priorities_define, 0 for an exception with a fixed priority
+  * Note			- None
+  */
+uint8 MCAL_NVIC_GetSystemPriority(uint8 exception);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Critical_Enter
+  * @brief 			- Masks the interrupts with a priority value of level or higher (BASEPRI)
+  * @param [in] 	- level: Priority @ref Interrupt_Priorities_define, NVIC_PRIO_0000 does not mask anything
+  * @param [out] 	- None
+  * @retval 		- Previous BASEPRI value, to be given to MCAL_NVIC_Critical_Exit
+  * Note			- Only raises the mask, a nested section with a lower level keeps the outer one
+  * 				  Use CRITICAL_ENTER/CRITICAL_EXIT instead of calling it directly
+  */
+uint32 MCAL_NVIC_Critical_Enter(uint8 level);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Critical_Exit
+  * @brief 			- Restores the mask saved by MCAL_NVIC_Critical_Enter
+  * @param [in] 	- basepri: Value returned by MCAL_NVIC_Critical_Enter
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_NVIC_Critical_Exit(uint32 basepri);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Critical_Measure_Start
+  * @brief 			- Starts the DWT cycle counter and clears the worst case masked time
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Measures the critical sections and the MCAL_NVIC_Disable_Global_IRQ sections
+  * 				  Needs NVIC_CRITICAL_MEASURE, the counter is shared with any other DWT user
+  */
+void MCAL_NVIC_Critical_Measure_Start(void);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Critical_Get_Max_Cycles
+  * @brief 			- Returns the longest time the interrupts were masked
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Worst case in CPU cycles since MCAL_NVIC_Critical_Measure_Start, 0 if not measured
+  * Note			- Only the outermost section of nested ones is measured
+  */
+uint32 MCAL_NVIC_Critical_Get_Max_Cycles(void);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Relocate_Vector_Table
+  * @brief 			- Copies the active vector table to SRAM and points VTOR to the copy
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- 1 if the SRAM table is active, 0 if NVIC_VECTOR_TABLE_IN_SRAM is disabled
+  * Note			- Call it once at boot before any handler is installed, calling it again does nothing
+  */
+uint8 MCAL_NVIC_Relocate_Vector_Table(void);
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_SetHandler
+  * @brief 			- Installs the function called directly by the core on IRQn
+  * @param [in] 	- IRQn: Number of interrupt request as defined in vector table or in @ref Interrupt_Requests_Numbers_define
+  * @param [in] 	- handler: Function to install, must not be NULL
+  * @param [out] 	- None
+  * @retval 		- 1 if installed, 0 if the vector table is still in flash or the arguments are invalid
+  * Note			- The caller keeps its fixed IRQHandler for the 0 case
+  */
+uint8 MCAL_NVIC_SetHandler(uint8 IRQn, void (*handler)(void));
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_SetSystemHandler
+  * @brief 			- Installs the function called directly by the core on a system exception
+  * @param [in] 	- exception: Exception number @ref System_Exceptions_define
+  * @param [in] 	- handler: Function to install, must not be NULL
+  * @param [out] 	- None
+  * @retval 		- 1 if installed, 0 if the vector table is still in flash or the arguments are invalid
+  * Note			- None
+  */
+uint8 MCAL_NVIC_SetSystemHandler(uint8 exception, void (*handler)(void));
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_GetHandler
+  * @brief 			- Returns the function the core calls on IRQn
+  * @param [in] 	- IRQn: Number of interrupt request as defined in vector table or in @ref Interrupt_Requests_Numbers_define
+  * @param [out] 	- None
+  * @retval 		- Current vector, read from the active table, NULL if IRQn is invalid
+  * Note			- None
+  */
+void (*MCAL_NVIC_GetHandler(uint8 IRQn))(void);
+
 #endif /* INC_NVIC_DRIVER_H_ */
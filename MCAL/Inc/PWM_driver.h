@@ -0,0 +1,122 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : PWM_driver.h 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef INC_PWM_DRIVER_H_
+#define INC_PWM_DRIVER_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <STM32F103x8.h>
+#include "RCC_driver.h"
+#include "NVIC_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	uint32	Tick_Frequency;	// Counter frequency in HZ, the timer clock must be a multiple of it
+	uint16	Period;			// PWM period in counter ticks
+}PWM_cfg_t;
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+// @ref PWM_CHANNEL_define
+#define PWM_CHANNEL_1		(uint8)1
+#define PWM_CHANNEL_2		(uint8)2
+#define PWM_CHANNEL_3		(uint8)3
+#define PWM_CHANNEL_4		(uint8)4
+
+#define TIM_CR1_CEN			(1UL<<0)
+#define TIM_CR1_ARPE		(1UL<<7)
+#define TIM_EGR_UG			(1UL<<0)
+#define TIM_DIER_UIE		(1UL<<0)
+#define TIM_SR_UIF			(1UL<<0)
+#define TIM_CCMR_OC_PE		(1UL<<3)	// Output compare preload enable
+#define TIM_CCMR_OC_PWM1	(6UL<<4)	// Output active while CNT < CCR
+#define TIM_CCMR_OC_MASK	(0xFFUL)
+#define TIM_BDTR_MOE		(1UL<<15)
+
+/*
+ * =============================================
+ * APIs Supported by "PWM"
+ * =============================================
+ */
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Init
+  * @brief 			- Configures a timer as an up-counting PWM time base and starts it
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- PWM_cfg: Pointer to the PWM time base configuration
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- TIM2 is used by Timer.h as the microsecond delay time base
+  */
+void MCAL_PWM_Init(TIM_TypeDef* TIMx, PWM_cfg_t* PWM_cfg);
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Channel_Init
+  * @brief 			- Enables a PWM output channel with an initial pulse width
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- channel: Channel number @ref PWM_CHANNEL_define
+  * @param [in] 	- compare: Pulse width in counter ticks
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The channel pin must be configured as alternate function output by the caller
+  */
+void MCAL_PWM_Channel_Init(TIM_TypeDef* TIMx, uint8 channel, uint16 compare);
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Set_Compare
+  * @brief 			- Changes the pulse width of a channel
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- channel: Channel number @ref PWM_CHANNEL_define
+  * @param [in] 	- compare: Pulse width in counter ticks
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The new width is applied at the next period, no glitch is generated
+  */
+void MCAL_PWM_Set_Compare(TIM_TypeDef* TIMx, uint8 channel, uint16 compare);
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Get_Compare
+  * @brief 			- Reads the pulse width of a channel
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- channel: Channel number @ref PWM_CHANNEL_define
+  * @param [out] 	- None
+  * @retval 		- Pulse width in counter ticks
+  * Note			- Returns the last written value even if it is not applied yet
+  */
+uint16 MCAL_PWM_Get_Compare(TIM_TypeDef* TIMx, uint8 channel);
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Set_Tick_Frequency
+  * @brief 			- Recomputes the prescaler of a timer after its clock changed
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- Tick_Frequency: Counter tick frequency in HZ, as given to MCAL_PWM_Init
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The prescaler is buffered, the running period ends at the old rate without a glitch
+  * 				  Called automatically after MCAL_RCC_Select_Clock for the timers started by MCAL_PWM_Init
+  */
+void MCAL_PWM_Set_Tick_Frequency(TIM_TypeDef* TIMx, uint32 Tick_Frequency);
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Enable_Update_IRQ
+  * @brief 			- Calls a function at the start of every PWM period
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- P_IRQ_CallBack: Function called from the timer update interrupt
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Compare values written in the callback are applied at the next period
+  */
+void MCAL_PWM_Enable_Update_IRQ(TIM_TypeDef* TIMx, void (*P_IRQ_CallBack)(void));
+
+#endif /* INC_PWM_DRIVER_H_ */
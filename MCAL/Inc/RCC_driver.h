@@ -17,6 +17,14 @@
 //----------------------------------------------
 // Section: User type definitions
 //----------------------------------------------
+typedef struct{
+	uint32 SYSCLK;
+	uint32 HCLK;		// AHB, core and SysTick clock
+	uint32 PCLK1;		// APB1 peripherals (USART2/3, I2C, SPI2)
+	uint32 PCLK2;		// APB2 peripherals (USART1, SPI1, GPIO)
+	uint32 TIMCLK1;		// TIM2...TIM4 counter clock, twice PCLK1 when APB1 is divided
+	uint32 TIMCLK2;		// TIM1 counter clock, twice PCLK2 when APB2 is divided
+}RCC_ClockTree_t;
 
 //----------------------------------------------
 // Section: Macros Configuration References
@@ -26,9 +34,15 @@
 #define HSE_CLK			8000000UL
 
 // @ref RCC_CLOCK_SOURCE_define
-#define RCC_SELECT_HSI	(uint8)0x00
-#define RCC_SELECT_HSE	(uint8)0x01
-#define RCC_SELECT_PLL	(uint8)0x02
+#define RCC_SELECT_HSI		(uint8)0x00		// 8 MHz
+#define RCC_SELECT_HSE		(uint8)0x01		// 8 MHz crystal
+#define RCC_SELECT_PLL		(uint8)0x02		// HSE x 9 = 72 MHz
+#define RCC_SELECT_PLL_HSI	(uint8)0x03		// HSI / 2 x 16 = 64 MHz, when no crystal is fitted
+
+#define RCC_PLL_HSE_MUL		9
+#define RCC_PLL_HSI_MUL		16
+#define RCC_APB1_MAX_FREQ	36000000UL
+#define RCC_MAX_CLOCK_CALLBACKS	8
 
 // @ref RCC_PERIPHERALS_define
 #define RCC_GPIOA		(uint8)0x00
@@ -49,6 +63,10 @@
 #define RCC_DAC			(uint8)0x0F
 #define RCC_CRC			(uint8)0x10
 #define RCC_TIM2		(uint8)0x11
+#define RCC_TIM3		(uint8)0x12
+#define RCC_TIM4		(uint8)0x13
+#define RCC_TIM1		(uint8)0x14
+#define RCC_PERIPHERALS_COUNT	21
 
 /*
  * =============================================
@@ -62,20 +80,81 @@
   * @param [in] 	- clock: Select the clock source from @ref RCC_CLOCK_SOURCE_define
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- Also sets the flash wait states and prefetch, and divides APB1 to stay under 36 MHz
+  * 				  The callbacks of MCAL_RCC_Add_Clock_CallBack are called once the new clock runs
   */
 void MCAL_RCC_Select_Clock(uint8 clock);
 
+/**=============================================
+  * @Fn				- MCAL_RCC_Enable_HSI
+  * @brief 			- Starts the internal 8 MHz RC oscillator without changing the system clock
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- 1 if it was already running, 0 if it was started
+  * Note			- Needed by the flash program/erase controller
+  */
+uint8 MCAL_RCC_Enable_HSI(void);
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Disable_HSI
+  * @brief 			- Stops the internal 8 MHz RC oscillator
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Does nothing if the system clock runs from it
+  */
+void MCAL_RCC_Disable_HSI(void);
+
 /**=============================================
   * @Fn				- MCAL_RCC_Enable_Peripheral
   * @brief 			- Enable the clock for a specific peripheral
   * @param [in] 	- peripheral: Select the peripheral from @ref RCC_PERIPHERALS_define
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- Not reference counted, drivers use MCAL_RCC_Acquire_Peripheral
   */
 void MCAL_RCC_Enable_Peripheral(uint8 peripheral);
 
+/**=============================================
+  * @Fn				- MCAL_RCC_Disable_Peripheral
+  * @brief 			- Disable the clock of a specific peripheral
+  * @param [in] 	- peripheral: Select the peripheral from @ref RCC_PERIPHERALS_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The registers keep their values but cannot be accessed until the clock is enabled again
+  */
+void MCAL_RCC_Disable_Peripheral(uint8 peripheral);
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Acquire_Peripheral
+  * @brief 			- Takes a reference on the clock of a peripheral, the first one enables it
+  * @param [in] 	- peripheral: Select the peripheral from @ref RCC_PERIPHERALS_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Every acquire must be matched by one MCAL_RCC_Release_Peripheral, main context only
+  */
+void MCAL_RCC_Acquire_Peripheral(uint8 peripheral);
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Release_Peripheral
+  * @brief 			- Drops a reference on the clock of a peripheral, the clock is gated off with the last one
+  * @param [in] 	- peripheral: Select the peripheral from @ref RCC_PERIPHERALS_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Releasing a peripheral that was never acquired does nothing, main context only
+  */
+void MCAL_RCC_Release_Peripheral(uint8 peripheral);
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Get_Clocked_Peripherals
+  * @brief 			- Reports which peripherals currently have their clock enabled
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Bit n is set when the clock of peripheral n @ref RCC_PERIPHERALS_define is on
+  * Note			- Read from the enable registers, so clocks enabled without an acquire are reported too
+  */
+uint32 MCAL_RCC_Get_Clocked_Peripherals(void);
+
 /**=============================================
   * @Fn				- MCAL_RCC_Reset_Peripheral
   * @brief 			- Resets a specific peripheral
@@ -117,7 +196,7 @@ uint32 MCAL_RCC_GetHCLKFreq(void);
 uint32 MCAL_RCC_GetPCLK1Freq(void);
 
 /**=============================================
-  * @Fn				- MCAL_RCC_GetPCLK1Freq
+  * @Fn				- MCAL_RCC_GetPCLK2Freq
   * @brief 			- Gets the frequency of the APB2 bus clock in HZ
   * @param [in] 	- None
   * @param [out] 	- None
@@ -126,4 +205,24 @@ uint32 MCAL_RCC_GetPCLK1Freq(void);
   */
 uint32 MCAL_RCC_GetPCLK2Freq(void);
 
+/**=============================================
+  * @Fn				- MCAL_RCC_Get_Clock_Tree
+  * @brief 			- Reads all the bus and timer clock frequencies in HZ from the current configuration
+  * @param [out] 	- tree: Pointer to the structure receiving the frequencies
+  * @retval 		- None
+  * Note			- Drivers derive their dividers (SysTick reload, timer prescalers, USART BRR) from it
+  * 				  The frequencies are cached, CFGR is only read again after MCAL_RCC_Select_Clock
+  */
+void MCAL_RCC_Get_Clock_Tree(RCC_ClockTree_t* tree);
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Add_Clock_CallBack
+  * @brief 			- Registers a function called after every system clock change
+  * @param [in] 	- CallBack: Function re-deriving the dividers of a driver from MCAL_RCC_Get_Clock_Tree
+  * @param [out] 	- None
+  * @retval 		- 1 if registered, 0 if the callback table is full
+  * Note			- Called from MCAL_RCC_Select_Clock in registration order, a function is only registered once
+  */
+uint8 MCAL_RCC_Add_Clock_CallBack(void (*CallBack)(void));
+
 #endif /* INC_RCC_DRIVER_H_ */
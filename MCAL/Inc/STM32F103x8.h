@@ -33,6 +33,8 @@
 #define NVIC_BASE							0xE000E100UL
 #define SCB_BASE							0xE000ED00UL
 #define STK_BASE							0xE000E010UL
+#define DWT_BASE							0xE0001000UL
+#define COREDEBUG_BASE						0xE000EDF0UL
 
 
 //----------------------------------------------
@@ -41,6 +43,7 @@
 
 	/* RCC: */
 #define RCC_BASE	0x40021000UL
+#define FLASH_R_BASE	0x40022000UL	// Flash memory interface registers
 #define CRC_BASE	0x40023000UL
 
 //----------------------------------------------
@@ -71,6 +74,9 @@
 		/* SPI */
 #define SPI1_BASE	0x40013000UL
 
+		/* TIM */
+#define TIM1_BASE	0x40012C00UL
+
 //----------------------------------------------
 // Section: Base addresses for APB1 Peripherals
 //----------------------------------------------
@@ -89,6 +95,11 @@
 		/* DAC */
 #define DAC_BASE	0x40007400UL
 
+		/* TIM */
+#define TIM2_BASE	0x40000000UL
+#define TIM3_BASE	0x40000400UL
+#define TIM4_BASE	0x40000800UL
+
 //======================================================//
 
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
@@ -129,6 +140,26 @@ typedef struct{
 	vuint32_t BFAR;
 }SCB_TypeDef;
 
+		/* DWT */
+typedef struct{
+	vuint32_t CTRL;
+	vuint32_t CYCCNT;
+	vuint32_t CPICNT;
+	vuint32_t EXCCNT;
+	vuint32_t SLEEPCNT;
+	vuint32_t LSUCNT;
+	vuint32_t FOLDCNT;
+	vuint32_t PCSR;
+}DWT_TypeDef;
+
+		/* CoreDebug */
+typedef struct{
+	vuint32_t DHCSR;
+	vuint32_t DCRSR;
+	vuint32_t DCRDR;
+	vuint32_t DEMCR;
+}CoreDebug_TypeDef;
+
 		/* STK */
 typedef struct{
 	vuint32_t CTRL;
@@ -162,6 +193,19 @@ typedef struct{
 	vuint32_t CSR;
 }RCC_TypeDef;
 
+		/* FLASH */
+typedef struct{
+	vuint32_t ACR;
+	vuint32_t KEYR;
+	vuint32_t OPTKEYR;
+	vuint32_t SR;
+	vuint32_t CR;
+	vuint32_t AR;
+	vuint32_t RESERVED;
+	vuint32_t OBR;
+	vuint32_t WRPR;
+}FLASH_TypeDef;
+
 		/* EXTI */
 typedef struct{
 	vuint32_t IMR;
@@ -239,6 +283,30 @@ typedef struct{
 	vuint32_t CR;
 }CRC_TypeDef;
 
+		/* TIM */
+typedef struct{
+	vuint32_t CR1;
+	vuint32_t CR2;
+	vuint32_t SMCR;
+	vuint32_t DIER;
+	vuint32_t SR;
+	vuint32_t EGR;
+	vuint32_t CCMR1;
+	vuint32_t CCMR2;
+	vuint32_t CCER;
+	vuint32_t CNT;
+	vuint32_t PSC;
+	vuint32_t ARR;
+	vuint32_t RCR;	// Advanced-control timer (TIM1) only
+	vuint32_t CCR1;
+	vuint32_t CCR2;
+	vuint32_t CCR3;
+	vuint32_t CCR4;
+	vuint32_t BDTR;	// Advanced-control timer (TIM1) only
+	vuint32_t DCR;
+	vuint32_t DMAR;
+}TIM_TypeDef;
+
 //======================================================//
 
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
@@ -248,6 +316,8 @@ typedef struct{
 #define NVIC		((NVIC_TypeDef*)NVIC_BASE)
 #define SCB			((SCB_TypeDef* )SCB_BASE )
 #define STK			((STK_TypeDef* )STK_BASE )
+#define DWT			((DWT_TypeDef* )DWT_BASE )
+#define CoreDebug	((CoreDebug_TypeDef*)COREDEBUG_BASE)
 
 #define GPIOA		((GPIO_TypeDef*)GPIOA_BASE)
 #define GPIOB		((GPIO_TypeDef*)GPIOB_BASE)
@@ -258,6 +328,7 @@ typedef struct{
 #define GPIOG		((GPIO_TypeDef*)GPIOG_BASE)
 
 #define RCC			((RCC_TypeDef*)RCC_BASE)
+#define FLASH		((FLASH_TypeDef*)FLASH_R_BASE)
 
 #define EXTI		((EXTI_TypeDef*)EXTI_BASE)
 
@@ -273,6 +344,11 @@ typedef struct{
 #define I2C1		((I2C_TypeDef*)I2C1_BASE)
 #define I2C2		((I2C_TypeDef*)I2C2_BASE)
 
+#define TIM1		((TIM_TypeDef*)TIM1_BASE)
+#define TIM2		((TIM_TypeDef*)TIM2_BASE)
+#define TIM3		((TIM_TypeDef*)TIM3_BASE)
+#define TIM4		((TIM_TypeDef*)TIM4_BASE)
+
 #define DAC			((DAC_TypeDef*)DAC_BASE)
 
 #define CRC			((CRC_TypeDef*)CRC_BASE)
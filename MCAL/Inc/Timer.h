@@ -10,6 +10,7 @@
 
 #include "STM32F103x8.h"
 #include "gpio_driver.h"
+#include "RCC_driver.h"
 
 #define RCC_APB1ENR                           *( volatile uint32 *)(RCC_BASE+0x1C)
 #define RCC_APB2ENR                           *( volatile uint32 *)(RCC_BASE+0x18)
@@ -26,12 +27,16 @@
 #define TIM2_SR                               *( volatile uint32 *)(TIM2_timer_Base+0x10)
 #define TIM2_DIER                             *( volatile uint32 *)(TIM2_timer_Base+0x0c)
 #define TIM2_ARR                              *( volatile uint32 *)(TIM2_timer_Base+0x2c)
+#define TIM2_EGR                              *( volatile uint32 *)(TIM2_timer_Base+0x14)
 
 
 
 /*=================Timer2======================*/
 void Timer2_init(void);
-void dus(int us);
-void dms(int ms);
+void Timer2_Reclock(void);   //called after a clock change, must not interrupt a running dus()
+void dus(int us);            //waits at least us microseconds (less than us+1), any length across the 50ms period
+void dms(int ms);            //waits at least ms milliseconds
+uint32 Timer2_Get_us(void);                //free running 1MHZ count, starting point of Timer2_Elapsed_us()
+uint32 Timer2_Elapsed_us(uint32 since);    //us since a Timer2_Get_us() value, up to one period (50ms) and not across a dus()
 
 #endif /* INC_TIMER_H_ */
@@ -35,7 +35,7 @@ typedef struct{
 							// this parameter must be set based on @ref UART_HwFlowCtl_define
 	uint8	IRQ_Enable;		// Enable or Disable UART IRQ TX/RX
 							// @ref UART_IRQ_Enable_define, you can select two or three parameters
-	void (*P_IRQ_CallBack)(void); // Set the C Function() which will be called once the IRQ happen
+	void (*P_IRQ_CallBack)(void); // Set the C Function() which will be called once the IRQ happen, it is the vector itself if the vector table is in SRAM
 }USART_cfg_t;
 
 typedef enum{
@@ -104,7 +104,7 @@ typedef enum{
   * @param [in] 	- USARTx: Pointer to the USART peripheral instance, where x can be (1..3 depending on device used)
   * @param [in] 	- USART_cfg: Pointer to the UART configuration
   * @retval 		- None
-  * Note			- Support for now asynchronous mode and clock 8MHZ
+  * Note			- Support for now asynchronous mode, BRR is derived from the APB clock in MCAL_RCC_Get_Clock_Tree
   */
 void MCAL_USART_Init(USART_TypeDef* USARTx, USART_cfg_t* USART_cfg);
 
@@ -113,7 +113,7 @@ void MCAL_USART_Init(USART_TypeDef* USARTx, USART_cfg_t* USART_cfg);
   * @brief 			- DeInitializes UART (Supported feature Asynchronous only)
   * @param [in] 	- USARTx: Pointer to the USART peripheral instance, where x can be (1..3 depending on device used)
   * @retval 		- None
-  * Note			- Reset the model by RCC
+  * Note			- Reset the model by RCC and release its clocks
   */
 void MCAL_USART_DeInit(USART_TypeDef* USARTx);
 
@@ -189,6 +189,33 @@ void MCAL_USART_ReceiveBuffer(USART_TypeDef* USARTx, uint16 *pRxBuffer, uint8 le
   */
 void MCAL_USART_Wait_TC(USART_TypeDef* USARTx);
 
+/**=============================================
+  * @Fn				- MCAL_USART_Reclock
+  * @brief 			- Recomputes the baudrate register after the APB clock changed
+  * @param [in] 	- USARTx: Pointer to the USART peripheral instance, where x can be (1..3 depending on device used)
+  * @retval 		- None
+  * Note			- Called automatically after MCAL_RCC_Select_Clock, bits received in between are sampled at the old rate
+  */
+void MCAL_USART_Reclock(USART_TypeDef* USARTx);
+
+/**=============================================
+  * @Fn				- MCAL_USART_Get_BaudRate
+  * @brief 			- Returns the baudrate given to MCAL_USART_Init
+  * @param [in] 	- USARTx: Pointer to the USART peripheral instance, where x can be (1..3 depending on device used)
+  * @retval 		- Baudrate in bits per second, 0 if the USART was not initialized
+  * Note			- None
+  */
+uint32 MCAL_USART_Get_BaudRate(USART_TypeDef* USARTx);
+
+/**=============================================
+  * @Fn				- MCAL_USART_Get_RX_Level
+  * @brief 			- Reads the level of the RX pin
+  * @param [in] 	- USARTx: Pointer to the USART peripheral instance, where x can be (1..3 depending on device used)
+  * @retval 		- 1 when the line is high (idle or a 1 bit), 0 when low
+  * Note			- The line is idle once it stays high for a whole frame
+  */
+uint8 MCAL_USART_Get_RX_Level(USART_TypeDef* USARTx);
+
 // TODO MCAL_USART_LIN_Init();
 // TODO MCAL_USART_Init();
 // TODO MCAL_USART_DMA_Init();
@@ -82,6 +82,34 @@ typedef struct{
 #define GPIO_RETURN_LOCK_OK			1
 #define GPIO_RETURN_LOCK_ERROR		0
 
+// @ref GPIO_PIN_DESCRIPTOR_define
+/*	A pin descriptor is a "port, pin index" pair fixed at compile time, e.g.
+		#define STATUS_LED		GPIOA, 11
+	The port address, pin bit and CRL/CRH field are then constants, so every access
+	below is a single load or store to a fixed address with no call and no branch.
+	Accessors taking only the pin are variadic so a descriptor expanded by an enclosing macro still works.*/
+#define GPIO_PIN_PORT(...)					GPIO_DESC_PORT(__VA_ARGS__)
+#define GPIO_PIN_INDEX(...)					GPIO_DESC_INDEX(__VA_ARGS__)
+#define GPIO_PIN_MASK(...)					GPIO_DESC_MASK(__VA_ARGS__)
+#define GPIO_PIN_CR(...)					GPIO_DESC_CR(__VA_ARGS__)		// CRL or CRH holding the pin configuration
+#define GPIO_PIN_CR_SHIFT(...)				GPIO_DESC_CR_SHIFT(__VA_ARGS__)	// Position of the pin configuration in it
+#define GPIO_PIN_INIT(pin, mode, speed)		MCAL_GPIO_InitMask(GPIO_PIN_PORT(pin), GPIO_PIN_MASK(pin), mode, speed)
+#define GPIO_PIN_HIGH(...)					(GPIO_PIN_PORT(__VA_ARGS__)->BSRR = GPIO_PIN_MASK(__VA_ARGS__))
+#define GPIO_PIN_LOW(...)					(GPIO_PIN_PORT(__VA_ARGS__)->BRR = GPIO_PIN_MASK(__VA_ARGS__))
+#define GPIO_PIN_WRITE(pin, value)			(GPIO_PIN_PORT(pin)->BSRR = (uint32)GPIO_PIN_MASK(pin) << (((value) == GPIO_PIN_RESET) << 4))
+#define GPIO_PIN_READ(...)					((uint8)((GPIO_PIN_PORT(__VA_ARGS__)->IDR >> GPIO_PIN_INDEX(__VA_ARGS__)) & 1UL))
+
+/* Whole port accesses with a compile time port */
+#define GPIO_PORT_SET_RESET(port, set, reset)	((port)->BSRR = ((uint32)(uint16)(reset) << 16) | (uint16)(set))
+#define GPIO_PORT_READ(port)					((uint16)((port)->IDR))
+
+/* Descriptor expansion helpers, the descriptor is split into its two fields here */
+#define GPIO_DESC_PORT(port, index)			(port)
+#define GPIO_DESC_INDEX(port, index)		(index)
+#define GPIO_DESC_MASK(port, index)			((uint16)(1U << (index)))
+#define GPIO_DESC_CR(port, index)			(((index) < 8) ? &(port)->CRL : &(port)->CRH)
+#define GPIO_DESC_CR_SHIFT(port, index)		(((index) & 7U) << 2)
+
 /*
  * =============================================
  * APIs Supported by "GPIO"
@@ -101,6 +129,19 @@ typedef struct{
   */
 void MCAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_PinConfig_t *PinConfig);
 
+/**=============================================
+  * @Fn				- MCAL_GPIO_InitMask
+  * @brief 			- Initializes several pins of the same port with the same configuration
+  * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
+  * @param [in] 	- PinMask: Pins to be configured, can be combined from @ref GPIO_PINS_define
+  * @param [in] 	- Mode: Pins mode @ref GPIO_MODE_define
+  * @param [in] 	- Speed: Output speed @ref GPIO_SPEED_define, ignored for inputs
+  * @retval 		- None
+  * Note			- CRL and CRH are each written once, whatever the number of pins
+  * 				- It is mandatory to enable RCC clock for the corresponding GPIO PORT
+  */
+void MCAL_GPIO_InitMask(GPIO_TypeDef *GPIOx, uint16 PinMask, uint8 Mode, uint8 Speed);
+
 /**=============================================
   * @Fn				- MCAL_GPIO_DeInit
   * @brief 			- Resets the GPIO PORT
@@ -140,13 +181,47 @@ uint16 MCAL_GPIO_ReadPort(GPIO_TypeDef *GPIOx);
   */
 void MCAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16 PinNumber, uint8 Value);
 
+/**=============================================
+  * @Fn				- MCAL_GPIO_SetResetPins
+  * @brief 			- Sets some pins and resets others of the same port in a single write
+  * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
+  * @param [in] 	- SetPins: Pins to be set, can be combined from @ref GPIO_PINS_define
+  * @param [in] 	- ResetPins: Pins to be reset, can be combined from @ref GPIO_PINS_define
+  * @retval 		- None
+  * Note			- Pins that are not selected are not affected, a pin in both masks is set
+  */
+void MCAL_GPIO_SetResetPins(GPIO_TypeDef *GPIOx, uint16 SetPins, uint16 ResetPins);
+
+/**=============================================
+  * @Fn				- MCAL_GPIO_WriteGroup
+  * @brief 			- Writes a value on a group of pins of the same port in a single store
+  * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
+  * @param [in] 	- GroupMask: Pins of the group, can be combined from @ref GPIO_PINS_define
+  * @param [in] 	- Value: New level of the group pins, one bit per pin, bits outside GroupMask are ignored
+  * @retval 		- None
+  * Note			- Uses both halves of BSRR, pins outside the group are never touched so an
+  * 				  interrupt driving other pins of the port cannot be overwritten
+  */
+void MCAL_GPIO_WriteGroup(GPIO_TypeDef *GPIOx, uint16 GroupMask, uint16 Value);
+
+/**=============================================
+  * @Fn				- MCAL_GPIO_ToggleGroup
+  * @brief 			- Toggles a group of pins of the same port in a single store
+  * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
+  * @param [in] 	- GroupMask: Pins to be toggled, can be combined from @ref GPIO_PINS_define
+  * @retval 		- None
+  * Note			- The output levels are read from ODR and written back through BSRR, only the group
+  * 				  pins are written so other pins changed by an interrupt in between are kept
+  */
+void MCAL_GPIO_ToggleGroup(GPIO_TypeDef *GPIOx, uint16 GroupMask);
+
 /**=============================================
   * @Fn				- MCAL_GPIO_WritePort
   * @brief 			- Write on specific port
   * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
   * @param [in] 	- Value: Port value to be written
   * @retval 		- None
-  * Note			- None
+  * Note			- Overwrites the whole ODR, use MCAL_GPIO_WriteGroup when interrupts drive pins of the same port
   */
 void MCAL_GPIO_WritePort(GPIO_TypeDef *GPIOx, uint16 Value);
 
@@ -156,7 +231,7 @@ void MCAL_GPIO_WritePort(GPIO_TypeDef *GPIOx, uint16 Value);
   * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
   * @param [in] 	- PinNumber: Set pin number according to @ref GPIO_PINS_define
   * @retval 		- None
-  * Note			- None
+  * Note			- Done through BSRR, safe against interrupts driving other pins of the port
   */
 void MCAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16 PinNumber);
 
@@ -34,9 +34,6 @@ typedef struct{
 #define STK_CLK_MASK			0x04UL
 #define STK_RELOAD_MASK			0x00FFFFFFUL
 
-// @ref stk_cpu_freq_define
-#define STK_FCPU				8000000UL
-
 // @ref stk_interrupt_config_define
 #define STK_INTERRUPT_ENABLED	0x02UL
 #define STK_INTERRUPT_DISABLED	0x00UL
@@ -81,7 +78,7 @@ void MCAL_STK_SetReload(uint32 value);
   * @param [in] 	- pfCallback: Pointer to the callback function
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- In periodic mode the callback is installed as the SysTick vector if the vector table is in SRAM
   */
 void MCAL_STK_SetCallback(void (*pfCallback)(void));
 
@@ -121,7 +118,7 @@ void MCAL_STK_Delay(uint32 delay_ticks);
   * @param [in] 	- delay_ms: Number of milliseconds delay needed
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- User must define the frequency of the SysTick timer in @ref stk_cpu_freq_define
+  * Note			- The SysTick ticks are derived from the HCLK given by MCAL_RCC_Get_Clock_Tree
   */
 void MCAL_STK_Delay1ms(uint32 delay_ms);
 
@@ -9,6 +9,68 @@
 
 #include "NVIC_driver.h"
 
+#define NVIC_DEMCR_TRCENA		(1UL<<24)	// Enables the DWT
+#define NVIC_DWT_CYCCNTENA		(1UL<<0)
+
+#define NVIC_SYSTEM_VECTORS		16			// Vector index of IRQ 0
+#define NVIC_VECTOR_TABLE_ALIGN	256			// VTOR needs the table size rounded up to a power of 2
+
+#if NVIC_VECTOR_TABLE_IN_SRAM
+static void (*NVIC_Vector_Table[NVIC_VECTORS_COUNT])(void) __attribute__((aligned(NVIC_VECTOR_TABLE_ALIGN)));
+static uint8 NVIC_Vector_Table_Active;
+
+/* Writes one entry of the SRAM table, index counts from the initial stack pointer */
+static uint8 NVIC_Set_Vector(uint8 index, void (*handler)(void)){
+	uint8 installed = 0;
+
+	if((NVIC_Vector_Table_Active) && (NULL != handler) && (index < NVIC_VECTORS_COUNT)){
+		NVIC_Vector_Table[index] = handler;
+		/* The entry must be in memory before the next exception fetches it */
+		NVIC_DSB();
+		installed = 1;
+	}
+	else{ /* Do Nothing */ }
+
+	return installed;
+}
+#endif
+
+#if NVIC_CRITICAL_MEASURE
+static uint32 NVIC_Critical_Start;
+static uint32 NVIC_Critical_Max_Cycles;
+static uint8 NVIC_Critical_Depth;
+
+/* Called once the interrupts are masked, only the outermost section is timed */
+static void NVIC_Measure_Begin(void){
+	if(0 == NVIC_Critical_Depth){
+		NVIC_Critical_Start = DWT->CYCCNT;
+	}
+	else{ /* Do Nothing */ }
+	NVIC_Critical_Depth++;
+}
+
+/* Called before the interrupts are unmasked */
+static void NVIC_Measure_End(void){
+	uint32 cycles;
+
+	if(NVIC_Critical_Depth > 0){
+		NVIC_Critical_Depth--;
+		if(0 == NVIC_Critical_Depth){
+			cycles = DWT->CYCCNT - NVIC_Critical_Start;
+			if(cycles > NVIC_Critical_Max_Cycles){
+				NVIC_Critical_Max_Cycles = cycles;
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+#else
+#define NVIC_Measure_Begin()
+#define NVIC_Measure_End()
+#endif
+
 /**=============================================
   * @Fn				- MCAL_NVIC_SetPriorityGrouping
   * @brief 			- Set the priority grouping
@@ -178,13 +240,8 @@ uint8 MCAL_NVIC_GetActive(uint8 IRQn){
   * Note			- None
   */
 void MCAL_NVIC_SetPriority(uint8 IRQn, uint8 priority){
-    /* Check which IPR register to write into */
-	uint8 reg_index = IRQn/32;
-
-	/* Get IRQn with respect to current register */
-	uint8 IRQ_index = IRQn%32;
-
-    NVIC->IP[(4*reg_index + IRQ_index)] = priority;
+    /* One byte per IRQ, only the upper 4 bits are implemented */
+    NVIC->IP[IRQn] = priority & NVIC_PRIO_MASK;
 }
 
 /**=============================================
@@ -196,13 +253,7 @@ void MCAL_NVIC_SetPriority(uint8 IRQn, uint8 priority){
   * Note			- None
   */
 uint8 MCAL_NVIC_GetPriority(uint8 IRQn){
-    /* Check which IPR register to write into */
-	uint8 reg_index = IRQn/32;
-
-	/* Get IRQn with respect to current register */
-	uint8 IRQ_index = IRQn%32;
-
-    return NVIC->IP[(4*reg_index + IRQ_index)];
+    return NVIC->IP[IRQn];
 }
 
 /**=============================================
@@ -219,3 +270,215 @@ void MCAL_NVIC_SystemReset(void){
     /* Wait until reset */
     while(1);
 }
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Disable_Global_IRQ
+  * @brief 			- Masks all configurable interrupts (PRIMASK)
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Previous PRIMASK value, to be given to MCAL_NVIC_Restore_Global_IRQ
+  * Note			- Calls can be nested, only the outermost restore unmasks the interrupts
+  */
+uint32 MCAL_NVIC_Disable_Global_IRQ(void){
+	uint32 primask;
+
+	NVIC_GET_PRIMASK(primask);
+	NVIC_DISABLE_IRQ();
+	NVIC_Measure_Begin();
+
+	return primask;
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Restore_Global_IRQ
+  * @brief 			- Restores the interrupt mask saved by MCAL_NVIC_Disable_Global_IRQ
+  * @param [in] 	- primask: Value returned by MCAL_NVIC_Disable_Global_IRQ
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_NVIC_Restore_Global_IRQ(uint32 primask){
+	NVIC_Measure_End();
+	NVIC_SET_PRIMASK(primask);
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_SetSystemPriority
+  * @brief 			- Set priority for a Cortex-M3 system exception
+  * @param [in] 	- exception: Exception number @ref System_Exceptions_define
+  * @param [in] 	- priority: priority of the exception as defined in @ref Interrupt_Priorities_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- SysTick is in SHP[11], the system handlers start at exception 4
+  */
+void MCAL_NVIC_SetSystemPriority(uint8 exception, uint8 priority){
+	if((exception >= 4) && (exception <= NVIC_SYSTICK_EXCEPTION)){
+		SCB->SHP[exception - 4] = priority & NVIC_PRIO_MASK;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_GetSystemPriority
+  * @brief 			- Read priority of a Cortex-M3 system exception
+  * @param [in] 	- exception: Exception number @ref System_Exceptions_define
+  * @param [out] 	- None
+  * @retval 		- Priority value @ref Interrupt_Priorities_define, 0 for an exception with a fixed priority
+  * Note			- None
+  */
+uint8 MCAL_NVIC_GetSystemPriority(uint8 exception){
+	return ((exception >= 4) && (exception <= NVIC_SYSTICK_EXCEPTION)) ? SCB->SHP[exception - 4] : 0;
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Critical_Enter
+  * @brief 			- Masks the interrupts with a priority value of level or higher (BASEPRI)
+  * @param [in] 	- level: Priority @ref Interrupt_Priorities_define, NVIC_PRIO_0000 does not mask anything
+  * @param [out] 	- None
+  * @retval 		- Previous BASEPRI value, to be given to MCAL_NVIC_Critical_Exit
+  * Note			- Only raises the mask, a nested section with a lower level keeps the outer one
+  * 				  Use CRITICAL_ENTER/CRITICAL_EXIT instead of calling it directly
+  */
+uint32 MCAL_NVIC_Critical_Enter(uint8 level){
+	uint32 basepri;
+
+	NVIC_GET_BASEPRI(basepri);
+	NVIC_RAISE_BASEPRI((uint32)(level & NVIC_PRIO_MASK));
+	NVIC_Measure_Begin();
+
+	return basepri;
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Critical_Exit
+  * @brief 			- Restores the mask saved by MCAL_NVIC_Critical_Enter
+  * @param [in] 	- basepri: Value returned by MCAL_NVIC_Critical_Enter
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- None
+  */
+void MCAL_NVIC_Critical_Exit(uint32 basepri){
+	NVIC_Measure_End();
+	NVIC_SET_BASEPRI(basepri);
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Critical_Measure_Start
+  * @brief 			- Starts the DWT cycle counter and clears the worst case masked time
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Measures the critical sections and the MCAL_NVIC_Disable_Global_IRQ sections
+  * 				  Needs NVIC_CRITICAL_MEASURE, the counter is shared with any other DWT user
+  */
+void MCAL_NVIC_Critical_Measure_Start(void){
+#if NVIC_CRITICAL_MEASURE
+	CoreDebug->DEMCR |= NVIC_DEMCR_TRCENA;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= NVIC_DWT_CYCCNTENA;
+	NVIC_Critical_Max_Cycles = 0;
+#endif
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Critical_Get_Max_Cycles
+  * @brief 			- Returns the longest time the interrupts were masked
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Worst case in CPU cycles since MCAL_NVIC_Critical_Measure_Start, 0 if not measured
+  * Note			- Only the outermost section of nested ones is measured
+  */
+uint32 MCAL_NVIC_Critical_Get_Max_Cycles(void){
+#if NVIC_CRITICAL_MEASURE
+	return NVIC_Critical_Max_Cycles;
+#else
+	return 0;
+#endif
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_Relocate_Vector_Table
+  * @brief 			- Copies the active vector table to SRAM and points VTOR to the copy
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- 1 if the SRAM table is active, 0 if NVIC_VECTOR_TABLE_IN_SRAM is disabled
+  * Note			- Call it once at boot before any handler is installed, calling it again does nothing
+  */
+uint8 MCAL_NVIC_Relocate_Vector_Table(void){
+#if NVIC_VECTOR_TABLE_IN_SRAM
+	void (* const * flash_table)(void);
+	uint32 primask;
+	uint8 index;
+
+	if(0 == NVIC_Vector_Table_Active){
+		/* VTOR is 0 out of reset, flash is aliased there */
+		flash_table = NVIC_GET_VECTOR_TABLE();
+		for(index = 0; index < NVIC_VECTORS_COUNT; index++){
+			NVIC_Vector_Table[index] = flash_table[index];
+		}
+
+		/* No exception may be taken halfway through the switch */
+		primask = MCAL_NVIC_Disable_Global_IRQ();
+		NVIC_DSB();
+		NVIC_SET_VECTOR_TABLE(NVIC_Vector_Table);
+		NVIC_DSB();
+		NVIC_ISB();
+		NVIC_Vector_Table_Active = 1;
+		MCAL_NVIC_Restore_Global_IRQ(primask);
+	}
+	else{ /* Do Nothing */ }
+
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_SetHandler
+  * @brief 			- Installs the function called directly by the core on IRQn
+  * @param [in] 	- IRQn: Number of interrupt request as defined in vector table or in @ref Interrupt_Requests_Numbers_define
+  * @param [in] 	- handler: Function to install, must not be NULL
+  * @param [out] 	- None
+  * @retval 		- 1 if installed, 0 if the vector table is still in flash or the arguments are invalid
+  * Note			- The caller keeps its fixed IRQHandler for the 0 case
+  */
+uint8 MCAL_NVIC_SetHandler(uint8 IRQn, void (*handler)(void)){
+#if NVIC_VECTOR_TABLE_IN_SRAM
+	return (IRQn < NVIC_IRQS_COUNT) ? NVIC_Set_Vector(NVIC_SYSTEM_VECTORS + IRQn, handler) : 0;
+#else
+	return 0;
+#endif
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_SetSystemHandler
+  * @brief 			- Installs the function called directly by the core on a system exception
+  * @param [in] 	- exception: Exception number @ref System_Exceptions_define
+  * @param [in] 	- handler: Function to install, must not be NULL
+  * @param [out] 	- None
+  * @retval 		- 1 if installed, 0 if the vector table is still in flash or the arguments are invalid
+  * Note			- None
+  */
+uint8 MCAL_NVIC_SetSystemHandler(uint8 exception, void (*handler)(void)){
+#if NVIC_VECTOR_TABLE_IN_SRAM
+	/* Entry 0 is the initial stack pointer and entry 1 the reset vector */
+	return ((exception >= 2) && (exception < NVIC_SYSTEM_VECTORS)) ? NVIC_Set_Vector(exception, handler) : 0;
+#else
+	return 0;
+#endif
+}
+
+/**=============================================
+  * @Fn				- MCAL_NVIC_GetHandler
+  * @brief 			- Returns the function the core calls on IRQn
+  * @param [in] 	- IRQn: Number of interrupt request as defined in vector table or in @ref Interrupt_Requests_Numbers_define
+  * @param [out] 	- None
+  * @retval 		- Current vector, read from the active table, NULL if IRQn is invalid
+  * Note			- None
+  */
+void (*MCAL_NVIC_GetHandler(uint8 IRQn))(void){
+	void (* const * table)(void) = NVIC_GET_VECTOR_TABLE();
+
+	return (IRQn < NVIC_IRQS_COUNT) ? table[NVIC_SYSTEM_VECTORS + IRQn] : NULL;
+}
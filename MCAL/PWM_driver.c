@@ -0,0 +1,236 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : STM32F103C8T6_Drivers  	                             */
+/* File          : PWM_driver.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+#include "PWM_driver.h"
+
+/* Variables */
+static void (*GP_Update_CallBack[4])(void); // TIM1..TIM4
+static uint32 PWM_Tick_Frequency[4];		// 0 for the timers not initialized by MCAL_PWM_Init
+
+/* Returns the index of a timer in GP_Update_CallBack */
+static uint8 PWM_Get_Index(TIM_TypeDef* TIMx){
+	uint8 index;
+
+	if(TIM1 == TIMx){
+		index = 0;
+	}
+	else if(TIM2 == TIMx){
+		index = 1;
+	}
+	else if(TIM3 == TIMx){
+		index = 2;
+	}
+	else{
+		index = 3;
+	}
+
+	return index;
+}
+
+/* Clears the update flag then calls the registered function */
+static void PWM_Update_Handler(TIM_TypeDef* TIMx){
+	void (*callback)(void) = GP_Update_CallBack[PWM_Get_Index(TIMx)];
+
+	TIMx->SR = ~TIM_SR_UIF;
+
+	if(callback){
+		callback();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Returns the counter clock of a timer, TIM1 sits on APB2 and the others on APB1 */
+static uint32 PWM_Get_Timer_Clock(TIM_TypeDef* TIMx){
+	RCC_ClockTree_t tree;
+
+	MCAL_RCC_Get_Clock_Tree(&tree);
+	return (TIM1 == TIMx) ? tree.TIMCLK2 : tree.TIMCLK1;
+}
+
+/* Clock change callback, every PWM timer keeps its tick frequency */
+static void PWM_Clock_CallBack(void){
+	static TIM_TypeDef* const Timers[4] = {TIM1, TIM2, TIM3, TIM4};
+	uint8 index;
+
+	for(index = 0; index < 4; index++){
+		if(PWM_Tick_Frequency[index]){
+			MCAL_PWM_Set_Tick_Frequency(Timers[index], PWM_Tick_Frequency[index]);
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+/* Returns the CCRx register of a channel */
+static vuint32_t* PWM_Get_CCR(TIM_TypeDef* TIMx, uint8 channel){
+	vuint32_t* ccr;
+
+	switch(channel){
+	case PWM_CHANNEL_1: ccr = &TIMx->CCR1; break;
+	case PWM_CHANNEL_2: ccr = &TIMx->CCR2; break;
+	case PWM_CHANNEL_3: ccr = &TIMx->CCR3; break;
+	default:			ccr = &TIMx->CCR4; break;
+	}
+
+	return ccr;
+}
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Init
+  * @brief 			- Configures a timer as an up-counting PWM time base and starts it
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- PWM_cfg: Pointer to the PWM time base configuration
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- TIM2 is used by Timer.h as the microsecond delay time base
+  */
+void MCAL_PWM_Init(TIM_TypeDef* TIMx, PWM_cfg_t* PWM_cfg){
+	/* Enable clock for given timer */
+	if(TIM1 == TIMx){
+		MCAL_RCC_Acquire_Peripheral(RCC_TIM1);
+	}
+	else if(TIM2 == TIMx){
+		MCAL_RCC_Acquire_Peripheral(RCC_TIM2);
+	}
+	else if(TIM3 == TIMx){
+		MCAL_RCC_Acquire_Peripheral(RCC_TIM3);
+	}
+	else if(TIM4 == TIMx){
+		MCAL_RCC_Acquire_Peripheral(RCC_TIM4);
+	}
+	else{ /* Do Nothing */ }
+
+	TIMx->CR1 = 0;
+
+	/* The prescaler follows the system clock changes */
+	PWM_Tick_Frequency[PWM_Get_Index(TIMx)] = PWM_cfg->Tick_Frequency;
+	MCAL_RCC_Add_Clock_CallBack(PWM_Clock_CallBack);
+
+	/* Time base */
+	TIMx->PSC = (PWM_Get_Timer_Clock(TIMx) / PWM_cfg->Tick_Frequency) - 1;
+	TIMx->ARR = PWM_cfg->Period - 1;
+
+	/* Buffer ARR and load PSC/ARR now instead of at the first overflow */
+	TIMx->CR1 |= TIM_CR1_ARPE;
+	TIMx->EGR = TIM_EGR_UG;
+
+	/* Advanced-control timer outputs are gated by the main output enable */
+	if(TIM1 == TIMx){
+		TIMx->BDTR |= TIM_BDTR_MOE;
+	}
+	else{ /* Do Nothing */ }
+
+	TIMx->CR1 |= TIM_CR1_CEN;
+}
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Channel_Init
+  * @brief 			- Enables a PWM output channel with an initial pulse width
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- channel: Channel number @ref PWM_CHANNEL_define
+  * @param [in] 	- compare: Pulse width in counter ticks
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The channel pin must be configured as alternate function output by the caller
+  */
+void MCAL_PWM_Channel_Init(TIM_TypeDef* TIMx, uint8 channel, uint16 compare){
+	/* Channels 1, 2 are in CCMR1 and 3, 4 in CCMR2, 8 bits each */
+	vuint32_t* ccmr = (channel <= PWM_CHANNEL_2) ? &TIMx->CCMR1 : &TIMx->CCMR2;
+	uint8 shift = ((channel - 1) & 1) * 8;
+
+	if((channel >= PWM_CHANNEL_1) && (channel <= PWM_CHANNEL_4)){
+		*ccmr &= ~(TIM_CCMR_OC_MASK << shift);
+		*ccmr |= ((TIM_CCMR_OC_PWM1 | TIM_CCMR_OC_PE) << shift);
+
+		*PWM_Get_CCR(TIMx, channel) = compare;
+
+		/* CCxE, active high */
+		TIMx->CCER &= ~(0xFUL << ((channel - 1) * 4));
+		TIMx->CCER |= (1UL << ((channel - 1) * 4));
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Set_Compare
+  * @brief 			- Changes the pulse width of a channel
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- channel: Channel number @ref PWM_CHANNEL_define
+  * @param [in] 	- compare: Pulse width in counter ticks
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The new width is applied at the next period, no glitch is generated
+  */
+void MCAL_PWM_Set_Compare(TIM_TypeDef* TIMx, uint8 channel, uint16 compare){
+	*PWM_Get_CCR(TIMx, channel) = compare;
+}
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Get_Compare
+  * @brief 			- Reads the pulse width of a channel
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- channel: Channel number @ref PWM_CHANNEL_define
+  * @param [out] 	- None
+  * @retval 		- Pulse width in counter ticks
+  * Note			- Returns the last written value even if it is not applied yet
+  */
+uint16 MCAL_PWM_Get_Compare(TIM_TypeDef* TIMx, uint8 channel){
+	return (uint16)*PWM_Get_CCR(TIMx, channel);
+}
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Set_Tick_Frequency
+  * @brief 			- Recomputes the prescaler of a timer after its clock changed
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- Tick_Frequency: Counter tick frequency in HZ, as given to MCAL_PWM_Init
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The prescaler is buffered, the running period ends at the old rate without a glitch
+  * 				  Called automatically after MCAL_RCC_Select_Clock for the timers started by MCAL_PWM_Init
+  */
+void MCAL_PWM_Set_Tick_Frequency(TIM_TypeDef* TIMx, uint32 Tick_Frequency){
+	PWM_Tick_Frequency[PWM_Get_Index(TIMx)] = Tick_Frequency;
+	TIMx->PSC = (PWM_Get_Timer_Clock(TIMx) / Tick_Frequency) - 1;
+}
+
+/**=============================================
+  * @Fn				- MCAL_PWM_Enable_Update_IRQ
+  * @brief 			- Calls a function at the start of every PWM period
+  * @param [in] 	- TIMx: Pointer to the timer instance, where x can be (1..4)
+  * @param [in] 	- P_IRQ_CallBack: Function called from the timer update interrupt
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Compare values written in the callback are applied at the next period
+  */
+void MCAL_PWM_Enable_Update_IRQ(TIM_TypeDef* TIMx, void (*P_IRQ_CallBack)(void)){
+	static const uint8 Update_IRQ[4] = {TIM1_UP_IRQ, TIM2_IRQ, TIM3_IRQ, TIM4_IRQ};
+	uint8 index = PWM_Get_Index(TIMx);
+
+	GP_Update_CallBack[index] = P_IRQ_CallBack;
+
+	TIMx->SR = ~TIM_SR_UIF;
+	TIMx->DIER |= TIM_DIER_UIE;
+	MCAL_NVIC_EnableIRQ(Update_IRQ[index]);
+}
+
+/* ISRs */
+void TIM1_UP_IRQHandler(void){
+	PWM_Update_Handler(TIM1);
+}
+
+void TIM2_IRQHandler(void){
+	PWM_Update_Handler(TIM2);
+}
+
+void TIM3_IRQHandler(void){
+	PWM_Update_Handler(TIM3);
+}
+
+void TIM4_IRQHandler(void){
+	PWM_Update_Handler(TIM4);
+}
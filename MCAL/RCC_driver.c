@@ -9,6 +9,33 @@
 
 #include "RCC_driver.h"
 
+#define RCC_CR_HSION		(1UL<<0)
+#define RCC_CR_HSIRDY		(1UL<<1)
+#define RCC_CR_HSEON		(1UL<<16)
+#define RCC_CR_HSERDY		(1UL<<17)
+#define RCC_CR_PLLON		(1UL<<24)
+#define RCC_CR_PLLRDY		(1UL<<25)
+
+#define RCC_CFGR_SW_HSI		0UL
+#define RCC_CFGR_SW_HSE		1UL
+#define RCC_CFGR_SW_PLL		2UL
+#define RCC_CFGR_SW_MASK	(0b11UL)
+#define RCC_CFGR_HPRE_MASK	(0xFUL<<4)
+#define RCC_CFGR_PPRE1_MASK	(0b111UL<<8)
+#define RCC_CFGR_PPRE1_DIV2	(0b100UL<<8)
+#define RCC_CFGR_PPRE2_MASK	(0b111UL<<11)
+#define RCC_CFGR_PLLSRC		(1UL<<16)		// 0: HSI / 2, 1: HSE
+#define RCC_CFGR_PLLXTPRE	(1UL<<17)		// HSE divided by 2 before the PLL
+#define RCC_CFGR_PLLMUL_POS	18
+#define RCC_CFGR_PLLMUL_MASK	(0xFUL<<RCC_CFGR_PLLMUL_POS)
+
+#define FLASH_ACR_LATENCY_MASK	(0b111UL)
+#define FLASH_ACR_PRFTBE		(1UL<<4)	// Prefetch buffer enable
+
+#define RCC_BUS_AHB			0
+#define RCC_BUS_APB2		1
+#define RCC_BUS_APB1		2
+
 /*Bits 10:8 PPRE1: APB low-speed prescaler (APB1)
 Set and cleared by software to control the division factor of the APB low-speed clock
 (PCLK1).
@@ -33,38 +60,222 @@ Set and cleared by software to control the division factor of the AHB clock.
 1111: SYSCLK divided by 512*/
 static const uint8 AHBPrescTable[16U] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 7, 8, 9};
 
+/* Frequencies of the current configuration, computed on the first query after a clock change */
+static RCC_ClockTree_t RCC_Clock_Tree;
+static uint8 RCC_Clock_Tree_Valid = 0;
+static void (*RCC_Clock_CallBacks[RCC_MAX_CLOCK_CALLBACKS])(void);
+static uint8 RCC_Clock_CallBacks_Count = 0;
+
+/* Computes all the frequencies from one read of CFGR */
+static void RCC_Update_Clock_Tree(void){
+	uint32 cfgr = RCC->CFGR;
+	uint32 ppre1 = (cfgr >> 8) & 0b111;
+	uint32 ppre2 = (cfgr >> 11) & 0b111;
+	uint32 pll_mul;
+
+/*	Bits 3:2 SWS: System clock switch status
+	Set and cleared by hardware to indicate which clock source is used as system clock.
+	00: HSI oscillator used as system clock
+	01: HSE oscillator used as system clock
+	10: PLL used as system clock
+	11: not applicable*/
+	switch((cfgr >> 2) & 0b11){
+	case 0:
+		RCC_Clock_Tree.SYSCLK = HSI_RC_CLK;
+		break;
+	case 1:
+		RCC_Clock_Tree.SYSCLK = HSE_CLK;
+		break;
+	case 2:
+		/* PLL input is HSE (optionally divided by 2) or HSI / 2, PLLMUL 0000 is x2 up to 1111 x16 */
+		if(cfgr & RCC_CFGR_PLLSRC){
+			RCC_Clock_Tree.SYSCLK = (cfgr & RCC_CFGR_PLLXTPRE) ? (HSE_CLK / 2) : HSE_CLK;
+		}
+		else{
+			RCC_Clock_Tree.SYSCLK = HSI_RC_CLK / 2;
+		}
+		pll_mul = ((cfgr & RCC_CFGR_PLLMUL_MASK) >> RCC_CFGR_PLLMUL_POS) + 2;
+		RCC_Clock_Tree.SYSCLK *= (pll_mul > 16) ? 16 : pll_mul;
+		break;
+	default: RCC_Clock_Tree.SYSCLK = 0; break;
+	}
+
+	// Bits 7:4 HPRE: AHB prescaler, bits 10:8 PPRE1 (APB1) and bits 13:11 PPRE2 (APB2)
+	RCC_Clock_Tree.HCLK = RCC_Clock_Tree.SYSCLK >> AHBPrescTable[(cfgr >> 4) & 0xF];
+	RCC_Clock_Tree.PCLK1 = RCC_Clock_Tree.HCLK >> APBPrescTable[ppre1];
+	RCC_Clock_Tree.PCLK2 = RCC_Clock_Tree.HCLK >> APBPrescTable[ppre2];
+	/* Timers get twice the APB clock whenever the APB prescaler is not 1 */
+	RCC_Clock_Tree.TIMCLK1 = (ppre1 & 0b100) ? (RCC_Clock_Tree.PCLK1 * 2) : RCC_Clock_Tree.PCLK1;
+	RCC_Clock_Tree.TIMCLK2 = (ppre2 & 0b100) ? (RCC_Clock_Tree.PCLK2 * 2) : RCC_Clock_Tree.PCLK2;
+
+	RCC_Clock_Tree_Valid = 1;
+}
+
+static const RCC_ClockTree_t* RCC_Get_Tree(void){
+	if(!RCC_Clock_Tree_Valid){
+		RCC_Update_Clock_Tree();
+	}
+	else{ /* Do Nothing */ }
+
+	return &RCC_Clock_Tree;
+}
+
+/* Clock enable bit of each peripheral, in the order of @ref RCC_PERIPHERALS_define */
+static const struct{
+	uint8 Bus;
+	uint8 Bit;
+}RCC_Enable_Bits[RCC_PERIPHERALS_COUNT] = {
+		{RCC_BUS_APB2, 2},  {RCC_BUS_APB2, 3},  {RCC_BUS_APB2, 4},  {RCC_BUS_APB2, 5},	// GPIOA..GPIOD
+		{RCC_BUS_APB2, 6},  {RCC_BUS_APB2, 7},  {RCC_BUS_APB2, 8},  {RCC_BUS_APB2, 0},	// GPIOE..GPIOG, AFIO
+		{RCC_BUS_APB2, 14}, {RCC_BUS_APB1, 17}, {RCC_BUS_APB1, 18},						// USART1..USART3
+		{RCC_BUS_APB2, 12}, {RCC_BUS_APB1, 14},											// SPI1, SPI2
+		{RCC_BUS_APB1, 21}, {RCC_BUS_APB1, 22},											// I2C1, I2C2
+		{RCC_BUS_APB1, 29}, {RCC_BUS_AHB, 6},											// DAC, CRC
+		{RCC_BUS_APB1, 0},  {RCC_BUS_APB1, 1},  {RCC_BUS_APB1, 2},  {RCC_BUS_APB2, 11}	// TIM2..TIM4, TIM1
+};
+
+/* Number of drivers using each peripheral clock */
+static uint8 RCC_Peripheral_Users[RCC_PERIPHERALS_COUNT];
+
+/* Enable register of a peripheral, NULL for an unknown peripheral */
+static vuint32_t* RCC_Get_Enable_Register(uint8 peripheral){
+	vuint32_t* enable_reg = NULL;
+
+	if(peripheral < RCC_PERIPHERALS_COUNT){
+		switch(RCC_Enable_Bits[peripheral].Bus){
+		case RCC_BUS_AHB:	enable_reg = &RCC->AHBENR;  break;
+		case RCC_BUS_APB2:	enable_reg = &RCC->APB2ENR; break;
+		default:			enable_reg = &RCC->APB1ENR; break;
+		}
+	}
+	else{ /* Do Nothing */ }
+
+	return enable_reg;
+}
+
+/* Flash wait states needed at an HCLK frequency: 0 up to 24 MHz, 1 up to 48 MHz, 2 up to 72 MHz */
+static uint32 RCC_Flash_Latency(uint32 hclk){
+	return (hclk <= 24000000UL) ? 0 : ((hclk <= 48000000UL) ? 1 : 2);
+}
+
+/* Switches SYSCLK to an already running source together with the bus prescalers
+ * One CFGR write, so the peripheral clocks never run from the new source with the old prescalers */
+static void RCC_Switch_System_Clock(uint32 source, uint32 prescalers){
+	RCC->CFGR = (RCC->CFGR & ~(RCC_CFGR_SW_MASK | RCC_CFGR_HPRE_MASK | RCC_CFGR_PPRE1_MASK | RCC_CFGR_PPRE2_MASK)) | prescalers | source;
+	while(source != ((RCC->CFGR >> 2) & RCC_CFGR_SW_MASK));
+}
+
+/* Goes back to an 8 MHz oscillator with no wait states and undivided buses */
+static void RCC_Select_Oscillator(uint32 on_bit, uint32 ready_bit, uint32 source){
+	RCC->CR |= on_bit;
+	while(!(RCC->CR & ready_bit));
+	RCC_Switch_System_Clock(source, 0);
+	/* Wait states are only removed once the core runs slowly */
+	FLASH->ACR = (FLASH->ACR & ~FLASH_ACR_LATENCY_MASK) | FLASH_ACR_PRFTBE | RCC_Flash_Latency(HSI_RC_CLK);
+	RCC->CR &= ~RCC_CR_PLLON;
+}
+
+/* Starts the PLL on an oscillator and runs SYSCLK from it */
+static void RCC_Select_PLL(uint32 on_bit, uint32 ready_bit, uint32 source, uint32 pll_cfg, uint32 sysclk){
+	RCC->CR |= on_bit;
+	while(!(RCC->CR & ready_bit));
+
+	/* The PLL can only be configured while it is off, leave it first if it is in use */
+	if(RCC_CFGR_SW_PLL == ((RCC->CFGR >> 2) & RCC_CFGR_SW_MASK)){
+		RCC_Switch_System_Clock(source, 0);
+	}
+	else{ /* Do Nothing */ }
+	RCC->CR &= ~RCC_CR_PLLON;
+	while(RCC->CR & RCC_CR_PLLRDY);
+
+	RCC->CFGR &= ~(RCC_CFGR_PLLSRC | RCC_CFGR_PLLXTPRE | RCC_CFGR_PLLMUL_MASK);
+	RCC->CFGR |= pll_cfg;
+
+	/* Wait states must be in place before the core speeds up */
+	FLASH->ACR = (FLASH->ACR & ~FLASH_ACR_LATENCY_MASK) | FLASH_ACR_PRFTBE | RCC_Flash_Latency(sysclk);
+
+	/* The buses keep their clock while the PLL locks, AHB and APB2 not divided, APB1 kept under 36 MHz */
+	RCC->CR |= RCC_CR_PLLON;
+	while(!(RCC->CR & RCC_CR_PLLRDY));
+	RCC_Switch_System_Clock(RCC_CFGR_SW_PLL, (sysclk > RCC_APB1_MAX_FREQ) ? RCC_CFGR_PPRE1_DIV2 : 0);
+}
+
 /**=============================================
   * @Fn				- MCAL_RCC_Select_Clock
   * @brief 			- Sets the clock source of the MCU
   * @param [in] 	- clock: Select the clock source from @ref RCC_CLOCK_SOURCE_define
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- Also sets the flash wait states and prefetch, and divides APB1 to stay under 36 MHz
+  * 				  The callbacks of MCAL_RCC_Add_Clock_CallBack are called once the new clock runs
   */
 void MCAL_RCC_Select_Clock(uint8 clock){
+	uint8 index;
+
 	switch(clock){
 	case RCC_SELECT_HSI:
-		RCC->CR |= (1<<0); 				  			// internal 8 MHz RC oscillator ON
-		while(!((RCC->CR >> 1) & 0x01U)); 			// wait until internal clock is ready
-		RCC->CFGR &= ~(0b11UL);			  			// 00: HSI selected as system clock
-		while(0x00 != ((RCC->CFGR >> 2) & 0x03UL)); // Wait until HSI is the clock source
-		RCC->CR &= ~(1UL<<16);						// 0: HSE oscillator OFF
-		RCC->CR &= ~(1UL<<24);						// 0: PLL OFF
+		RCC_Select_Oscillator(RCC_CR_HSION, RCC_CR_HSIRDY, RCC_CFGR_SW_HSI);	// internal 8 MHz RC oscillator
+		RCC->CR &= ~RCC_CR_HSEON;												// 0: HSE oscillator OFF
 		break;
 	case RCC_SELECT_HSE:
-		RCC->CR |= (1<<16); 				  		// 1: HSE oscillator ON
-		while(!((RCC->CR >> 17) & 0x01U)); 			// wait until external clock is ready
-		RCC->CFGR &= ~(0b11UL);			  			// Clear previous clock selection
-		RCC->CFGR |= 0x01UL;						// Set External oscillator HSE as clock source
-		while(0x01 != ((RCC->CFGR >> 2) & 0x03UL)); // Wait until HSE is the clock source
-		RCC->CR &= ~(1UL<<0);						// 0: internal 8 MHz RC oscillator OFF
-		RCC->CR &= ~(1UL<<24);						// 0: PLL OFF
+		RCC_Select_Oscillator(RCC_CR_HSEON, RCC_CR_HSERDY, RCC_CFGR_SW_HSE);	// External oscillator HSE
+		RCC->CR &= ~RCC_CR_HSION;												// 0: internal 8 MHz RC oscillator OFF
 		break;
 	case RCC_SELECT_PLL:
-		/* TODO: Implement PLL Configuration */
+		/* 8 MHz HSE x 9 = 72 MHz */
+		RCC_Select_PLL(RCC_CR_HSEON, RCC_CR_HSERDY, RCC_CFGR_SW_HSE,
+				RCC_CFGR_PLLSRC | ((RCC_PLL_HSE_MUL - 2UL) << RCC_CFGR_PLLMUL_POS), HSE_CLK * RCC_PLL_HSE_MUL);
+		RCC->CR &= ~RCC_CR_HSION;
+		break;
+	case RCC_SELECT_PLL_HSI:
+		/* 8 MHz HSI / 2 x 16 = 64 MHz */
+		RCC_Select_PLL(RCC_CR_HSION, RCC_CR_HSIRDY, RCC_CFGR_SW_HSI,
+				((RCC_PLL_HSI_MUL - 2UL) << RCC_CFGR_PLLMUL_POS), (HSI_RC_CLK / 2) * RCC_PLL_HSI_MUL);
+		RCC->CR &= ~RCC_CR_HSEON;
 		break;
 	default: /* Do Nothing */ break;
 	}
+
+	/* The cached frequencies are stale, the dependent drivers re-derive their dividers */
+	RCC_Clock_Tree_Valid = 0;
+	for(index = 0; index < RCC_Clock_CallBacks_Count; index++){
+		RCC_Clock_CallBacks[index]();
+	}
+}
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Enable_HSI
+  * @brief 			- Starts the internal 8 MHz RC oscillator without changing the system clock
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- 1 if it was already running, 0 if it was started
+  * Note			- Needed by the flash program/erase controller
+  */
+uint8 MCAL_RCC_Enable_HSI(void){
+	uint8 was_on = (RCC->CR & RCC_CR_HSION) ? 1 : 0;
+
+	RCC->CR |= RCC_CR_HSION;
+	while(!(RCC->CR & RCC_CR_HSIRDY));
+
+	return was_on;
+}
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Disable_HSI
+  * @brief 			- Stops the internal 8 MHz RC oscillator
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Does nothing if the system clock runs from it
+  */
+void MCAL_RCC_Disable_HSI(void){
+	uint32 sws = (RCC->CFGR >> 2) & RCC_CFGR_SW_MASK;
+
+	/* SYSCLK from HSI, or from the PLL fed by HSI / 2 */
+	if((RCC_CFGR_SW_HSI != sws) && !((RCC_CFGR_SW_PLL == sws) && !(RCC->CFGR & RCC_CFGR_PLLSRC))){
+		RCC->CR &= ~RCC_CR_HSION;
+	}
+	else{ /* Do Nothing */ }
 }
 
 /**=============================================
@@ -73,30 +284,92 @@ void MCAL_RCC_Select_Clock(uint8 clock){
   * @param [in] 	- peripheral: Select the peripheral from @ref RCC_PERIPHERALS_define
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- Not reference counted, drivers use MCAL_RCC_Acquire_Peripheral
   */
 void MCAL_RCC_Enable_Peripheral(uint8 peripheral){
-	switch(peripheral){
-	case RCC_GPIOA: 	RCC->APB2ENR |= (1<<2);  break;
-	case RCC_GPIOB: 	RCC->APB2ENR |= (1<<3);  break;
-	case RCC_GPIOC: 	RCC->APB2ENR |= (1<<4);  break;
-	case RCC_GPIOD: 	RCC->APB2ENR |= (1<<5);  break;
-	case RCC_GPIOE: 	RCC->APB2ENR |= (1<<6);  break;
-	case RCC_GPIOF: 	RCC->APB2ENR |= (1<<7);  break;
-	case RCC_GPIOG: 	RCC->APB2ENR |= (1<<8);  break;
-	case RCC_AFIO:		RCC->APB2ENR |= (1<<0);  break;
-	case RCC_USART1:	RCC->APB2ENR |= (1<<14); break;
-	case RCC_USART2:	RCC->APB1ENR |= (1<<17); break;
-	case RCC_USART3:	RCC->APB1ENR |= (1<<18); break;
-	case RCC_SPI1:		RCC->APB2ENR |= (1<<12); break;
-	case RCC_SPI2:		RCC->APB1ENR |= (1<<14); break;
-	case RCC_I2C1:		RCC->APB1ENR |= (1<<21); break;
-	case RCC_I2C2:		RCC->APB1ENR |= (1<<22); break;
-	case RCC_DAC:		RCC->APB1ENR |= (1<<29); break;
-	case RCC_CRC:		RCC->AHBENR	 |= (1<<6);  break;
-	case RCC_TIM2:		RCC->APB1ENR |= (1<<0);  break;
-	default: /* Do Nothing */ break;
+	vuint32_t* enable_reg = RCC_Get_Enable_Register(peripheral);
+
+	if(NULL != enable_reg){
+		*enable_reg |= (1UL << RCC_Enable_Bits[peripheral].Bit);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Disable_Peripheral
+  * @brief 			- Disable the clock of a specific peripheral
+  * @param [in] 	- peripheral: Select the peripheral from @ref RCC_PERIPHERALS_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- The registers keep their values but cannot be accessed until the clock is enabled again
+  */
+void MCAL_RCC_Disable_Peripheral(uint8 peripheral){
+	vuint32_t* enable_reg = RCC_Get_Enable_Register(peripheral);
+
+	if(NULL != enable_reg){
+		*enable_reg &= ~(1UL << RCC_Enable_Bits[peripheral].Bit);
 	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Acquire_Peripheral
+  * @brief 			- Takes a reference on the clock of a peripheral, the first one enables it
+  * @param [in] 	- peripheral: Select the peripheral from @ref RCC_PERIPHERALS_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Every acquire must be matched by one MCAL_RCC_Release_Peripheral, main context only
+  */
+void MCAL_RCC_Acquire_Peripheral(uint8 peripheral){
+	if(peripheral < RCC_PERIPHERALS_COUNT){
+		if(RCC_Peripheral_Users[peripheral] < 0xFF){
+			RCC_Peripheral_Users[peripheral]++;
+		}
+		else{ /* Do Nothing */ }
+		MCAL_RCC_Enable_Peripheral(peripheral);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Release_Peripheral
+  * @brief 			- Drops a reference on the clock of a peripheral, the clock is gated off with the last one
+  * @param [in] 	- peripheral: Select the peripheral from @ref RCC_PERIPHERALS_define
+  * @param [out] 	- None
+  * @retval 		- None
+  * Note			- Releasing a peripheral that was never acquired does nothing, main context only
+  */
+void MCAL_RCC_Release_Peripheral(uint8 peripheral){
+	if((peripheral < RCC_PERIPHERALS_COUNT) && (RCC_Peripheral_Users[peripheral] > 0)){
+		RCC_Peripheral_Users[peripheral]--;
+		if(0 == RCC_Peripheral_Users[peripheral]){
+			MCAL_RCC_Disable_Peripheral(peripheral);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Get_Clocked_Peripherals
+  * @brief 			- Reports which peripherals currently have their clock enabled
+  * @param [in] 	- None
+  * @param [out] 	- None
+  * @retval 		- Bit n is set when the clock of peripheral n @ref RCC_PERIPHERALS_define is on
+  * Note			- Read from the enable registers, so clocks enabled without an acquire are reported too
+  */
+uint32 MCAL_RCC_Get_Clocked_Peripherals(void){
+	uint32 clocked = 0;
+	uint8 peripheral;
+
+	for(peripheral = 0; peripheral < RCC_PERIPHERALS_COUNT; peripheral++){
+		if(*RCC_Get_Enable_Register(peripheral) & (1UL << RCC_Enable_Bits[peripheral].Bit)){
+			clocked |= (1UL << peripheral);
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	return clocked;
 }
 
 /**=============================================
@@ -108,26 +381,39 @@ void MCAL_RCC_Enable_Peripheral(uint8 peripheral){
   * Note			- None
   */
 void MCAL_RCC_Reset_Peripheral(uint8 peripheral){
+	vuint32_t* reset_reg = NULL;
+	uint32 reset_bit = 0;
+
 	switch(peripheral){
-	case RCC_GPIOA: 	RCC->APB2RSTR |= (1<<2);  break;
-	case RCC_GPIOB: 	RCC->APB2RSTR |= (1<<3);  break;
-	case RCC_GPIOC: 	RCC->APB2RSTR |= (1<<4);  break;
-	case RCC_GPIOD: 	RCC->APB2RSTR |= (1<<5);  break;
-	case RCC_GPIOE: 	RCC->APB2RSTR |= (1<<6);  break;
-	case RCC_GPIOF: 	RCC->APB2RSTR |= (1<<7);  break;
-	case RCC_GPIOG: 	RCC->APB2RSTR |= (1<<8);  break;
-	case RCC_AFIO:		RCC->APB2RSTR |= (1<<0);  break;
-	case RCC_USART1:	RCC->APB2RSTR |= (1<<14); break;
-	case RCC_USART2:	RCC->APB1RSTR |= (1<<17); break;
-	case RCC_USART3:	RCC->APB1RSTR |= (1<<18); break;
-	case RCC_SPI1:		RCC->APB2RSTR |= (1<<12); break;
-	case RCC_SPI2:		RCC->APB1RSTR |= (1<<14); break;
-	case RCC_I2C1:		RCC->APB1RSTR |= (1<<21); break;
-	case RCC_I2C2:		RCC->APB1RSTR |= (1<<22); break;
-	case RCC_DAC:		RCC->APB1RSTR |= (1<<29); break;
-	case RCC_TIM2:		RCC->APB1RSTR |= (1<<0);  break;
+	case RCC_GPIOA: 	reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<2);   break;
+	case RCC_GPIOB: 	reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<3);   break;
+	case RCC_GPIOC: 	reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<4);   break;
+	case RCC_GPIOD: 	reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<5);   break;
+	case RCC_GPIOE: 	reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<6);   break;
+	case RCC_GPIOF: 	reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<7);   break;
+	case RCC_GPIOG: 	reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<8);   break;
+	case RCC_AFIO:		reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<0);   break;
+	case RCC_USART1:	reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<14);  break;
+	case RCC_USART2:	reset_reg = &RCC->APB1RSTR; reset_bit = (1UL<<17);  break;
+	case RCC_USART3:	reset_reg = &RCC->APB1RSTR; reset_bit = (1UL<<18);  break;
+	case RCC_SPI1:		reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<12);  break;
+	case RCC_SPI2:		reset_reg = &RCC->APB1RSTR; reset_bit = (1UL<<14);  break;
+	case RCC_I2C1:		reset_reg = &RCC->APB1RSTR; reset_bit = (1UL<<21);  break;
+	case RCC_I2C2:		reset_reg = &RCC->APB1RSTR; reset_bit = (1UL<<22);  break;
+	case RCC_DAC:		reset_reg = &RCC->APB1RSTR; reset_bit = (1UL<<29);  break;
+	case RCC_TIM2:		reset_reg = &RCC->APB1RSTR; reset_bit = (1UL<<0);   break;
+	case RCC_TIM3:		reset_reg = &RCC->APB1RSTR; reset_bit = (1UL<<1);   break;
+	case RCC_TIM4:		reset_reg = &RCC->APB1RSTR; reset_bit = (1UL<<2);   break;
+	case RCC_TIM1:		reset_reg = &RCC->APB2RSTR; reset_bit = (1UL<<11);  break;
 	default: /* Do Nothing */ break;
 	}
+
+	/* The peripheral stays in reset while the bit is set */
+	if(NULL != reset_reg){
+		*reset_reg |= reset_bit;
+		*reset_reg &= ~reset_bit;
+	}
+	else{ /* Do Nothing */ }
 }
 
 /**=============================================
@@ -139,27 +425,7 @@ void MCAL_RCC_Reset_Peripheral(uint8 peripheral){
   * Note			- None
   */
 uint32 MCAL_RCC_GetSYS_CLKFreq(void){
-/*	Bits 3:2 SWS: System clock switch status
-	Set and cleared by hardware to indicate which clock source is used as system clock.
-	00: HSI oscillator used as system clock
-	01: HSE oscillator used as system clock
-	10: PLL used as system clock
-	11: not applicable*/
-	uint32 ret_val;
-	switch((RCC->CFGR >> 2 & 0b11)){
-	case 0:
-		ret_val = HSI_RC_CLK;
-		break;
-	case 1:
-		ret_val = HSE_CLK;
-		break;
-	case 2:
-		/* TODO: Need to calculate the PLLCLK and PLLMUL and PLL Source MUX */
-		ret_val = 16000000UL;
-		break;
-	default: ret_val = 0; break;
-	}
-	return ret_val;
+	return RCC_Get_Tree()->SYSCLK;
 }
 
 /**=============================================
@@ -171,8 +437,7 @@ uint32 MCAL_RCC_GetSYS_CLKFreq(void){
   * Note			- None
   */
 uint32 MCAL_RCC_GetHCLKFreq(void){
-	// Bits 7:4 HPRE: AHB prescaler
-	return (MCAL_RCC_GetSYS_CLKFreq() >> AHBPrescTable[((RCC->CFGR >> 4) & 0b111)]);
+	return RCC_Get_Tree()->HCLK;
 }
 
 /**=============================================
@@ -184,12 +449,11 @@ uint32 MCAL_RCC_GetHCLKFreq(void){
   * Note			- None
   */
 uint32 MCAL_RCC_GetPCLK1Freq(void){
-	// Bits 10:8 PPRE1: APB low-speed prescaler (APB1)
-	return (MCAL_RCC_GetSYS_CLKFreq() >> APBPrescTable[((RCC->CFGR >> 8) & 0b111)]);
+	return RCC_Get_Tree()->PCLK1;
 }
 
 /**=============================================
-  * @Fn				- MCAL_RCC_GetPCLK1Freq
+  * @Fn				- MCAL_RCC_GetPCLK2Freq
   * @brief 			- Gets the frequency of the APB2 bus clock in HZ
   * @param [in] 	- None
   * @param [out] 	- None
@@ -197,6 +461,44 @@ uint32 MCAL_RCC_GetPCLK1Freq(void){
   * Note			- None
   */
 uint32 MCAL_RCC_GetPCLK2Freq(void){
-	// Bits 13:11 PPRE2: APB high-speed prescaler (APB2)
-	return (MCAL_RCC_GetSYS_CLKFreq() >> APBPrescTable[((RCC->CFGR >> 11) & 0b111)]);
+	return RCC_Get_Tree()->PCLK2;
+}
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Get_Clock_Tree
+  * @brief 			- Reads all the bus and timer clock frequencies in HZ from the current configuration
+  * @param [out] 	- tree: Pointer to the structure receiving the frequencies
+  * @retval 		- None
+  * Note			- Drivers derive their dividers (SysTick reload, timer prescalers, USART BRR) from it
+  * 				  The frequencies are cached, CFGR is only read again after MCAL_RCC_Select_Clock
+  */
+void MCAL_RCC_Get_Clock_Tree(RCC_ClockTree_t* tree){
+	*tree = *RCC_Get_Tree();
+}
+
+/**=============================================
+  * @Fn				- MCAL_RCC_Add_Clock_CallBack
+  * @brief 			- Registers a function called after every system clock change
+  * @param [in] 	- CallBack: Function re-deriving the dividers of a driver from MCAL_RCC_Get_Clock_Tree
+  * @param [out] 	- None
+  * @retval 		- 1 if registered, 0 if the callback table is full
+  * Note			- Called from MCAL_RCC_Select_Clock in registration order, a function is only registered once
+  */
+uint8 MCAL_RCC_Add_Clock_CallBack(void (*CallBack)(void)){
+	uint8 index;
+	uint8 added = 0;
+
+	for(index = 0; (index < RCC_Clock_CallBacks_Count) && (RCC_Clock_CallBacks[index] != CallBack); index++);
+
+	if(index < RCC_Clock_CallBacks_Count){
+		added = 1;
+	}
+	else if((NULL != CallBack) && (RCC_Clock_CallBacks_Count < RCC_MAX_CLOCK_CALLBACKS)){
+		RCC_Clock_CallBacks[RCC_Clock_CallBacks_Count] = CallBack;
+		RCC_Clock_CallBacks_Count++;
+		added = 1;
+	}
+	else{ /* Do Nothing */ }
+
+	return added;
 }
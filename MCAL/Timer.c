@@ -11,17 +11,47 @@
 
 void Timer2_init(void)
 {
-	RCC_APB1ENR |=(1<<0);     //Enable Rcc for tim2
-	TIM2_PSC = 7;             //Clk_input=(8M/(7+1))=1MHZ
+	RCC_ClockTree_t tree;
+	MCAL_RCC_Get_Clock_Tree(&tree);
+
+	MCAL_RCC_Acquire_Peripheral(RCC_TIM2);     //Enable Rcc for tim2
+	TIM2_PSC = (tree.TIMCLK1 / 1000000UL) - 1;   //Clk_input=(TIMCLK1/(PSC+1))=1MHZ
 	TIM2_ARR = 0xC350;        //to make interrupt after 50000 tike(50000*10^-6)=0.05s
 	TIM2_CR1 |=(1<<0);
 	while(!(TIM2_SR)&(1<<0));
+	MCAL_RCC_Add_Clock_CallBack(Timer2_Reclock);   //keeps the 1MHZ tick after a clock change
+}
+
+void Timer2_Reclock(void)
+{
+	RCC_ClockTree_t tree;
+	MCAL_RCC_Get_Clock_Tree(&tree);
+
+	TIM2_PSC = (tree.TIMCLK1 / 1000000UL) - 1;   //back to 1MHZ
+	TIM2_EGR = (1<<0);                           //UG: load the prescaler now, not after 0.05s
 }
 
 void dus(int us)
 {
+	uint32 last=0, now, waited=0;
 	TIM2_CNT=0;
-	while(TIM2_CNT<us);
+	while(waited<=(uint32)us)   //CNT=0 keeps the prescaler count, the first tick may come at once: us+1 ticks are at least us microseconds
+	{
+		now=TIM2_CNT;
+		waited+=(now>=last) ? (now-last) : (now+TIM2_ARR+1-last);   //CNT wraps to 0 after ARR, the ticks are added up so 50ms and longer waits end too
+		last=now;
+	}
+}
+
+uint32 Timer2_Get_us(void)
+{
+	return TIM2_CNT;
+}
+
+uint32 Timer2_Elapsed_us(uint32 since)
+{
+	uint32 now=TIM2_CNT;
+	return (now>=since) ? (now-since) : (now+TIM2_ARR+1-since);   //CNT wraps to 0 after ARR
 }
 
 void dms(int ms)
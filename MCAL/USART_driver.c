@@ -20,28 +20,67 @@
 /* Variables */
 static USART_cfg_t Global_USART_cfg[3];
 
+/* ISRs */
+void USART1_IRQHandler(void);
+void USART2_IRQHandler(void);
+void USART3_IRQHandler(void);
+
+/* Index of a USART instance in Global_USART_cfg, 3 if unknown */
+static uint8 USART_Get_Index(USART_TypeDef* USARTx){
+	return (USART1 == USARTx) ? 0 : ((USART2 == USARTx) ? 1 : ((USART3 == USARTx) ? 2 : 3));
+}
+
+/* Clock change callback, every initialized USART keeps its baudrate */
+static void USART_Clock_CallBack(void){
+	MCAL_USART_Reclock(USART1);
+	MCAL_USART_Reclock(USART2);
+	MCAL_USART_Reclock(USART3);
+}
+
+/* With the vector table in SRAM the core calls the user callback directly,
+ * otherwise (or without callback) the fixed ISR stays in the vector
+ * The ClearPendingIRQ of the fixed ISR is not needed on that path: the core clears the
+ * pending bit when it takes the interrupt, and the USART line is level sensitive, an
+ * event still set when the callback returns pends it again whatever was cleared */
+static void USART_Install_Vector(uint8 index, uint8 IRQn, void (*fixed_handler)(void)){
+	if(NULL != Global_USART_cfg[index].P_IRQ_CallBack){
+		MCAL_NVIC_SetHandler(IRQn, Global_USART_cfg[index].P_IRQ_CallBack);
+	}
+	else{
+		MCAL_NVIC_SetHandler(IRQn, fixed_handler);
+	}
+}
+
+/* BRR value of a baudrate from the current APB clock, PCLK2 for USART1 and PCLK1 for USART2, 3 */
+static uint32 USART_Get_BRR(USART_TypeDef* USARTx, uint32 baudrate){
+	RCC_ClockTree_t tree;
+
+	MCAL_RCC_Get_Clock_Tree(&tree);
+	return UART_BRR_REGISTER(((USART1 == USARTx) ? tree.PCLK2 : tree.PCLK1), baudrate);
+}
+
 /**=============================================
   * @Fn				- MCAL_USART_Init
   * @brief 			- Initializes UART (Supported feature Asynchronous only)
   * @param [in] 	- USARTx: Pointer to the USART peripheral instance, where x can be (1..3 depending on device used)
   * @param [in] 	- USART_cfg: Pointer to the UART configuration
   * @retval 		- None
-  * Note			- Support for now asynchronous mode and clock 8MHZ
+  * Note			- Support for now asynchronous mode, BRR is derived from the APB clock in MCAL_RCC_Get_Clock_Tree
   */
 void MCAL_USART_Init(USART_TypeDef* USARTx, USART_cfg_t* USART_cfg){
-	uint32 BRR, pclk;
+	uint32 BRR;
 
 	/* Enable clock for given USART peripheral */
 	if(USART1 == USARTx){
-		MCAL_RCC_Enable_Peripheral(RCC_USART1);
+		MCAL_RCC_Acquire_Peripheral(RCC_USART1);
 		Global_USART_cfg[0] = *USART_cfg;
 	}
 	else if(USART2 == USARTx){
-		MCAL_RCC_Enable_Peripheral(RCC_USART2);
+		MCAL_RCC_Acquire_Peripheral(RCC_USART2);
 		Global_USART_cfg[1] = *USART_cfg;
 	}
 	else if(USART3 == USARTx){
-		MCAL_RCC_Enable_Peripheral(RCC_USART3);
+		MCAL_RCC_Acquire_Peripheral(RCC_USART3);
 		Global_USART_cfg[2] = *USART_cfg;
 	}
 	else{ /* Do Nothing */ }
@@ -68,14 +107,9 @@ void MCAL_USART_Init(USART_TypeDef* USARTx, USART_cfg_t* USART_cfg){
 	 * PCLK1 for USART2, 3
 	 * PCLK2 for USART1
 	 */
-	  if(USART1 == USARTx){
-		  pclk = MCAL_RCC_GetPCLK2Freq();
-	  }
-	  else{
-		  pclk = MCAL_RCC_GetPCLK1Freq();
-	  }
-	  BRR = UART_BRR_REGISTER(pclk, USART_cfg->BaudRate);
+	  BRR = USART_Get_BRR(USARTx, USART_cfg->BaudRate);
 	  USARTx->BRR = BRR;
+	  MCAL_RCC_Add_Clock_CallBack(USART_Clock_CallBack);
 
 	  /* Configure interrupts */
 	  if(UART_IRQ_Enable_NONE != USART_cfg->IRQ_Enable){
@@ -83,12 +117,15 @@ void MCAL_USART_Init(USART_TypeDef* USARTx, USART_cfg_t* USART_cfg){
 
 		  /* Enable NVIC for USARTx IRQ */
 		  if(USART1 == USARTx){
+			  USART_Install_Vector(0, USART1_IRQ, USART1_IRQHandler);
 			  MCAL_NVIC_EnableIRQ(USART1_IRQ);
 		  }
 		  else if(USART2 == USARTx){
+			  USART_Install_Vector(1, USART2_IRQ, USART2_IRQHandler);
 			  MCAL_NVIC_EnableIRQ(USART2_IRQ);
 		  }
 		  else if(USART3 == USARTx){
+			  USART_Install_Vector(2, USART3_IRQ, USART3_IRQHandler);
 			  MCAL_NVIC_EnableIRQ(USART3_IRQ);
 		  }
 		  else{ /* Do Nothing */ }
@@ -103,21 +140,37 @@ void MCAL_USART_Init(USART_TypeDef* USARTx, USART_cfg_t* USART_cfg){
   * @brief 			- DeInitializes UART (Supported feature Asynchronous only)
   * @param [in] 	- USARTx: Pointer to the USART peripheral instance, where x can be (1..3 depending on device used)
   * @retval 		- None
-  * Note			- Reset the model by RCC
+  * Note			- Reset the model by RCC and release its clocks
   */
 void MCAL_USART_DeInit(USART_TypeDef* USARTx){
 
+	/* The clocks taken by MCAL_USART_Init and MCAL_USART_GPIO_Set_Pins are released */
 	if(USART1 == USARTx){
 		MCAL_RCC_Reset_Peripheral(RCC_USART1);
 		MCAL_NVIC_DisableIRQ(USART1_IRQ);
+		MCAL_NVIC_SetHandler(USART1_IRQ, USART1_IRQHandler);
+		MCAL_RCC_Release_Peripheral(RCC_USART1);
+		MCAL_RCC_Release_Peripheral(RCC_GPIOA);
 	}
 	else if(USART2 == USARTx){
 		MCAL_RCC_Reset_Peripheral(RCC_USART2);
 		MCAL_NVIC_DisableIRQ(USART2_IRQ);
+		MCAL_NVIC_SetHandler(USART2_IRQ, USART2_IRQHandler);
+		MCAL_RCC_Release_Peripheral(RCC_USART2);
+		MCAL_RCC_Release_Peripheral(RCC_GPIOA);
 	}
 	else if(USART3 == USARTx){
 		MCAL_RCC_Reset_Peripheral(RCC_USART3);
 		MCAL_NVIC_DisableIRQ(USART3_IRQ);
+		MCAL_NVIC_SetHandler(USART3_IRQ, USART3_IRQHandler);
+		MCAL_RCC_Release_Peripheral(RCC_USART3);
+		MCAL_RCC_Release_Peripheral(RCC_GPIOB);
+	}
+	else{ /* Do Nothing */ }
+
+	/* No baudrate to keep across clock changes anymore */
+	if(USART_Get_Index(USARTx) < 3){
+		Global_USART_cfg[USART_Get_Index(USARTx)].BaudRate = 0;
 	}
 	else{ /* Do Nothing */ }
 
@@ -141,7 +194,7 @@ void MCAL_USART_GPIO_Set_Pins(USART_TypeDef* USARTx){
 		 * PA11 CTS
 		 * PA12 RTS
 		 */
-		MCAL_RCC_Enable_Peripheral(RCC_GPIOA);
+		MCAL_RCC_Acquire_Peripheral(RCC_GPIOA);
 		// PA9 TX
 		PinCfg.GPIO_PinNumber = GPIO_PIN_9;
 		PinCfg.GPIO_MODE = GPIO_MODE_OUTPUT_AF_PP;
@@ -177,7 +230,7 @@ void MCAL_USART_GPIO_Set_Pins(USART_TypeDef* USARTx){
 		 * PA0 CTS
 		 * PA1 RTS
 		 */
-		MCAL_RCC_Enable_Peripheral(RCC_GPIOA);
+		MCAL_RCC_Acquire_Peripheral(RCC_GPIOA);
 		// PA2 TX
 		PinCfg.GPIO_PinNumber = GPIO_PIN_2;
 		PinCfg.GPIO_MODE = GPIO_MODE_OUTPUT_AF_PP;
@@ -213,7 +266,7 @@ void MCAL_USART_GPIO_Set_Pins(USART_TypeDef* USARTx){
 		 * PB13 CTS
 		 * PB14 RTS
 		 */
-		MCAL_RCC_Enable_Peripheral(RCC_GPIOB);
+		MCAL_RCC_Acquire_Peripheral(RCC_GPIOB);
 		// PB10 TX
 		PinCfg.GPIO_PinNumber = GPIO_PIN_10;
 		PinCfg.GPIO_MODE = GPIO_MODE_OUTPUT_AF_PP;
@@ -459,6 +512,58 @@ void MCAL_USART_Wait_TC(USART_TypeDef* USARTx){
 	while(! (USARTx->SR & (1<<6)));
 }
 
+/**=============================================
+  * @Fn				- MCAL_USART_Reclock
+  * @brief 			- Recomputes the baudrate register after the APB clock changed
+  * @param [in] 	- USARTx: Pointer to the USART peripheral instance, where x can be (1..3 depending on device used)
+  * @retval 		- None
+  * Note			- Called automatically after MCAL_RCC_Select_Clock, bits received in between are sampled at the old rate
+  */
+void MCAL_USART_Reclock(USART_TypeDef* USARTx){
+	uint8 index = USART_Get_Index(USARTx);
+
+	if((index < 3) && (Global_USART_cfg[index].BaudRate > 0)){
+		USARTx->BRR = USART_Get_BRR(USARTx, Global_USART_cfg[index].BaudRate);
+	}
+	else{ /* Do Nothing */ }
+}
+
+/**=============================================
+  * @Fn				- MCAL_USART_Get_BaudRate
+  * @brief 			- Returns the baudrate given to MCAL_USART_Init
+  * @param [in] 	- USARTx: Pointer to the USART peripheral instance, where x can be (1..3 depending on device used)
+  * @retval 		- Baudrate in bits per second, 0 if the USART was not initialized
+  * Note			- None
+  */
+uint32 MCAL_USART_Get_BaudRate(USART_TypeDef* USARTx){
+	uint8 index = USART_Get_Index(USARTx);
+
+	return (index < 3) ? Global_USART_cfg[index].BaudRate : 0;
+}
+
+/**=============================================
+  * @Fn				- MCAL_USART_Get_RX_Level
+  * @brief 			- Reads the level of the RX pin
+  * @param [in] 	- USARTx: Pointer to the USART peripheral instance, where x can be (1..3 depending on device used)
+  * @retval 		- 1 when the line is high (idle or a 1 bit), 0 when low
+  * Note			- The line is idle once it stays high for a whole frame
+  */
+uint8 MCAL_USART_Get_RX_Level(USART_TypeDef* USARTx){
+	uint8 level;
+
+	if(USART1 == USARTx){
+		level = MCAL_GPIO_ReadPin(GPIOA, GPIO_PIN_10);
+	}
+	else if(USART2 == USARTx){
+		level = MCAL_GPIO_ReadPin(GPIOA, GPIO_PIN_3);
+	}
+	else{
+		level = MCAL_GPIO_ReadPin(GPIOB, GPIO_PIN_11);
+	}
+
+	return level;
+}
+
 /* ISRs */
 void USART1_IRQHandler(void){
 	MCAL_NVIC_ClearPendingIRQ(USART1_IRQ);
@@ -9,42 +9,35 @@
 
 #include "gpio_driver.h"
 
+/* Position of a single pin in CRL/CRH, 4 bits per pin, pins 8...15 start again from 0 in CRH */
 static uint8 Get_CRLH_Position(uint16 PinNumber){
-	switch(PinNumber){
-	case GPIO_PIN_0:
-	case GPIO_PIN_8:
-		return 0;
-		break;
-	case GPIO_PIN_1:
-	case GPIO_PIN_9:
-		return 4;
-		break;
-	case GPIO_PIN_2:
-	case GPIO_PIN_10:
-		return 8;
-		break;
-	case GPIO_PIN_3:
-	case GPIO_PIN_11:
-		return 12;
-		break;
-	case GPIO_PIN_4:
-	case GPIO_PIN_12:
-		return 16;
+	return (uint8)((__builtin_ctz(PinNumber) & 7) << 2);
+}
+
+/* Returns the 4 bits CNF/MODE value of a pin in CRL/CRH */
+static uint8 GPIO_Get_Config_Bits(uint8 Mode, uint8 Speed){
+	uint8 Config_Bits = 0;
+	/* Check if pin is input or output */
+	switch(Mode){
+	case GPIO_MODE_OUTPUT_PP:
+	case GPIO_MODE_OUTPUT_OD:
+	case GPIO_MODE_OUTPUT_AF_PP:
+	case GPIO_MODE_OUTPUT_AF_OD:
+		Config_Bits = ((((Mode - 4) << 2) | (Speed)) & 0x0F);
 		break;
-	case GPIO_PIN_5:
-	case GPIO_PIN_13:
-		return 20;
+	case GPIO_MODE_ANALOG:
+	case GPIO_MODE_INPUT_FLO:
+		Config_Bits = ((Mode << 2) & 0x0F);
 		break;
-	case GPIO_PIN_6:
-	case GPIO_PIN_14:
-		return 24;
+	case GPIO_MODE_INPUT_PU:
+	case GPIO_MODE_INPUT_PD:
+		Config_Bits = 0x08;
 		break;
-	case GPIO_PIN_7:
-	case GPIO_PIN_15:
-		return 28;
+	case GPIO_MODE_AF_INPUT:
+		Config_Bits = ((GPIO_MODE_INPUT_FLO << 2) & 0x0F);
 		break;
-	default: return 55;
 	}
+	return Config_Bits;
 }
 
 /**=============================================
@@ -64,33 +57,60 @@ void MCAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_PinConfig_t *PinConfig){
 	vuint32_t *ConfigReg = NULL;
 	ConfigReg = (PinConfig->GPIO_PinNumber < GPIO_PIN_8) ? (&GPIOx->CRL) : (&GPIOx->CRH);
 	uint8 Pin_Pos = Get_CRLH_Position(PinConfig->GPIO_PinNumber); // Get pin position in CR register
-	(*ConfigReg) &= ~(0xF << Pin_Pos);
-	uint8 Temp_PinConfig = 0;
-	/* Check if pin is input or output */
-	switch(PinConfig->GPIO_MODE){
-	case GPIO_MODE_OUTPUT_PP:
-	case GPIO_MODE_OUTPUT_OD:
-	case GPIO_MODE_OUTPUT_AF_PP:
-	case GPIO_MODE_OUTPUT_AF_OD:
-		Temp_PinConfig = ((((PinConfig->GPIO_MODE - 4) << 2) | (PinConfig->GPIO_OUTPUT_SPEED)) & 0x0F);
-		break;
-	case GPIO_MODE_ANALOG:
-	case GPIO_MODE_INPUT_FLO:
-		Temp_PinConfig = ((PinConfig->GPIO_MODE << 2) & 0x0F);
-		break;
-	case GPIO_MODE_INPUT_PU:
-		Temp_PinConfig = 0x08;
+	(*ConfigReg) &= ~(0xFUL << Pin_Pos);
+	uint8 Temp_PinConfig = GPIO_Get_Config_Bits(PinConfig->GPIO_MODE, PinConfig->GPIO_OUTPUT_SPEED);
+	/* Input pull up/down is selected by the ODR bit */
+	if(GPIO_MODE_INPUT_PU == PinConfig->GPIO_MODE){
 		GPIOx->ODR |= PinConfig->GPIO_PinNumber;
-		break;
-	case GPIO_MODE_INPUT_PD:
-		Temp_PinConfig = 0x08;
+	}
+	else if(GPIO_MODE_INPUT_PD == PinConfig->GPIO_MODE){
 		GPIOx->ODR &= ~(PinConfig->GPIO_PinNumber);
-		break;
-	case GPIO_MODE_AF_INPUT:
-		Temp_PinConfig = ((GPIO_MODE_INPUT_FLO << 2) & 0x0F);
-		break;
 	}
-	(*ConfigReg) |= (Temp_PinConfig << Pin_Pos);
+	else{ /* Do Nothing */ }
+	(*ConfigReg) |= ((uint32)Temp_PinConfig << Pin_Pos);  // Pin 7 and 15 values reach bit 31, shift unsigned
+}
+
+/**=============================================
+ * @Fn			- MCAL_GPIO_InitMask
+ * @brief 		- Initializes several pins of the same port with the same configuration
+ * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
+ * @param [in] 	- PinMask: Pins to be configured, can be combined from @ref GPIO_PINS_define
+ * @param [in] 	- Mode: Pins mode @ref GPIO_MODE_define
+ * @param [in] 	- Speed: Output speed @ref GPIO_SPEED_define, ignored for inputs
+ * @retval 		- None
+ * Note			- CRL and CRH are each written once, whatever the number of pins
+ * 				- It is mandatory to enable RCC clock for the corresponding GPIO PORT
+ */
+void MCAL_GPIO_InitMask(GPIO_TypeDef *GPIOx, uint16 PinMask, uint8 Mode, uint8 Speed){
+	uint32 Config_Bits = GPIO_Get_Config_Bits(Mode, Speed);
+	uint32 Clear_Mask[2] = {0, 0}, Set_Mask[2] = {0, 0};
+	uint8 Pin;
+
+	/* Build the new 4 bits fields of all selected pins, index 0 is CRL and 1 is CRH */
+	for(Pin = 0; Pin < 16; Pin++){
+		if(PinMask & (1 << Pin)){
+			Clear_Mask[Pin >> 3] |= (0xFUL << ((Pin & 7) * 4));
+			Set_Mask[Pin >> 3] |= (Config_Bits << ((Pin & 7) * 4));
+		}
+		else{ /* Do Nothing */ }
+	}
+	if(0 != Clear_Mask[0]){
+		GPIOx->CRL = (GPIOx->CRL & ~Clear_Mask[0]) | Set_Mask[0];
+	}
+	else{ /* Do Nothing */ }
+	if(0 != Clear_Mask[1]){
+		GPIOx->CRH = (GPIOx->CRH & ~Clear_Mask[1]) | Set_Mask[1];
+	}
+	else{ /* Do Nothing */ }
+
+	/* Input pull up/down is selected by the ODR bit */
+	if(GPIO_MODE_INPUT_PU == Mode){
+		GPIOx->BSRR = PinMask;
+	}
+	else if(GPIO_MODE_INPUT_PD == Mode){
+		GPIOx->BRR = PinMask;
+	}
+	else{ /* Do Nothing */ }
 }
 
 /**=============================================
@@ -164,21 +184,55 @@ uint16 MCAL_GPIO_ReadPort(GPIO_TypeDef *GPIOx){
  * Note			- None
  */
 void MCAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16 PinNumber, uint8 Value){
+/*	Bits 31:16 BRy: Port x Reset bit y, Bits 15:0 BSy: Port x Set bit y (y= 0 .. 15)
+	These bits are write-only and can be accessed in Word mode only.
+	0: No action on the corresponding ODRx bit
+	1: Reset/Set the corresponding ODRx bit
+	The pin is moved to the reset half of BSRR when Value is GPIO_PIN_RESET, so no branch is needed */
+	GPIOx->BSRR = (uint32)PinNumber << ((Value == GPIO_PIN_RESET) << 4);
+}
 
-	if(Value != GPIO_PIN_RESET){
-/*		Bits 15:0 BSy: Port x Set bit y (y= 0 .. 15)
-		These bits are write-only and can be accessed in Word mode only.
-		0: No action on the corresponding ODRx bit
-		1: Set the corresponding ODRx bit*/
-		GPIOx->BSRR = (uint32)PinNumber;
-	}
-	else{
-/*		Bits 15:0 BRy: Port x Reset bit y (y= 0 .. 15)
-		These bits are write-only and can be accessed in Word mode only.
-		0: No action on the corresponding ODRx bit
-		1: Reset the corresponding ODRx bit*/
-		GPIOx->BRR = (uint32)PinNumber;
-	}
+/**=============================================
+ * @Fn			- MCAL_GPIO_SetResetPins
+ * @brief 		- Sets some pins and resets others of the same port in a single write
+ * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
+ * @param [in] 	- SetPins: Pins to be set, can be combined from @ref GPIO_PINS_define
+ * @param [in] 	- ResetPins: Pins to be reset, can be combined from @ref GPIO_PINS_define
+ * @retval 		- None
+ * Note			- Pins that are not selected are not affected, a pin in both masks is set
+ */
+void MCAL_GPIO_SetResetPins(GPIO_TypeDef *GPIOx, uint16 SetPins, uint16 ResetPins){
+/*	Bits 31:16 BRy: Port x Reset bit y, Bits 15:0 BSy: Port x Set bit y
+	BSy has priority when both bits are set */
+	GPIOx->BSRR = ((uint32)ResetPins << 16) | (uint32)SetPins;
+}
+
+/**=============================================
+ * @Fn			- MCAL_GPIO_WriteGroup
+ * @brief 		- Writes a value on a group of pins of the same port in a single store
+ * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
+ * @param [in] 	- GroupMask: Pins of the group, can be combined from @ref GPIO_PINS_define
+ * @param [in] 	- Value: New level of the group pins, one bit per pin, bits outside GroupMask are ignored
+ * @retval 		- None
+ * Note			- Uses both halves of BSRR, pins outside the group are never touched so an
+ * 				  interrupt driving other pins of the port cannot be overwritten
+ */
+void MCAL_GPIO_WriteGroup(GPIO_TypeDef *GPIOx, uint16 GroupMask, uint16 Value){
+	GPIOx->BSRR = ((uint32)(GroupMask & ~Value) << 16) | (uint32)(GroupMask & Value);
+}
+
+/**=============================================
+ * @Fn			- MCAL_GPIO_ToggleGroup
+ * @brief 		- Toggles a group of pins of the same port in a single store
+ * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
+ * @param [in] 	- GroupMask: Pins to be toggled, can be combined from @ref GPIO_PINS_define
+ * @retval 		- None
+ * Note			- The output levels are read from ODR and written back through BSRR, only the group
+ * 				  pins are written so other pins changed by an interrupt in between are kept
+ */
+void MCAL_GPIO_ToggleGroup(GPIO_TypeDef *GPIOx, uint16 GroupMask){
+	uint16 High_Pins = (uint16)(GPIOx->ODR & GroupMask);
+	GPIOx->BSRR = ((uint32)High_Pins << 16) | (uint32)(GroupMask & ~High_Pins);
 }
 
 /**=============================================
@@ -187,7 +241,7 @@ void MCAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16 PinNumber, uint8 Value){
  * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
  * @param [in] 	- Value: Port value to be written
  * @retval 		- None
- * Note			- None
+ * Note			- Overwrites the whole ODR, use MCAL_GPIO_WriteGroup when interrupts drive pins of the same port
  */
 void MCAL_GPIO_WritePort(GPIO_TypeDef *GPIOx, uint16 Value){
 	GPIOx->ODR = (uint32)Value;
@@ -199,10 +253,10 @@ void MCAL_GPIO_WritePort(GPIO_TypeDef *GPIOx, uint16 Value){
  * @param [in] 	- GPIOx: where x can be (A...E depending on device used) to select the GPIO peripheral
  * @param [in] 	- PinNumber: Set pin number according to @ref GPIO_PINS_define
  * @retval 		- None
- * Note			- None
+ * Note			- Done through BSRR, safe against interrupts driving other pins of the port
  */
 void MCAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16 PinNumber){
-	GPIOx->ODR ^= (uint32)PinNumber;
+	MCAL_GPIO_ToggleGroup(GPIOx, PinNumber);
 }
 
 /**=============================================
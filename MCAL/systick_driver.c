@@ -8,10 +8,25 @@
 /*************************************************************************/
 
 #include "systick_driver.h"
+#include "RCC_driver.h"
+#include "NVIC_driver.h"
 
 static void (*STK_Callback)(void);
 static uint8 Running_Mode; // Flag to determine the SysTick running mode
 
+void SysTick_Handler(void);
+
+/* A periodic callback is the SysTick vector itself when the vector table is in SRAM,
+ * the one shot mode needs SysTick_Handler to stop the timer */
+static void STK_Install_Vector(void){
+	if((STK_PERIODIC_MODE == Running_Mode) && (NULL != STK_Callback)){
+		MCAL_NVIC_SetSystemHandler(NVIC_SYSTICK_EXCEPTION, STK_Callback);
+	}
+	else{
+		MCAL_NVIC_SetSystemHandler(NVIC_SYSTICK_EXCEPTION, SysTick_Handler);
+	}
+}
+
 /**=============================================
   * @Fn				- MCAL_STK_Config
   * @brief 			- Configures the SysTick clock and interrupt
@@ -34,14 +49,16 @@ void MCAL_STK_Config(STK_config_t *_cfg){
 	/* Set reload value */
 	MCAL_STK_SetReload(_cfg->reload_value);
 
+	/* Determine running mode of the SysTick timer */
+	Running_Mode = _cfg->running_mode;
+
 	/* Set callback function if interrupt is enabld */
 	if(STK_INTERRUPT_ENABLED == _cfg->interrupt_config){
 		MCAL_STK_SetCallback(_cfg->Callback_Function);
 	}
-	else{ /* Do Nothing */ }
-
-	/* Determine running mode of the SysTick timer */
-	Running_Mode = _cfg->running_mode;
+	else{
+		STK_Install_Vector();
+	}
 }
 
 /**=============================================
@@ -65,10 +82,11 @@ void MCAL_STK_SetReload(uint32 value){
   * @param [in] 	- pfCallback: Pointer to the callback function
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- None
+  * Note			- In periodic mode the callback is installed as the SysTick vector if the vector table is in SRAM
   */
 void MCAL_STK_SetCallback(void (*pfCallback)(void)){
 	STK_Callback = pfCallback;
+	STK_Install_Vector();
 }
 
 /**=============================================
@@ -147,11 +165,15 @@ void MCAL_STK_Delay(uint32 delay_ticks){
   * @param [in] 	- delay_ms: Number of milliseconds delay needed
   * @param [out] 	- None
   * @retval 		- None
-  * Note			- User must define the frequency of the SysTick timer in @ref stk_cpu_freq_define
+  * Note			- The SysTick ticks are derived from the HCLK given by MCAL_RCC_Get_Clock_Tree
   */
 void MCAL_STK_Delay1ms(uint32 delay_ms){
 	uint32 index;
-	uint32 ms_delay_time = ((STK_FCPU/1000UL)-1);
+	uint32 ms_delay_time;
+	RCC_ClockTree_t tree;
+
+	MCAL_RCC_Get_Clock_Tree(&tree);
+	ms_delay_time = tree.HCLK / 1000UL;
 	for(index = 0; index < delay_ms; index++){
 		MCAL_STK_Delay(ms_delay_time);
 	}
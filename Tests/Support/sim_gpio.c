@@ -0,0 +1,189 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_gpio.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include "sim_gpio.h"
+#include "sim_time.h"
+
+/* Core time of one port store, plus up to 1 us taken by interrupts before it,
+ * so the delays that follow start at any phase of the TIM2 prescaler */
+#define SIM_GPIO_WRITE_NS	28ULL
+#define SIM_GPIO_JITTER_NS	1000U
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+typedef struct{
+	uint16 Output;		// Output data latch
+	uint16 Outputs;		// Pins configured as outputs
+	uint16 Input;		// Levels driven on the input pins
+	unsigned long Writes;
+}Sim_GPIO_Port_t;
+
+static Sim_GPIO_Port_t Sim_Ports[SIM_GPIO_PORTS];
+static struct{
+	Sim_GPIO_Listener_t Listener;
+	void* Context;
+}Sim_Listeners[SIM_GPIO_LISTENERS];
+static uint8 Sim_Listeners_Count;
+static uint32 Sim_Jitter_Seed = 1;
+
+//----------------------------------------------
+// Section: Static Functions Definitions
+//----------------------------------------------
+
+/* The port pointers are only compared, never dereferenced */
+static Sim_GPIO_Port_t* Sim_Port(GPIO_TypeDef* GPIOx){
+	GPIO_TypeDef* const ports[SIM_GPIO_PORTS] = {GPIOA, GPIOB, GPIOC, GPIOD, GPIOE};
+	uint8 index;
+
+	for(index = 0; index < SIM_GPIO_PORTS; index++){
+		if(ports[index] == GPIOx){
+			return &Sim_Ports[index];
+		}
+		else{ /* Do Nothing */ }
+	}
+	printf("sim_gpio: unknown port %p\n", (void*)GPIOx);
+	exit(2);
+}
+
+static void Sim_Write(GPIO_TypeDef* GPIOx, uint16 set, uint16 reset){
+	Sim_GPIO_Port_t* port = Sim_Port(GPIOx);
+	uint16 before = port->Output;
+	uint8 index;
+
+	Sim_Jitter_Seed = (Sim_Jitter_Seed * 1103515245UL) + 12345UL;
+	Sim_Time_Advance(SIM_GPIO_WRITE_NS + ((Sim_Jitter_Seed >> 16) % SIM_GPIO_JITTER_NS));
+
+	/* BSRR: set wins over reset */
+	port->Output = (uint16)((port->Output & ~reset) | set);
+	port->Writes++;
+	for(index = 0; index < Sim_Listeners_Count; index++){
+		Sim_Listeners[index].Listener(Sim_Listeners[index].Context, GPIOx, before, port->Output);
+	}
+}
+
+static void Sim_Configure(GPIO_TypeDef* GPIOx, uint16 pins, uint8 mode){
+	Sim_GPIO_Port_t* port = Sim_Port(GPIOx);
+
+	if((mode >= GPIO_MODE_OUTPUT_PP) && (mode <= GPIO_MODE_OUTPUT_AF_OD)){
+		port->Outputs |= pins;
+	}
+	else{
+		port->Outputs &= (uint16)~pins;
+	}
+}
+
+//----------------------------------------------
+// Section: Simulation control
+//----------------------------------------------
+uint16 Sim_GPIO_Get_Output(GPIO_TypeDef* port){
+	return Sim_Port(port)->Output;
+}
+
+uint16 Sim_GPIO_Get_Outputs_Mask(GPIO_TypeDef* port){
+	return Sim_Port(port)->Outputs;
+}
+
+void Sim_GPIO_Set_Input(GPIO_TypeDef* port, uint16 pins, uint8 level){
+	Sim_GPIO_Port_t* sim_port = Sim_Port(port);
+	sim_port->Input = level ? (uint16)(sim_port->Input | pins) : (uint16)(sim_port->Input & ~pins);
+}
+
+unsigned long Sim_GPIO_Get_Writes(GPIO_TypeDef* port){
+	return Sim_Port(port)->Writes;
+}
+
+void Sim_GPIO_Add_Listener(Sim_GPIO_Listener_t listener, void* context){
+	if(Sim_Listeners_Count < SIM_GPIO_LISTENERS){
+		Sim_Listeners[Sim_Listeners_Count].Listener = listener;
+		Sim_Listeners[Sim_Listeners_Count].Context = context;
+		Sim_Listeners_Count++;
+	}
+	else{ /* Do Nothing */ }
+}
+
+void Sim_GPIO_Reset(void){
+	uint8 index;
+	for(index = 0; index < SIM_GPIO_PORTS; index++){
+		Sim_Ports[index].Output = 0;
+		Sim_Ports[index].Outputs = 0;
+		Sim_Ports[index].Input = 0;
+		Sim_Ports[index].Writes = 0;
+	}
+	Sim_Listeners_Count = 0;
+}
+
+//----------------------------------------------
+// Section: GPIO driver API
+//----------------------------------------------
+void MCAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_PinConfig_t *PinConfig){
+	Sim_Configure(GPIOx, PinConfig->GPIO_PinNumber, PinConfig->GPIO_MODE);
+}
+
+void MCAL_GPIO_InitMask(GPIO_TypeDef *GPIOx, uint16 PinMask, uint8 Mode, uint8 Speed){
+	(void)Speed;
+	Sim_Configure(GPIOx, PinMask, Mode);
+}
+
+void MCAL_GPIO_DeInit(GPIO_TypeDef *GPIOx){
+	Sim_GPIO_Port_t* port = Sim_Port(GPIOx);
+	port->Outputs = 0;
+	port->Output = 0;
+}
+
+uint8 MCAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16 PinNumber){
+	return (MCAL_GPIO_ReadPort(GPIOx) & PinNumber) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+/* Output pins read back their latch */
+uint16 MCAL_GPIO_ReadPort(GPIO_TypeDef *GPIOx){
+	Sim_GPIO_Port_t* port = Sim_Port(GPIOx);
+	return (uint16)((port->Output & port->Outputs) | (port->Input & ~port->Outputs));
+}
+
+void MCAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16 PinNumber, uint8 Value){
+	if(GPIO_PIN_RESET != Value){
+		Sim_Write(GPIOx, PinNumber, 0);
+	}
+	else{
+		Sim_Write(GPIOx, 0, PinNumber);
+	}
+}
+
+void MCAL_GPIO_SetResetPins(GPIO_TypeDef *GPIOx, uint16 SetPins, uint16 ResetPins){
+	Sim_Write(GPIOx, SetPins, ResetPins);
+}
+
+void MCAL_GPIO_WriteGroup(GPIO_TypeDef *GPIOx, uint16 GroupMask, uint16 Value){
+	Sim_Write(GPIOx, (uint16)(Value & GroupMask), (uint16)(~Value & GroupMask));
+}
+
+void MCAL_GPIO_ToggleGroup(GPIO_TypeDef *GPIOx, uint16 GroupMask){
+	uint16 output = Sim_Port(GPIOx)->Output;
+	Sim_Write(GPIOx, (uint16)(~output & GroupMask), (uint16)(output & GroupMask));
+}
+
+void MCAL_GPIO_WritePort(GPIO_TypeDef *GPIOx, uint16 Value){
+	Sim_Write(GPIOx, Value, (uint16)~Value);
+}
+
+void MCAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16 PinNumber){
+	MCAL_GPIO_ToggleGroup(GPIOx, PinNumber);
+}
+
+uint8 MCAL_GPIO_LockPin(GPIO_TypeDef *GPIOx, uint16 PinNumber){
+	(void)GPIOx;
+	(void)PinNumber;
+	return GPIO_RETURN_LOCK_OK;
+}
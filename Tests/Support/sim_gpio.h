@@ -0,0 +1,47 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_gpio.h 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef SUPPORT_SIM_GPIO_H_
+#define SUPPORT_SIM_GPIO_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "gpio_driver.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+#define SIM_GPIO_PORTS		5	// GPIOA...GPIOE
+#define SIM_GPIO_LISTENERS	4
+
+/*
+ * =============================================
+ * Simulated GPIO driver
+ * =============================================
+ * Replaces gpio_driver.c with the same API over a pin level model, so the HAL
+ * drivers run unchanged and the devices on the pins see every output change.
+ */
+
+/* Called after every output change of a port, with the output levels before and after */
+typedef void (*Sim_GPIO_Listener_t)(void* context, GPIO_TypeDef* port, uint16 before, uint16 after);
+
+/* Output latch and driven input levels of a port, GPIOA...GPIOE */
+uint16 Sim_GPIO_Get_Output(GPIO_TypeDef* port);
+uint16 Sim_GPIO_Get_Outputs_Mask(GPIO_TypeDef* port);
+void Sim_GPIO_Set_Input(GPIO_TypeDef* port, uint16 pins, uint8 level);
+
+/* Number of writes to the output latch of a port since the last reset */
+unsigned long Sim_GPIO_Get_Writes(GPIO_TypeDef* port);
+
+void Sim_GPIO_Add_Listener(Sim_GPIO_Listener_t listener, void* context);
+
+/* Clears all the ports and removes the listeners */
+void Sim_GPIO_Reset(void);
+
+#endif /* SUPPORT_SIM_GPIO_H_ */
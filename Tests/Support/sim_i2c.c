@@ -0,0 +1,450 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_i2c.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "sim_i2c.h"
+
+#define SIM_START_NS		SIM_I2C_BIT_NS
+#define SIM_STOP_NS			(2ULL * SIM_I2C_BIT_NS)
+#define SIM_ISR_NS			1000ULL				// Core time of one interrupt
+#define SIM_DR_UNWRITTEN	0x80000000UL		// DR of the transmitter until the driver writes it
+#define SIM_SR1_EVENTS		(I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_BTF | I2C_SR1_STOPF)
+#define SIM_SR1_BUFFER		(I2C_SR1_TXE | I2C_SR1_RXNE)
+#define SIM_SR1_ERRORS		(I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR)
+
+/* Bus phases of the master */
+#define SIM_IDLE			0
+#define SIM_START			1	// Start condition on the wire until Sim_Event_ns
+#define SIM_SB				2	// SB set, waits for the address in DR
+#define SIM_ADDRESS			3	// Address byte on the wire until Sim_Event_ns
+#define SIM_ADDR			4	// ADDR set, SCL stretched until it is cleared
+#define SIM_TX				5
+#define SIM_RX				6
+#define SIM_NACKED			7	// AF set, waits for the STOP
+#define SIM_STOP			8	// Stop condition on the wire until Sim_Event_ns
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+I2C_TypeDef Sim_I2C1;
+static I2C_TypeDef Sim_I2C2;
+
+uint8 Sim_I2C_Memory[SIM_I2C_MEMORY_SIZE];
+unsigned long long Sim_I2C_Busy_Until_ns;
+unsigned long Sim_I2C_Address_NACKs;
+unsigned long Sim_I2C_Page_Writes;
+unsigned long Sim_I2C_Max_Write_Bytes;
+unsigned long long Sim_I2C_Latency_ns;
+uint8 Sim_I2C_SCL_Held;
+uint8 Sim_I2C_Hold_At_Byte;
+uint8 Sim_I2C_Bus_Held;
+unsigned long Sim_I2C_Violations;
+unsigned long Sim_I2C_Restart_Events;
+
+static uint8 Sim_Phase;
+static unsigned long long Sim_Event_ns;		// End of the start, stop or byte on the wire
+static uint32 Sim_SR1, Sim_SR2;
+static uint8 Sim_Restarting;				// The start on the wire is a repeated start
+static uint8 Sim_Address;					// Address byte sent after SB
+static uint8 Sim_Shift_Busy;				// A byte is on the wire until Sim_Event_ns
+static uint8 Sim_Shift;						// Transmitter: byte on the wire, receiver: byte held by BTF
+static uint8 Sim_Shift_Full;				// Receiver: a byte waits in the shift register
+static uint8 Sim_Shift_ACK;
+static uint8 Sim_Holding;					// Transmitter: DR loaded while a byte is on the wire
+static uint8 Sim_Holding_Value;
+static uint8 Sim_DR;						// Receiver: byte in DR while RXNE
+static uint32 Sim_DR_Shown;					// DR as last set by the model, anything else is a driver write
+static uint8 Sim_POS_ACK;					// ACK bit latched for the next byte when POS is set
+static uint16 Sim_RX_Clocked;				// Bytes the slave sent in this read
+static uint16 Sim_RX_Length;				// Bytes the driver asked for
+static unsigned long long Sim_ISR_Ready_ns;
+static uint8 Sim_IRQ_Enabled;				// Event and error lines in the NVIC
+static uint8 Sim_Global_Off;				// PRIMASK set
+static uint8 Sim_Running;
+
+static uint16 Sim_Slave_Pointer;
+static uint16 Sim_Slave_Received;			// Bytes of the current write, two address bytes first
+static uint32 Sim_Seed = 2026;
+
+#undef I2C2
+#define I2C2	(&Sim_I2C2)
+
+#include "../../MCAL/I2C_driver.c"
+
+//----------------------------------------------
+// Section: Simulated peripherals of the driver
+//----------------------------------------------
+void MCAL_NVIC_EnableIRQ(uint8 IRQn){
+	Sim_IRQ_Enabled |= (I2C1_EV_IRQ == IRQn) ? 1 : ((I2C1_ER_IRQ == IRQn) ? 2 : 0);
+}
+void MCAL_NVIC_DisableIRQ(uint8 IRQn){
+	Sim_IRQ_Enabled &= (uint8)~((I2C1_EV_IRQ == IRQn) ? 1 : ((I2C1_ER_IRQ == IRQn) ? 2 : 0));
+}
+uint32 MCAL_NVIC_Disable_Global_IRQ(void){
+	uint32 primask = Sim_Global_Off;
+	Sim_Global_Off = 1;
+	return primask;
+}
+void MCAL_NVIC_Restore_Global_IRQ(uint32 primask){
+	Sim_Global_Off = (uint8)primask;
+}
+void MCAL_GPIO_InitMask(GPIO_TypeDef* GPIOx, uint16 PinMask, uint8 Mode, uint8 Speed){
+	(void)GPIOx; (void)PinMask; (void)Mode; (void)Speed;
+}
+void MCAL_RCC_Release_Peripheral(uint8 peripheral){
+	(void)peripheral;
+}
+void MCAL_RCC_Reset_Peripheral(uint8 peripheral){
+	(void)peripheral;
+	memset(&Sim_I2C1, 0, sizeof(Sim_I2C1));
+	Sim_I2C1.DR = Sim_DR_Shown;
+}
+
+//----------------------------------------------
+// Section: Bus and slave model
+//----------------------------------------------
+static void Sim_Violation(const char* what){
+	if(Sim_I2C_Violations < 5){
+		printf("I2C model at %llu ns: %s\n", Sim_Time_ns, what);
+	}
+	else{ /* Do Nothing */ }
+	Sim_I2C_Violations++;
+}
+
+static uint32 Sim_Random(void){
+	Sim_Seed = (Sim_Seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+	return (Sim_Seed >> 8) & 0xFFFFUL;
+}
+
+/* 24C32: the first two bytes of a write set the pointer, the data wraps inside its page */
+static void Sim_Slave_Write(uint8 byte){
+	if(Sim_Slave_Received < 2){
+		Sim_Slave_Pointer = (uint16)(((Sim_Slave_Pointer << 8) | byte) % SIM_I2C_MEMORY_SIZE);
+	}
+	else{
+		Sim_I2C_Memory[Sim_Slave_Pointer] = byte;
+		Sim_Slave_Pointer = (uint16)((Sim_Slave_Pointer & ~(SIM_I2C_PAGE_SIZE - 1)) | ((Sim_Slave_Pointer + 1) & (SIM_I2C_PAGE_SIZE - 1)));
+	}
+	Sim_Slave_Received++;
+	if(Sim_Slave_Received == Sim_I2C_Hold_At_Byte){
+		Sim_I2C_SCL_Held = 1;
+	}
+	else{ /* Do Nothing */ }
+}
+
+static uint8 Sim_Slave_Read(void){
+	uint8 byte = Sim_I2C_Memory[Sim_Slave_Pointer];
+
+	Sim_Slave_Pointer = (uint16)((Sim_Slave_Pointer + 1) % SIM_I2C_MEMORY_SIZE);
+	return byte;
+}
+
+static void Sim_Begin(uint8 phase, unsigned long long duration_ns){
+	Sim_Phase = phase;
+	Sim_Event_ns = Sim_Time_ns + duration_ns;
+}
+
+static void Sim_Shift_Start(void){
+	Sim_Shift_Busy = 1;
+	Sim_Event_ns = Sim_Time_ns + SIM_I2C_BYTE_NS;
+}
+
+/* A write with data starts the write cycle of the slave on the STOP */
+static void Sim_Begin_Stop(void){
+	if(Sim_Slave_Received > 2){
+		Sim_I2C_Busy_Until_ns = Sim_Time_ns + SIM_STOP_NS + SIM_I2C_WRITE_CYCLE_NS;
+		Sim_I2C_Page_Writes++;
+		if((unsigned long)(Sim_Slave_Received - 2) > Sim_I2C_Max_Write_Bytes){
+			Sim_I2C_Max_Write_Bytes = Sim_Slave_Received - 2;
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+	if((SIM_RX == Sim_Phase) && (Sim_RX_Clocked != Sim_RX_Length)){
+		Sim_Violation("read stopped before its last byte");
+	}
+	else{ /* Do Nothing */ }
+	Sim_Slave_Received = 0;
+	Sim_SR1 &= ~(I2C_SR1_TXE | I2C_SR1_BTF);
+	Sim_Begin(SIM_STOP, SIM_STOP_NS);
+}
+
+/* The receiver shows its byte in DR, the other phases a value the driver cannot write */
+static void Sim_Show_DR(void){
+	Sim_DR_Shown = (SIM_RX == Sim_Phase) ? Sim_DR : SIM_DR_UNWRITTEN;
+	Sim_I2C1.DR = Sim_DR_Shown;
+}
+
+/* Acts on a driver write to DR */
+static void Sim_Apply_DR(void){
+	if(Sim_I2C1.DR != Sim_DR_Shown){
+		if(SIM_SB == Sim_Phase){
+			Sim_SR1 &= ~I2C_SR1_SB;
+			Sim_Address = (uint8)Sim_I2C1.DR;
+			Sim_Begin(SIM_ADDRESS, SIM_I2C_BYTE_NS);
+		}
+		else if((SIM_TX == Sim_Phase) && !Sim_Shift_Busy){
+			Sim_Shift = (uint8)Sim_I2C1.DR;
+			Sim_SR1 &= ~I2C_SR1_BTF;
+			Sim_Shift_Start();
+		}
+		else if((SIM_TX == Sim_Phase) && !Sim_Holding){
+			Sim_Holding = 1;
+			Sim_Holding_Value = (uint8)Sim_I2C1.DR;
+			Sim_SR1 &= ~I2C_SR1_TXE;
+		}
+		else{
+			Sim_Violation("DR written while full or out of a transmission");
+		}
+		Sim_Show_DR();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Acts on the driver writes to CR1 and DR */
+static void Sim_Apply_Writes(void){
+	uint32 cr1 = Sim_I2C1.CR1;
+
+	Sim_Apply_DR();
+	if((cr1 & I2C_CR1_START) && (cr1 & I2C_CR1_STOP)){
+		Sim_Violation("START requested before the STOP was sent");
+		Sim_I2C1.CR1 &= ~I2C_CR1_START;
+	}
+	else{ /* Do Nothing */ }
+
+	if(!Sim_I2C_SCL_Held && !(cr1 & I2C_CR1_STOP) && (Sim_I2C1.CR1 & I2C_CR1_START)){
+		if((SIM_IDLE == Sim_Phase) && !(Sim_SR2 & I2C_SR2_BUSY)){
+			Sim_Restarting = 0;
+			Sim_Begin(SIM_START, SIM_START_NS);
+		}
+		else if(((SIM_TX == Sim_Phase) && !Sim_Shift_Busy && !Sim_Holding) || (SIM_NACKED == Sim_Phase)){
+			/* TXE and BTF stay set until the repeated start is on the wire */
+			Sim_Restarting = 1;
+			Sim_Slave_Received = 0;
+			Sim_Begin(SIM_START, SIM_START_NS);
+		}
+		else{ /* Do Nothing */ }
+	}
+	else if(!Sim_I2C_SCL_Held && (cr1 & I2C_CR1_STOP)){
+		if(((SIM_TX == Sim_Phase) && !Sim_Shift_Busy && !Sim_Holding) || ((SIM_RX == Sim_Phase) && !Sim_Shift_Busy) ||
+				(SIM_NACKED == Sim_Phase)){
+			Sim_Begin_Stop();
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Ends the start, stop or byte on the wire */
+static void Sim_Complete(void){
+	uint8 byte, ack;
+
+	if(SIM_START == Sim_Phase){
+		Sim_I2C1.CR1 &= ~I2C_CR1_START;
+		Sim_SR1 = (Sim_SR1 & ~(I2C_SR1_TXE | I2C_SR1_BTF)) | I2C_SR1_SB;
+		Sim_SR2 |= I2C_SR2_MSL | I2C_SR2_BUSY;
+		Sim_Restarting = 0;
+		Sim_Phase = SIM_SB;
+	}
+	else if(SIM_ADDRESS == Sim_Phase){
+		if(((Sim_Address >> 1) == SIM_I2C_SLAVE_ADDRESS) && (Sim_Time_ns >= Sim_I2C_Busy_Until_ns)){
+			Sim_SR1 |= I2C_SR1_ADDR;
+			Sim_SR2 = (Sim_Address & 1) ? (Sim_SR2 & ~I2C_SR2_TRA) : (Sim_SR2 | I2C_SR2_TRA);
+			Sim_POS_ACK = (Sim_I2C1.CR1 & I2C_CR1_ACK) ? 1 : 0;
+			Sim_Phase = SIM_ADDR;
+		}
+		else{
+			Sim_I2C_Address_NACKs++;
+			Sim_SR1 |= I2C_SR1_AF;
+			Sim_Phase = SIM_NACKED;
+		}
+	}
+	else if(SIM_STOP == Sim_Phase){
+		Sim_I2C1.CR1 &= ~I2C_CR1_STOP;
+		Sim_SR2 &= ~(I2C_SR2_MSL | I2C_SR2_BUSY | I2C_SR2_TRA);
+		Sim_Phase = SIM_IDLE;
+	}
+	else if(SIM_TX == Sim_Phase){
+		Sim_Slave_Write(Sim_Shift);
+		Sim_Shift_Busy = 0;
+		if(Sim_Holding){
+			Sim_Holding = 0;
+			Sim_Shift = Sim_Holding_Value;
+			Sim_SR1 |= I2C_SR1_TXE;
+			Sim_Shift_Start();
+		}
+		else{
+			Sim_SR1 |= I2C_SR1_BTF;
+		}
+	}
+	else if(SIM_RX == Sim_Phase){
+		byte = Sim_Slave_Read();
+		Sim_Shift_Busy = 0;
+		Sim_RX_Clocked++;
+		ack = (Sim_I2C1.CR1 & I2C_CR1_POS) ? Sim_POS_ACK : ((Sim_I2C1.CR1 & I2C_CR1_ACK) ? 1 : 0);
+		Sim_POS_ACK = (Sim_I2C1.CR1 & I2C_CR1_ACK) ? 1 : 0;
+		if(Sim_RX_Clocked > Sim_RX_Length){
+			Sim_Violation("byte clocked after the last one of the read");
+		}
+		else if((Sim_RX_Clocked < Sim_RX_Length) && !ack){
+			Sim_Violation("NACK before the last byte of the read");
+		}
+		else if((Sim_RX_Clocked == Sim_RX_Length) && ack){
+			Sim_Violation("last byte of the read acknowledged");
+		}
+		else{ /* Do Nothing */ }
+
+		if(!(Sim_SR1 & I2C_SR1_RXNE)){
+			Sim_DR = byte;
+			Sim_SR1 |= I2C_SR1_RXNE;
+			if(ack && !(Sim_I2C1.CR1 & I2C_CR1_STOP)){
+				Sim_Shift_Start();
+			}
+			else{ /* Do Nothing */ }
+		}
+		else{
+			/* DR not read in time, SCL is stretched until it is */
+			Sim_Shift = byte;
+			Sim_Shift_Full = 1;
+			Sim_Shift_ACK = ack;
+			Sim_SR1 |= I2C_SR1_BTF;
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* ADDR is cleared by reading SR1 then SR2, every branch of the driver does it */
+static void Sim_Clear_ADDR(void){
+	Sim_SR1 &= ~I2C_SR1_ADDR;
+	if(Sim_SR2 & I2C_SR2_TRA){
+		Sim_SR1 |= I2C_SR1_TXE;
+		Sim_Phase = SIM_TX;
+	}
+	else{
+		Sim_RX_Clocked = 0;
+		Sim_RX_Length = I2C_States[0].Transfer->RX_Length;
+		Sim_Phase = SIM_RX;
+		Sim_Shift_Start();
+	}
+}
+
+/* DR reads are seen through the bytes the interrupt stored in RX: the second read of one
+ * interrupt gets the byte moved from the shift register, the model hands it over the same way */
+static void Sim_Read_DR(uint16 first, uint16 count){
+	uint16 index;
+
+	for(index = first; index < (first + count); index++){
+		if(Sim_SR1 & I2C_SR1_RXNE){
+			I2C_States[0].Transfer->RX[index] = Sim_DR;
+			if(Sim_Shift_Full){
+				Sim_DR = Sim_Shift;
+				Sim_Shift_Full = 0;
+				Sim_SR1 &= ~I2C_SR1_BTF;
+				if(Sim_Shift_ACK && !(Sim_I2C1.CR1 & I2C_CR1_STOP)){
+					Sim_Shift_Start();
+				}
+				else{ /* Do Nothing */ }
+			}
+			else{
+				Sim_SR1 &= ~I2C_SR1_RXNE;
+			}
+		}
+		else{
+			Sim_Violation("DR read while empty");
+		}
+	}
+}
+
+static void Sim_Sync(void){
+	Sim_I2C1.SR1 = Sim_SR1;
+	Sim_I2C1.SR2 = Sim_SR2 | (Sim_I2C_Bus_Held ? I2C_SR2_BUSY : 0);
+	Sim_Show_DR();
+}
+
+static void Sim_Interrupt(void (*handler)(void)){
+	uint32 sr1 = Sim_SR1;
+	uint16 index = I2C_States[0].Index;
+	uint8 receiving = I2C_States[0].Receiving;
+
+	if(Sim_Restarting){
+		Sim_I2C_Restart_Events++;
+	}
+	else{ /* Do Nothing */ }
+	Sim_Sync();
+	handler();
+	Sim_Time_ns += SIM_ISR_NS;
+	Sim_ISR_Ready_ns = Sim_Time_ns + ((Sim_I2C_Latency_ns > 0) ? ((Sim_Random() * Sim_I2C_Latency_ns) >> 16) : 0);
+
+	Sim_Apply_DR();
+	/* Error flags are cleared by writing 0 */
+	Sim_SR1 &= Sim_I2C1.SR1 | ~SIM_SR1_ERRORS;
+	if((sr1 & I2C_SR1_ADDR) && (SIM_ADDR == Sim_Phase)){
+		Sim_Clear_ADDR();
+	}
+	else{ /* Do Nothing */ }
+	if(receiving && (I2C_States[0].Index > index)){
+		Sim_Read_DR(index, I2C_States[0].Index - index);
+	}
+	else{ /* Do Nothing */ }
+	Sim_Apply_Writes();
+}
+
+
+/* Time hook: the bus up to now, then one interrupt if one is pending */
+static void Sim_I2C_Run(void){
+	uint32 cr2;
+
+	if(!Sim_Running){
+		Sim_Running = 1;
+		Sim_Apply_Writes();
+		while(!Sim_I2C_SCL_Held && (Sim_Event_ns <= Sim_Time_ns) &&
+				((SIM_START == Sim_Phase) || (SIM_ADDRESS == Sim_Phase) || (SIM_STOP == Sim_Phase) || Sim_Shift_Busy)){
+			Sim_Complete();
+			Sim_Apply_Writes();
+		}
+
+		cr2 = Sim_I2C1.CR2;
+		if(Sim_Global_Off || (Sim_Time_ns < Sim_ISR_Ready_ns)){
+			/* Do Nothing */
+		}
+		else if((Sim_IRQ_Enabled & 2) && (cr2 & I2C_CR2_ITERREN) && (Sim_SR1 & SIM_SR1_ERRORS)){
+			Sim_Interrupt(I2C1_ER_IRQHandler);
+		}
+		else if((Sim_IRQ_Enabled & 1) && (cr2 & I2C_CR2_ITEVTEN) &&
+				((Sim_SR1 & SIM_SR1_EVENTS) || ((cr2 & I2C_CR2_ITBUFEN) && (Sim_SR1 & SIM_SR1_BUFFER)))){
+			Sim_Interrupt(I2C1_EV_IRQHandler);
+		}
+		else{ /* Do Nothing */ }
+		Sim_Sync();
+		Sim_Running = 0;
+	}
+	else{ /* Do Nothing */ }
+}
+
+void Sim_I2C_Reset(void){
+	memset(&Sim_I2C1, 0, sizeof(Sim_I2C1));
+	Sim_Phase = SIM_IDLE;
+	Sim_SR1 = 0;
+	Sim_SR2 = 0;
+	Sim_Shift_Busy = 0;
+	Sim_Shift_Full = 0;
+	Sim_Holding = 0;
+	Sim_Slave_Received = 0;
+	Sim_I2C_SCL_Held = 0;
+	Sim_I2C_Hold_At_Byte = 0;
+	Sim_I2C_Bus_Held = 0;
+	Sim_I2C_Violations = 0;
+	Sim_I2C_Restart_Events = 0;
+	Sim_Sync();
+	Sim_Time_Hook = Sim_I2C_Run;
+}
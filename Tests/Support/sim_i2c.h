@@ -0,0 +1,68 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_i2c.h 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef SUPPORT_SIM_I2C_H_
+#define SUPPORT_SIM_I2C_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "sim_time.h"
+#define I2C_DRIVER_ENABLE	1	// Left out of the firmware build, the tests build it
+#include "I2C_driver.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+#define SIM_I2C_BIT_NS			2500ULL		// 400 kHz bus
+#define SIM_I2C_BYTE_NS			(9ULL * SIM_I2C_BIT_NS)
+#define SIM_I2C_SLAVE_ADDRESS	0x50
+#define SIM_I2C_MEMORY_SIZE		4096		// 24C32: two address bytes, 32 byte pages
+#define SIM_I2C_PAGE_SIZE		32
+#define SIM_I2C_WRITE_CYCLE_NS	5000000ULL	// The slave NACKs its address for 5 ms after a write
+
+/*
+ * =============================================
+ * Simulated I2C1 and 24C32 slave
+ * =============================================
+ * The real I2C_driver.c runs against a model of the I2C1 registers. The bus, the
+ * slave and the interrupts advance with Sim_Time_ns, on every TIM2_CNT access, so
+ * they run while the driver polls its status. The model counts a violation for
+ * every access the hardware would not take: a byte read from an empty DR, a NACK
+ * before the last byte of a read, the last byte acknowledged, a byte clocked after
+ * it, a DR write while full, a START requested before the last STOP was sent.
+ */
+
+/* I2C1 of the driver under test */
+extern I2C_TypeDef Sim_I2C1;
+#undef I2C1
+#define I2C1	(&Sim_I2C1)
+
+/* Slave memory, its write cycle end and the address polls it NACKed */
+extern uint8 Sim_I2C_Memory[SIM_I2C_MEMORY_SIZE];
+extern unsigned long long Sim_I2C_Busy_Until_ns;
+extern unsigned long Sim_I2C_Address_NACKs;
+extern unsigned long Sim_I2C_Page_Writes;
+extern unsigned long Sim_I2C_Max_Write_Bytes;	// Data bytes of the longest write
+
+/* Longest delay before an interrupt is taken, random up to it */
+extern unsigned long long Sim_I2C_Latency_ns;
+
+/* Slave holding SCL low, from the given byte of a write if not 0, another master holding the bus */
+extern uint8 Sim_I2C_SCL_Held;
+extern uint8 Sim_I2C_Hold_At_Byte;
+extern uint8 Sim_I2C_Bus_Held;
+
+/* Bus checks failed, events taken between a repeated start request and SB */
+extern unsigned long Sim_I2C_Violations;
+extern unsigned long Sim_I2C_Restart_Events;
+
+/* Resets the model and hooks it on the time base */
+void Sim_I2C_Reset(void);
+
+#endif /* SUPPORT_SIM_I2C_H_ */
@@ -0,0 +1,194 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_lcd.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <stdio.h>
+#include "sim_lcd.h"
+
+static const uint8 Sim_LCD_Row_Address[4] = {0x00, 0x40, 0x14, 0x54};
+
+//----------------------------------------------
+// Section: Static Functions Definitions
+//----------------------------------------------
+static void Sim_LCD_Violation(Sim_LCD_t* lcd, const char* what, unsigned long long actual_ns, unsigned long long needed_ns){
+	lcd->Violations++;
+	printf("sim_lcd: %s %llu ns, needs %llu ns (t = %llu ns)\n", what, actual_ns, needed_ns, Sim_Time_ns);
+}
+
+/* Two line mode: each line holds 40 addresses, 0x00-0x27 and 0x40-0x67 */
+static void Sim_LCD_Advance(Sim_LCD_t* lcd){
+	if(lcd->In_CGRAM){
+		lcd->AC = (uint8)((lcd->AC + (lcd->Increment ? 1 : 63)) & 0x3F);
+	}
+	else if(lcd->Increment){
+		lcd->AC++;
+		if(0x28 == lcd->AC){ lcd->AC = 0x40; }
+		else if(0x68 == lcd->AC){ lcd->AC = 0x00; }
+		else{ /* Do Nothing */ }
+	}
+	else{
+		if(0x00 == lcd->AC){ lcd->AC = 0x67; }
+		else if(0x40 == lcd->AC){ lcd->AC = 0x27; }
+		else{ lcd->AC--; }
+	}
+}
+
+static void Sim_LCD_Execute(Sim_LCD_t* lcd, uint8 rs, uint8 value, unsigned long long now){
+	unsigned long long busy = SIM_LCD_COMMAND_NS;
+	uint8 index;
+
+	if(rs){
+		if(lcd->In_CGRAM){
+			lcd->CGRAM[lcd->AC & 0x3F] = value;
+			lcd->CGRAM_Writes++;
+		}
+		else{
+			lcd->DDRAM[lcd->AC] = value;
+			lcd->Data_Writes++;
+		}
+		Sim_LCD_Advance(lcd);
+		busy = SIM_LCD_DATA_NS;
+	}
+	else{
+		lcd->Commands++;
+		if(value & 0x80){
+			lcd->AC = (uint8)(value & 0x7F);
+			lcd->In_CGRAM = 0;
+		}
+		else if(value & 0x40){
+			lcd->AC = (uint8)(value & 0x3F);
+			lcd->In_CGRAM = 1;
+		}
+		else if(value & 0x20){
+			/* Function set, the busy flag cannot be read during the initialization by instruction */
+			if((value & 0x10) && (lcd->Resets < 3)){
+				busy = (0 == lcd->Resets) ? SIM_LCD_RESET1_NS : ((1 == lcd->Resets) ? SIM_LCD_RESET2_NS : SIM_LCD_COMMAND_NS);
+				lcd->Resets++;
+			}
+			else{ /* Do Nothing */ }
+			lcd->Four_Bit = (value & 0x10) ? 0 : 1;
+		}
+		else if(value & 0x04){
+			lcd->Increment = (value & 0x02) ? 1 : 0;
+		}
+		else if(value & 0x02){
+			lcd->AC = 0;
+			lcd->In_CGRAM = 0;
+			busy = SIM_LCD_CLEAR_HOME_NS;
+		}
+		else if(value & 0x01){
+			for(index = 0; index < sizeof(lcd->DDRAM); index++){
+				lcd->DDRAM[index] = ' ';
+			}
+			lcd->AC = 0;
+			lcd->In_CGRAM = 0;
+			lcd->Increment = 1;
+			busy = SIM_LCD_CLEAR_HOME_NS;
+		}
+		else{ /* Display control and shifts, not modelled */ }
+	}
+
+	lcd->Busy_Start_ns = now;
+	lcd->Busy_Until_ns = now + busy;
+}
+
+/* Data is latched on the falling edge of EN */
+static void Sim_LCD_Listener(void* context, GPIO_TypeDef* port, uint16 before, uint16 after){
+	Sim_LCD_t* lcd = (Sim_LCD_t*)context;
+	unsigned long long now = Sim_Time_ns;
+	uint8 nibble;
+
+	if(port != lcd->Port){
+		return;
+	}
+	else if(!(before & lcd->EN) && (after & lcd->EN)){
+		lcd->EN_Rise_ns = now;
+	}
+	else if((before & lcd->EN) && !(after & lcd->EN)){
+		if((now - lcd->EN_Rise_ns) < SIM_LCD_PW_EH_NS){
+			Sim_LCD_Violation(lcd, "enable high for", now - lcd->EN_Rise_ns, SIM_LCD_PW_EH_NS);
+		}
+		else{ /* Do Nothing */ }
+		if(lcd->Last_Fall_ns && ((now - lcd->Last_Fall_ns) < SIM_LCD_TCYC_E_NS)){
+			Sim_LCD_Violation(lcd, "enable cycle of", now - lcd->Last_Fall_ns, SIM_LCD_TCYC_E_NS);
+		}
+		else{ /* Do Nothing */ }
+		if(now < lcd->Busy_Until_ns){
+			Sim_LCD_Violation(lcd, "write while busy, previous instruction ran", now - lcd->Busy_Start_ns, lcd->Busy_Until_ns - lcd->Busy_Start_ns);
+		}
+		else{ /* Do Nothing */ }
+		lcd->Last_Fall_ns = now;
+
+		nibble = (uint8)(((after & lcd->D4) ? 0x1 : 0) | ((after & lcd->D5) ? 0x2 : 0) |
+						 ((after & lcd->D6) ? 0x4 : 0) | ((after & lcd->D7) ? 0x8 : 0));
+		if(!lcd->Four_Bit){
+			/* 8-bit interface, D0-D3 are not wired and read 0 */
+			Sim_LCD_Execute(lcd, (after & lcd->RS) ? 1 : 0, (uint8)(nibble << 4), now);
+		}
+		else if(!lcd->Nibble_Pending){
+			lcd->High_Nibble = nibble;
+			lcd->Nibble_Pending = 1;
+		}
+		else{
+			lcd->Nibble_Pending = 0;
+			Sim_LCD_Execute(lcd, (after & lcd->RS) ? 1 : 0, (uint8)((lcd->High_Nibble << 4) | nibble), now);
+		}
+	}
+	else{ /* Do Nothing */ }
+}
+
+//----------------------------------------------
+// Section: Simulation control
+//----------------------------------------------
+void Sim_LCD_Attach(Sim_LCD_t* lcd, GPIO_TypeDef* port, uint16 rs, uint16 en, uint16 d4, uint16 d5, uint16 d6, uint16 d7){
+	uint8 index;
+
+	lcd->Port = port;
+	lcd->RS = rs;
+	lcd->EN = en;
+	lcd->D4 = d4;
+	lcd->D5 = d5;
+	lcd->D6 = d6;
+	lcd->D7 = d7;
+	for(index = 0; index < sizeof(lcd->DDRAM); index++){
+		lcd->DDRAM[index] = ' ';
+	}
+	for(index = 0; index < sizeof(lcd->CGRAM); index++){
+		lcd->CGRAM[index] = 0;
+	}
+	lcd->AC = 0;
+	lcd->In_CGRAM = 0;
+	lcd->Increment = 1;
+	lcd->Four_Bit = 0;
+	lcd->Resets = 0;
+	lcd->Nibble_Pending = 0;
+	lcd->EN_Rise_ns = 0;
+	lcd->Last_Fall_ns = 0;
+	lcd->Busy_Start_ns = Sim_Time_ns;
+	lcd->Busy_Until_ns = Sim_Time_ns + SIM_LCD_POWER_ON_NS;
+	Sim_LCD_Clear_Stats(lcd);
+	Sim_GPIO_Add_Listener(Sim_LCD_Listener, lcd);
+}
+
+void Sim_LCD_Row(const Sim_LCD_t* lcd, uint8 row, char* text){
+	uint8 column;
+	for(column = 0; column < 16; column++){
+		text[column] = (char)lcd->DDRAM[Sim_LCD_Row_Address[row & 3] + column];
+	}
+	text[16] = '\0';
+}
+
+void Sim_LCD_Clear_Stats(Sim_LCD_t* lcd){
+	lcd->Commands = 0;
+	lcd->Data_Writes = 0;
+	lcd->CGRAM_Writes = 0;
+	lcd->Violations = 0;
+}
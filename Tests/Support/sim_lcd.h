@@ -0,0 +1,74 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_lcd.h 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef SUPPORT_SIM_LCD_H_
+#define SUPPORT_SIM_LCD_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "sim_gpio.h"
+#include "sim_time.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+/* HD44780U datasheet, fosc = 270 kHz */
+#define SIM_LCD_POWER_ON_NS		15000000ULL	// VCC rise to the first instruction (4.5 V)
+#define SIM_LCD_RESET1_NS		4100000ULL	// After the first function set of the initialization by instruction
+#define SIM_LCD_RESET2_NS		100000ULL	// After the second one
+#define SIM_LCD_CLEAR_HOME_NS	1520000ULL
+#define SIM_LCD_COMMAND_NS		37000ULL
+#define SIM_LCD_DATA_NS			41000ULL	// 37 us write and 4 us address counter update
+#define SIM_LCD_PW_EH_NS		450ULL		// Enable pulse width (high level)
+#define SIM_LCD_TCYC_E_NS		1000ULL		// Enable cycle time
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+typedef struct{
+	/* Wiring, 4-bit bus on one port */
+	GPIO_TypeDef* Port;
+	uint16 RS, EN, D4, D5, D6, D7;
+
+	/* Controller state */
+	uint8 DDRAM[0x68];
+	uint8 CGRAM[64];
+	uint8 AC;
+	uint8 In_CGRAM;
+	uint8 Increment;
+	uint8 Four_Bit;
+	uint8 Resets;				// Function sets of the initialization by instruction seen
+	uint8 Nibble_Pending;
+	uint8 High_Nibble;
+	unsigned long long EN_Rise_ns, Last_Fall_ns, Busy_Start_ns, Busy_Until_ns;
+
+	/* Bus statistics */
+	unsigned long Commands;		// Instructions, including the 8-bit initialization ones
+	unsigned long Data_Writes;	// DDRAM writes
+	unsigned long CGRAM_Writes;
+	unsigned long Violations;	// Timing violations, each one is printed
+}Sim_LCD_t;
+
+/*
+ * =============================================
+ * Simulated HD44780 on the simulated GPIO
+ * =============================================
+ */
+
+/* Powers the controller on at the current time and listens to its pins */
+void Sim_LCD_Attach(Sim_LCD_t* lcd, GPIO_TypeDef* port, uint16 rs, uint16 en, uint16 d4, uint16 d5, uint16 d6, uint16 d7);
+
+/* Copies a row of the display (0...3) as a 16 character string */
+void Sim_LCD_Row(const Sim_LCD_t* lcd, uint8 row, char* text);
+
+/* Clears the bus statistics, the controller state is kept */
+void Sim_LCD_Clear_Stats(Sim_LCD_t* lcd);
+
+#endif /* SUPPORT_SIM_LCD_H_ */
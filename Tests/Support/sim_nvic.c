@@ -0,0 +1,135 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_nvic.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "sim_nvic.h"
+
+#define SIM_AIRCR_RESET		0xFA050000UL	// VECTKEYSTAT reads back inverted
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+NVIC_TypeDef Sim_NVIC;
+SCB_TypeDef Sim_SCB;
+DWT_TypeDef Sim_DWT;
+CoreDebug_TypeDef Sim_CoreDebug;
+uint32 Sim_PRIMASK, Sim_BASEPRI;
+void (*Sim_Flash_Vectors[NVIC_VECTORS_COUNT])(void);
+void (* const * Sim_Vector_Table)(void);
+unsigned long Sim_VTOR_Writes;
+uint32 Sim_VTOR_Write_PRIMASK;
+unsigned long Sim_DSBs, Sim_ISBs;
+static uint8 Sim_DWT_Host_Clock;
+static unsigned long long Sim_DWT_Host_Last;
+
+//----------------------------------------------
+// Section: Special registers and barriers
+//----------------------------------------------
+
+/* "msr basepri_max": 0 never, otherwise only a more urgent level than the current one */
+static void Sim_Raise_BASEPRI(uint32 value){
+	value &= 0xFFUL;
+	if((0 != value) && ((0 == Sim_BASEPRI) || (value < Sim_BASEPRI))){
+		Sim_BASEPRI = value;
+	}
+	else{ /* Do Nothing */ }
+}
+
+static void Sim_Set_Vector_Table(void (* const * table)(void)){
+	Sim_Vector_Table = table;
+	Sim_SCB.VTOR = (uint32)(uintptr_t)table;
+	Sim_VTOR_Write_PRIMASK = Sim_PRIMASK;
+	Sim_VTOR_Writes++;
+}
+
+#undef NVIC_GET_PRIMASK
+#undef NVIC_SET_PRIMASK
+#undef NVIC_DISABLE_IRQ
+#undef NVIC_GET_BASEPRI
+#undef NVIC_RAISE_BASEPRI
+#undef NVIC_SET_BASEPRI
+#undef NVIC_DSB
+#undef NVIC_ISB
+#undef NVIC_GET_VECTOR_TABLE
+#undef NVIC_SET_VECTOR_TABLE
+#define NVIC_GET_PRIMASK(value)			((value) = Sim_PRIMASK)
+#define NVIC_SET_PRIMASK(value)			(Sim_PRIMASK = (value) & 1UL)
+#define NVIC_DISABLE_IRQ()				(Sim_PRIMASK = 1)
+#define NVIC_GET_BASEPRI(value)			((value) = Sim_BASEPRI)
+#define NVIC_RAISE_BASEPRI(value)		Sim_Raise_BASEPRI(value)
+#define NVIC_SET_BASEPRI(value)			(Sim_BASEPRI = (value) & 0xFFUL)
+#define NVIC_DSB()						(Sim_DSBs++)
+#define NVIC_ISB()						(Sim_ISBs++)
+#define NVIC_GET_VECTOR_TABLE()			Sim_Vector_Table
+#define NVIC_SET_VECTOR_TABLE(table)	Sim_Set_Vector_Table(table)
+
+#include "../../MCAL/NVIC_driver.c"
+
+//----------------------------------------------
+// Section: Model
+//----------------------------------------------
+static uint8 Sim_DWT_Counting(void){
+	return ((Sim_CoreDebug.DEMCR & NVIC_DEMCR_TRCENA) && (Sim_DWT.CTRL & NVIC_DWT_CYCCNTENA)) ? 1 : 0;
+}
+
+static unsigned long long Sim_Host_ns(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((unsigned long long)now.tv_sec * 1000000000ULL) + (unsigned long long)now.tv_nsec;
+}
+
+DWT_TypeDef* Sim_DWT_Sync(void){
+	unsigned long long now;
+
+	if(Sim_DWT_Host_Clock){
+		now = Sim_Host_ns();
+		if(Sim_DWT_Counting()){
+			Sim_DWT.CYCCNT += (uint32)(now - Sim_DWT_Host_Last);
+		}
+		else{ /* Do Nothing */ }
+		Sim_DWT_Host_Last = now;
+	}
+	else{ /* Do Nothing */ }
+	return &Sim_DWT;
+}
+
+void Sim_DWT_Use_Host_Clock(uint8 enable){
+	Sim_DWT_Sync();
+	Sim_DWT_Host_Clock = enable;
+	Sim_DWT_Host_Last = Sim_Host_ns();
+}
+
+void Sim_DWT_Advance(uint32 cycles){
+	if(Sim_DWT_Counting()){
+		Sim_DWT.CYCCNT += cycles;
+	}
+	else{ /* Do Nothing */ }
+}
+
+void Sim_NVIC_Reset(void){
+	memset(&Sim_NVIC, 0, sizeof(Sim_NVIC));
+	memset(&Sim_SCB, 0, sizeof(Sim_SCB));
+	memset(&Sim_DWT, 0, sizeof(Sim_DWT));
+	memset(&Sim_CoreDebug, 0, sizeof(Sim_CoreDebug));
+	Sim_SCB.AIRCR = SIM_AIRCR_RESET;
+	Sim_PRIMASK = 0;
+	Sim_BASEPRI = 0;
+	Sim_Vector_Table = (void (* const *)(void))Sim_Flash_Vectors;
+	Sim_VTOR_Writes = 0;
+	Sim_VTOR_Write_PRIMASK = 0;
+	Sim_DSBs = 0;
+	Sim_ISBs = 0;
+	Sim_DWT_Host_Clock = 0;
+}
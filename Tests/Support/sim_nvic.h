@@ -0,0 +1,66 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_nvic.h 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef SUPPORT_SIM_NVIC_H_
+#define SUPPORT_SIM_NVIC_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "NVIC_driver.h"
+
+/*
+ * =============================================
+ * Simulated NVIC, SCB and DWT
+ * =============================================
+ * The real NVIC_driver.c runs against models of the core registers. PRIMASK and
+ * BASEPRI are variables, "msr basepri_max" only writes a value that masks more.
+ * The DWT cycle counter runs once TRCENA and CYCCNTENA are set, it advances when
+ * the test says so or follows the host clock in nanoseconds. VTOR holds the low
+ * 32 bits of the table address, the model keeps the full host pointer aside.
+ */
+
+/* Core peripherals of the driver under test */
+extern NVIC_TypeDef Sim_NVIC;
+extern SCB_TypeDef Sim_SCB;
+extern DWT_TypeDef Sim_DWT;
+extern CoreDebug_TypeDef Sim_CoreDebug;
+#undef NVIC
+#undef SCB
+#undef DWT
+#undef CoreDebug
+#define NVIC		(&Sim_NVIC)
+#define SCB			(&Sim_SCB)
+#define DWT			(Sim_DWT_Sync())
+#define CoreDebug	(&Sim_CoreDebug)
+
+/* Special registers */
+extern uint32 Sim_PRIMASK, Sim_BASEPRI;
+
+/* Vector table the core fetches from, the flash one out of reset */
+extern void (*Sim_Flash_Vectors[NVIC_VECTORS_COUNT])(void);
+extern void (* const * Sim_Vector_Table)(void);
+extern unsigned long Sim_VTOR_Writes;
+extern uint32 Sim_VTOR_Write_PRIMASK;		// PRIMASK while VTOR was written
+
+/* Barrier instructions executed */
+extern unsigned long Sim_DSBs, Sim_ISBs;
+
+/* Power on: registers cleared, VTOR 0 with the flash table aliased there */
+void Sim_NVIC_Reset(void);
+
+/* Runs the DWT cycle counter for a number of cycles, if it is enabled */
+void Sim_DWT_Advance(uint32 cycles);
+
+/* 1: the enabled counter counts the host nanoseconds, 0: only Sim_DWT_Advance moves it */
+void Sim_DWT_Use_Host_Clock(uint8 enable);
+
+/* DWT of the driver, brings CYCCNT up to date with the host clock first */
+DWT_TypeDef* Sim_DWT_Sync(void);
+
+#endif /* SUPPORT_SIM_NVIC_H_ */
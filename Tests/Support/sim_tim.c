@@ -0,0 +1,210 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_tim.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include "sim_tim.h"
+
+#define SIM_MAX_CALLBACKS	8
+#define SIM_OC_MODE_PWM1	6
+#define SIM_OC_MODE_PWM2	7
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+TIM_TypeDef Sim_TIM[4];
+Sim_TIM_Wave_t Sim_TIM_Wave[4];
+unsigned long Sim_TIM_Updates[4];
+uint32 Sim_TIMCLK1, Sim_TIMCLK2;
+uint8 Sim_TIM_Clock_Users[4];
+unsigned long long Sim_NVIC_Enabled;
+unsigned long Sim_TIM_Violations;
+
+/* Shadow registers, the ones the counter actually uses */
+static struct{
+	uint32 PSC, ARR, CCR[4];
+}Sim_Shadow[4];
+static void (*Sim_Clock_CallBacks[SIM_MAX_CALLBACKS])(void);
+static uint8 Sim_Clock_CallBacks_Count;
+
+#include "../../MCAL/PWM_driver.c"
+
+//----------------------------------------------
+// Section: Simulated RCC and NVIC
+//----------------------------------------------
+void MCAL_RCC_Get_Clock_Tree(RCC_ClockTree_t* tree){
+	tree->TIMCLK1 = Sim_TIMCLK1;
+	tree->TIMCLK2 = Sim_TIMCLK2;
+	tree->PCLK1 = Sim_TIMCLK1 / 2;
+	tree->PCLK2 = Sim_TIMCLK2;
+	tree->HCLK = Sim_TIMCLK2;
+	tree->SYSCLK = Sim_TIMCLK2;
+}
+
+void MCAL_RCC_Acquire_Peripheral(uint8 peripheral){
+	switch(peripheral){
+	case RCC_TIM1: Sim_TIM_Clock_Users[0]++; break;
+	case RCC_TIM2: Sim_TIM_Clock_Users[1]++; break;
+	case RCC_TIM3: Sim_TIM_Clock_Users[2]++; break;
+	case RCC_TIM4: Sim_TIM_Clock_Users[3]++; break;
+	default: break;
+	}
+}
+
+uint8 MCAL_RCC_Add_Clock_CallBack(void (*CallBack)(void)){
+	uint8 index, added = 1;
+
+	for(index = 0; (index < Sim_Clock_CallBacks_Count) && (Sim_Clock_CallBacks[index] != CallBack); index++);
+	if((index == Sim_Clock_CallBacks_Count) && (Sim_Clock_CallBacks_Count < SIM_MAX_CALLBACKS)){
+		Sim_Clock_CallBacks[Sim_Clock_CallBacks_Count++] = CallBack;
+	}
+	else if(index == Sim_Clock_CallBacks_Count){
+		added = 0;
+	}
+	else{ /* Do Nothing */ }
+	return added;
+}
+
+void MCAL_NVIC_EnableIRQ(uint8 IRQn){
+	Sim_NVIC_Enabled |= (1ULL << IRQn);
+}
+
+//----------------------------------------------
+// Section: Timer model
+//----------------------------------------------
+static void Sim_Violation(uint8 timer, const char* what){
+	if(Sim_TIM_Violations < 5){
+		printf("TIM%d model: %s\n", timer + 1, what);
+	}
+	else{ /* Do Nothing */ }
+	Sim_TIM_Violations++;
+}
+
+/* Mode of the output compare of a channel, from CCMR1 or CCMR2 */
+static uint8 Sim_OC_Mode(const TIM_TypeDef* TIMx, uint8 channel){
+	uint32 ccmr = (channel < 2) ? TIMx->CCMR1 : TIMx->CCMR2;
+
+	return (uint8)((ccmr >> (((channel & 1) * 8) + 4)) & 7UL);
+}
+
+static uint8 Sim_OC_Preload(const TIM_TypeDef* TIMx, uint8 channel){
+	uint32 ccmr = (channel < 2) ? TIMx->CCMR1 : TIMx->CCMR2;
+
+	return (ccmr & (TIM_CCMR_OC_PE << ((channel & 1) * 8))) ? 1 : 0;
+}
+
+static vuint32_t* Sim_CCR(TIM_TypeDef* TIMx, uint8 channel){
+	vuint32_t* ccr[4] = {&TIMx->CCR1, &TIMx->CCR2, &TIMx->CCR3, &TIMx->CCR4};
+
+	return ccr[channel];
+}
+
+/* Update event: the preloaded registers reach the shadows, UIF is set and the interrupt runs */
+static void Sim_Update_Event(uint8 timer, uint8 all){
+	TIM_TypeDef* TIMx = &Sim_TIM[timer];
+	static void (* const handlers[4])(void) = {TIM1_UP_IRQHandler, TIM2_IRQHandler, TIM3_IRQHandler, TIM4_IRQHandler};
+	static const uint8 irqs[4] = {TIM1_UP_IRQ, TIM2_IRQ, TIM3_IRQ, TIM4_IRQ};
+	uint8 channel;
+
+	Sim_Shadow[timer].PSC = TIMx->PSC;
+	if(all || (TIMx->CR1 & TIM_CR1_ARPE)){
+		Sim_Shadow[timer].ARR = TIMx->ARR;
+	}
+	else{ /* Do Nothing */ }
+	for(channel = 0; channel < 4; channel++){
+		if(all || Sim_OC_Preload(TIMx, channel)){
+			Sim_Shadow[timer].CCR[channel] = *Sim_CCR(TIMx, channel);
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	TIMx->SR |= TIM_SR_UIF;
+	if((TIMx->DIER & TIM_DIER_UIE) && (Sim_NVIC_Enabled & (1ULL << irqs[timer]))){
+		handlers[timer]();
+		Sim_TIM_Updates[timer]++;
+		/* SR is rc_w0, the handler writes 0 to the flags it clears */
+		if(TIMx->SR & TIM_SR_UIF){
+			Sim_Violation(timer, "update flag left set, the interrupt would run again at once");
+		}
+		else{ /* Do Nothing */ }
+	}
+	else{ /* Do Nothing */ }
+	TIMx->SR &= TIM_SR_UIF;
+}
+
+void Sim_TIM_Run(TIM_TypeDef* TIMx, uint32 periods){
+	uint8 timer = (uint8)(TIMx - Sim_TIM);
+	uint32 clock = (0 == timer) ? Sim_TIMCLK2 : Sim_TIMCLK1;
+	unsigned long long ticks, high;
+	uint8 channel, mode;
+
+	/* UG written since the last period: shadows loaded and counter restarted */
+	if(TIMx->EGR & TIM_EGR_UG){
+		TIMx->EGR = 0;
+		Sim_Update_Event(timer, 1);
+	}
+	else{ /* Do Nothing */ }
+
+	if(!(TIMx->CR1 & TIM_CR1_CEN)){
+		Sim_Violation(timer, "counter not enabled");
+		periods = 0;
+	}
+	else{ /* Do Nothing */ }
+
+	for(; periods > 0; periods--){
+		/* Registers without preload act at once */
+		if(!(TIMx->CR1 & TIM_CR1_ARPE)){
+			Sim_Shadow[timer].ARR = TIMx->ARR;
+		}
+		else{ /* Do Nothing */ }
+		ticks = (unsigned long long)Sim_Shadow[timer].ARR + 1;
+		Sim_TIM_Wave[timer].Period_ns = (ticks * (Sim_Shadow[timer].PSC + 1) * 1000000000ULL) / clock;
+
+		for(channel = 0; channel < 4; channel++){
+			if(!Sim_OC_Preload(TIMx, channel)){
+				Sim_Shadow[timer].CCR[channel] = *Sim_CCR(TIMx, channel);
+			}
+			else{ /* Do Nothing */ }
+			mode = Sim_OC_Mode(TIMx, channel);
+			high = (Sim_Shadow[timer].CCR[channel] < ticks) ? Sim_Shadow[timer].CCR[channel] : ticks;
+			high = (SIM_OC_MODE_PWM1 == mode) ? high : ((SIM_OC_MODE_PWM2 == mode) ? (ticks - high) : 0);
+			Sim_TIM_Wave[timer].Enabled[channel] = ((TIMx->CCER & (1UL << (channel * 4))) &&
+													((0 != timer) || (TIMx->BDTR & TIM_BDTR_MOE))) ? 1 : 0;
+			Sim_TIM_Wave[timer].High_ns[channel] = Sim_TIM_Wave[timer].Enabled[channel] ?
+													((high * (Sim_Shadow[timer].PSC + 1) * 1000000000ULL) / clock) : 0;
+		}
+
+		Sim_Update_Event(timer, 0);
+	}
+}
+
+void Sim_TIM_Set_Clocks(uint32 timclk1, uint32 timclk2){
+	uint8 index;
+
+	Sim_TIMCLK1 = timclk1;
+	Sim_TIMCLK2 = timclk2;
+	for(index = 0; index < Sim_Clock_CallBacks_Count; index++){
+		Sim_Clock_CallBacks[index]();
+	}
+}
+
+void Sim_TIM_Reset(void){
+	memset(Sim_TIM, 0, sizeof(Sim_TIM));
+	memset(Sim_Shadow, 0, sizeof(Sim_Shadow));
+	memset(Sim_TIM_Wave, 0, sizeof(Sim_TIM_Wave));
+	memset(Sim_TIM_Updates, 0, sizeof(Sim_TIM_Updates));
+	memset(Sim_TIM_Clock_Users, 0, sizeof(Sim_TIM_Clock_Users));
+	Sim_NVIC_Enabled = 0;
+	Sim_TIM_Violations = 0;
+	Sim_TIMCLK1 = 72000000UL;
+	Sim_TIMCLK2 = 72000000UL;
+}
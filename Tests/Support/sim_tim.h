@@ -0,0 +1,73 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_tim.h 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef SUPPORT_SIM_TIM_H_
+#define SUPPORT_SIM_TIM_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "PWM_driver.h"
+
+//----------------------------------------------
+// Section: User type definitions
+//----------------------------------------------
+
+/* Output of a timer over one counter period */
+typedef struct{
+	unsigned long long	Period_ns;
+	unsigned long long	High_ns[4];		// Time each channel output is high
+	uint8				Enabled[4];		// CCxE set, and MOE on TIM1
+}Sim_TIM_Wave_t;
+
+/*
+ * =============================================
+ * Simulated TIM1...TIM4
+ * =============================================
+ * The real PWM_driver.c runs against a model of the timer registers. A timer runs
+ * one counter period at a time with its shadow PSC, ARR and CCRx: PWM mode 1 keeps
+ * a channel high while CNT < CCRx. The update event at the end of the period loads
+ * the preloaded registers, sets UIF and runs the update interrupt when it is enabled.
+ * The timer clocks come from MCAL_RCC_Get_Clock_Tree of the model.
+ */
+
+/* Timers of the driver under test */
+extern TIM_TypeDef Sim_TIM[4];
+#undef TIM1
+#undef TIM2
+#undef TIM3
+#undef TIM4
+#define TIM1	(&Sim_TIM[0])
+#define TIM2	(&Sim_TIM[1])
+#define TIM3	(&Sim_TIM[2])
+#define TIM4	(&Sim_TIM[3])
+
+/* Waveform of the last period run and update interrupts taken by each timer */
+extern Sim_TIM_Wave_t Sim_TIM_Wave[4];
+extern unsigned long Sim_TIM_Updates[4];
+
+/* Timer clocks of the clock tree, TIMCLK2 is TIM1 */
+extern uint32 Sim_TIMCLK1, Sim_TIMCLK2;
+
+/* Timer clocks acquired from the RCC, IRQs enabled in the NVIC */
+extern uint8 Sim_TIM_Clock_Users[4];
+extern unsigned long long Sim_NVIC_Enabled;
+
+/* Hardware rules broken: update flag left set by the interrupt, counter stopped */
+extern unsigned long Sim_TIM_Violations;
+
+/* Power on: registers cleared, 72 MHz timer clocks */
+void Sim_TIM_Reset(void);
+
+/* Runs a timer for a number of counter periods */
+void Sim_TIM_Run(TIM_TypeDef* TIMx, uint32 periods);
+
+/* Changes the timer clocks and calls the clock callbacks, like MCAL_RCC_Select_Clock */
+void Sim_TIM_Set_Clocks(uint32 timclk1, uint32 timclk2);
+
+#endif /* SUPPORT_SIM_TIM_H_ */
@@ -0,0 +1,97 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_time.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "sim_time.h"
+
+//----------------------------------------------
+// Section: Global Variables Definitions
+//----------------------------------------------
+unsigned long long Sim_Time_ns;
+void (*Sim_Time_Hook)(void);
+
+static struct{
+	uint32 CNT, CR1, PSC, SR, DIER, ARR, EGR;
+}Sim_TIM2;
+static unsigned long long Sim_TIM2_Ticks;	// Prescaler outputs already added to CNT
+
+//----------------------------------------------
+// Section: Simulated registers
+//----------------------------------------------
+
+/* The counter only moves on whole microseconds of the virtual time and goes back
+ * to 0 after ARR once set, a write of 0 to CNT keeps the prescaler count running */
+volatile uint32* Sim_TIM2_CNT(void){
+	unsigned long long ticks;
+
+	Sim_Time_ns += SIM_TIME_CNT_ACCESS_NS;
+	if(NULL != Sim_Time_Hook){
+		Sim_Time_Hook();
+	}
+	else{ /* Do Nothing */ }
+	ticks = (Sim_Time_ns / 1000ULL) - Sim_TIM2_Ticks;
+	Sim_TIM2.CNT += (uint32)ticks;
+	Sim_TIM2_Ticks += ticks;
+	if(Sim_TIM2.ARR){
+		Sim_TIM2.CNT %= (Sim_TIM2.ARR + 1);
+	}
+	else{ /* Do Nothing */ }
+
+	return &Sim_TIM2.CNT;
+}
+
+void Sim_Time_Advance(unsigned long long ns){
+	Sim_Time_ns += ns;
+}
+
+uint32 Sim_TIM2_Prescaler(void){
+	return Sim_TIM2.PSC;
+}
+
+#undef TIM2_CNT
+#undef TIM2_CR1
+#undef TIM2_PSC
+#undef TIM2_SR
+#undef TIM2_DIER
+#undef TIM2_ARR
+#undef TIM2_EGR
+#define TIM2_CNT	(*Sim_TIM2_CNT())
+#define TIM2_CR1	(Sim_TIM2.CR1)
+#define TIM2_PSC	(Sim_TIM2.PSC)
+#define TIM2_SR		(Sim_TIM2.SR = 1)	// Update flag set by the first update event
+#define TIM2_DIER	(Sim_TIM2.DIER)
+#define TIM2_ARR	(Sim_TIM2.ARR)
+#define TIM2_EGR	(Sim_TIM2.EGR)
+
+#include "../../MCAL/Timer.c"
+
+//----------------------------------------------
+// Section: Default clock tree
+//----------------------------------------------
+
+/* 72 MHz tree for Timer2_init, replaced by the real RCC driver when it is linked */
+__attribute__((weak)) void MCAL_RCC_Get_Clock_Tree(RCC_ClockTree_t* tree){
+	tree->SYSCLK = 72000000UL;
+	tree->HCLK = 72000000UL;
+	tree->PCLK1 = 36000000UL;
+	tree->PCLK2 = 72000000UL;
+	tree->TIMCLK1 = 72000000UL;
+	tree->TIMCLK2 = 72000000UL;
+}
+
+__attribute__((weak)) void MCAL_RCC_Acquire_Peripheral(uint8 peripheral){
+	(void)peripheral;
+}
+
+__attribute__((weak)) uint8 MCAL_RCC_Add_Clock_CallBack(void (*CallBack)(void)){
+	(void)CallBack;
+	return 1;
+}
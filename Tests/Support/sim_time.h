@@ -0,0 +1,48 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : sim_time.h 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef SUPPORT_SIM_TIME_H_
+#define SUPPORT_SIM_TIME_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "Timer.h"
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+/* Core time spent by one access to TIM2_CNT, a few cycles at 72 MHz */
+#define SIM_TIME_CNT_ACCESS_NS	56ULL
+
+/*
+ * =============================================
+ * Simulated time base
+ * =============================================
+ * The real Timer.c runs against a TIM2 model: CNT counts whole microseconds of
+ * Sim_Time_ns up to ARR and writing it does not reset the prescaler, like the hardware.
+ */
+
+/* Virtual time in nanoseconds, only advanced by the simulation */
+extern unsigned long long Sim_Time_ns;
+
+/* Called on every TIM2_CNT access when set: a peripheral model and its interrupts
+ * run while the code under test polls the time, like the hardware next to the core */
+extern void (*Sim_Time_Hook)(void);
+
+/* Advances the virtual time, e.g. to move the TIM2 prescaler phase */
+void Sim_Time_Advance(unsigned long long ns);
+
+/* TIM2_CNT of the model, advances the time by one access */
+volatile uint32* Sim_TIM2_CNT(void);
+
+/* TIM2_PSC last written by the driver */
+uint32 Sim_TIM2_Prescaler(void);
+
+#endif /* SUPPORT_SIM_TIME_H_ */
@@ -0,0 +1,40 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test.h 			                             		 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+#ifndef SUPPORT_TEST_H_
+#define SUPPORT_TEST_H_
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <stdio.h>
+
+//----------------------------------------------
+// Section: Macros Configuration References
+//----------------------------------------------
+
+/* Counts the failed checks of a test program, its exit code */
+extern int Test_Failures;
+
+#define TEST_CHECK(_COND_)	do{ \
+		if(!(_COND_)){ printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #_COND_); Test_Failures++; } \
+	}while(0)
+
+/* Checks that two integer expressions are equal and prints both values if not */
+#define TEST_CHECK_EQ(_ACTUAL_, _EXPECTED_)	do{ \
+		long long _a_ = (long long)(_ACTUAL_), _e_ = (long long)(_EXPECTED_); \
+		if(_a_ != _e_){ printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #_ACTUAL_, _a_, _e_); Test_Failures++; } \
+	}while(0)
+
+/* Defines Test_Failures, once in each test program */
+#define TEST_MAIN_DEFINITIONS	int Test_Failures
+
+/* Prints the verdict and returns the exit code of main */
+#define TEST_RESULT(_NAME_)	(printf("%s: %s\n", (_NAME_), Test_Failures ? "FAILED" : "PASS"), (Test_Failures ? 1 : 0))
+
+#endif /* SUPPORT_TEST_H_ */
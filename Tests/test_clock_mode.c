@@ -0,0 +1,193 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_clock_mode.c 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Clock mode switches on the TIM2 model with scripted 115200 baud traffic on
+ * the RX line: the switch waits for a whole idle frame, never lands inside a
+ * character and gives up after CLOCK_MODE_RX_IDLE_TIMEOUT_US of real time */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "test.h"
+#include "sim_time.h"
+#include "clock_mode.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#define BAUDRATE			115200UL
+#define BIT_NS				(1000000000ULL / BAUDRATE)
+#define CHAR_BITS			10					// Start, 8 data and stop bits
+#define FRAME_US			(((CLOCK_MODE_FRAME_BITS * 1000000UL) / BAUDRATE) + 1)
+#define SIM_GPIO_READ_NS	150ULL				// Core time of one RX pin read
+#define SLACK_NS			2000ULL				// Sampling and timer granularity
+#define COUNT_NS			1000ULL				// One TIM2 count: a start in the middle of one sees a count less
+#define MAX_CHARS			64
+
+//----------------------------------------------
+// Section: Simulated UART line, RCC and NVIC
+//----------------------------------------------
+static USART_TypeDef Sim_UART;
+static unsigned long long Sim_Char_Start_ns[MAX_CHARS];	// Start bit edges of the scripted characters
+static uint8 Sim_Char_Data[MAX_CHARS];
+static uint8 Sim_Chars;
+static uint8 Sim_Line_Low;								// Line held low (break or cable fault)
+static unsigned long long Sim_Switch_ns;
+static unsigned long Sim_Switches;
+static uint8 Sim_IRQ_Disabled;
+
+/* Level of the line at a time, the characters are sent LSB first */
+static uint8 Sim_RX_Level_At(unsigned long long time_ns){
+	uint8 level = !Sim_Line_Low;
+	uint8 index;
+	unsigned long long bit;
+
+	for(index = 0; index < Sim_Chars; index++){
+		if((time_ns >= Sim_Char_Start_ns[index]) && (time_ns < (Sim_Char_Start_ns[index] + CHAR_BITS * BIT_NS))){
+			bit = (time_ns - Sim_Char_Start_ns[index]) / BIT_NS;
+			level = (0 == bit) ? 0 : ((bit <= 8) ? ((Sim_Char_Data[index] >> (bit - 1)) & 1) : 1);
+		}
+		else{ /* Do Nothing */ }
+	}
+	return level;
+}
+
+/* Time since the line last went low, 0 while it is low */
+static unsigned long long Sim_High_Since_ns(unsigned long long time_ns){
+	unsigned long long back = 0;
+
+	while((back < time_ns) && Sim_RX_Level_At(time_ns - back)){
+		back += 100;
+	}
+	return back;
+}
+
+/* Index of the character on the wire at a time, Sim_Chars if none */
+static uint8 Sim_Char_At(unsigned long long time_ns){
+	uint8 index;
+	for(index = 0; index < Sim_Chars; index++){
+		if((time_ns >= Sim_Char_Start_ns[index]) && (time_ns < (Sim_Char_Start_ns[index] + CHAR_BITS * BIT_NS))){
+			break;
+		}
+		else{ /* Do Nothing */ }
+	}
+	return index;
+}
+
+uint32 MCAL_USART_Get_BaudRate(USART_TypeDef* USARTx){
+	return (&Sim_UART == USARTx) ? BAUDRATE : 0;
+}
+uint8 MCAL_USART_Get_RX_Level(USART_TypeDef* USARTx){
+	TEST_CHECK(&Sim_UART == USARTx);
+	Sim_Time_Advance(SIM_GPIO_READ_NS);
+	return Sim_RX_Level_At(Sim_Time_ns);
+}
+void MCAL_USART_Wait_TC(USART_TypeDef* USARTx){ (void)USARTx; }
+uint32 MCAL_NVIC_Disable_Global_IRQ(void){ Sim_IRQ_Disabled = 1; return 0; }
+void MCAL_NVIC_Restore_Global_IRQ(uint32 primask){ (void)primask; Sim_IRQ_Disabled = 0; }
+void MCAL_RCC_Select_Clock(uint8 clock){
+	(void)clock;
+	TEST_CHECK(Sim_IRQ_Disabled);
+	Sim_Switch_ns = Sim_Time_ns;
+	Sim_Switches++;
+}
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+
+/* Scripts characters every period_ns from a time, data taken from a pattern */
+static void Script_Chars(unsigned long long start_ns, unsigned long long period_ns, uint8 count){
+	static const uint8 pattern[] = {0x00, 0x55, 0xFF, 0x30, 0x7F, 0xFE, 0x81, 0x0D};
+	uint8 index;
+
+	Sim_Chars = 0;
+	for(index = 0; index < count; index++){
+		Sim_Char_Start_ns[index] = start_ns + index * period_ns;
+		Sim_Char_Data[index] = pattern[index % sizeof(pattern)];
+		Sim_Chars++;
+	}
+}
+
+/* Switches to the other mode and returns the time the switch took */
+static unsigned long long Switch(void){
+	unsigned long long start = Sim_Time_ns;
+	unsigned long switches = Sim_Switches;
+
+	Clock_Mode_Set((CLOCK_MODE_ACTIVE == Clock_Mode_Get()) ? CLOCK_MODE_LOW_POWER : CLOCK_MODE_ACTIVE);
+	TEST_CHECK_EQ(Sim_Switches, switches + 1);
+	TEST_CHECK(!Sim_IRQ_Disabled);
+	return Sim_Switch_ns - start;
+}
+
+/* Puts the TIM2 count a number of microseconds before its wrap */
+static void Before_Wrap(uint32 us){
+	uint32 count = Timer2_Get_us();
+	Sim_Time_Advance((unsigned long long)((2 * 50001UL - us - count) % 50001UL) * 1000ULL);
+}
+
+int main(void){
+	unsigned long long took, end_ns;
+	uint16 phase;
+	uint8 last;
+
+	Timer2_init();
+	Clock_Mode_Init(CLOCK_MODE_LOW_POWER);
+	TEST_CHECK_EQ(Clock_Mode_Add_UART(&Sim_UART), 1);
+
+	/* Idle line: one frame time, also across the TIM2 wrap */
+	for(phase = 0; phase < 200; phase += 5){
+		Before_Wrap(phase);
+		took = Switch();
+		TEST_CHECK((took >= FRAME_US * 1000ULL - COUNT_NS) && (took <= FRAME_US * 1000ULL + SLACK_NS));
+	}
+
+	/* A card frame of 14 characters back to back, starting before the request */
+	for(phase = 0; phase < 100; phase += 3){
+		Script_Chars(Sim_Time_ns + 10000ULL - phase * 100ULL, CHAR_BITS * BIT_NS, 14);
+		end_ns = Sim_Char_Start_ns[13] + CHAR_BITS * BIT_NS;
+		Switch();
+		TEST_CHECK_EQ(Sim_Char_At(Sim_Switch_ns), Sim_Chars);
+		TEST_CHECK(Sim_Switch_ns >= end_ns);
+		TEST_CHECK(Sim_High_Since_ns(Sim_Switch_ns) >= (FRAME_US * 1000ULL - COUNT_NS));
+		TEST_CHECK(Sim_Switch_ns <= end_ns + FRAME_US * 1000ULL + SLACK_NS);
+	}
+
+	/* Characters with 200 us gaps keep coming: the switch lands in a gap, after a whole idle frame */
+	for(phase = 0; phase < 200; phase += 7){
+		Before_Wrap(phase);
+		Script_Chars(Sim_Time_ns + phase * 1000ULL, CHAR_BITS * BIT_NS + 200000ULL, MAX_CHARS);
+		Switch();
+		last = Sim_Char_At(Sim_Switch_ns);
+		TEST_CHECK_EQ(last, Sim_Chars);
+		TEST_CHECK(Sim_High_Since_ns(Sim_Switch_ns) >= (FRAME_US * 1000ULL - COUNT_NS));
+	}
+	Sim_Chars = 0;
+
+	/* Line held low: the switch goes on after the timeout, measured in real time */
+	Sim_Line_Low = 1;
+	for(phase = 0; phase < 200; phase += 50){
+		Before_Wrap(phase);
+		took = Switch();
+		TEST_CHECK((took >= CLOCK_MODE_RX_IDLE_TIMEOUT_US * 1000ULL - COUNT_NS) && (took <= CLOCK_MODE_RX_IDLE_TIMEOUT_US * 1000ULL + SLACK_NS));
+	}
+	Sim_Line_Low = 0;
+
+	/* Busy goes active at once, idle goes back to low power after CLOCK_MODE_IDLE_DELAY_MS */
+	Clock_Mode_Set(CLOCK_MODE_LOW_POWER);
+	Clock_Mode_Update(1, 10);
+	TEST_CHECK_EQ(Clock_Mode_Get(), CLOCK_MODE_ACTIVE);
+	for(phase = 0; phase < CLOCK_MODE_IDLE_DELAY_MS; phase += 10){
+		Clock_Mode_Update(0, 10);
+	}
+	TEST_CHECK_EQ(Clock_Mode_Get(), CLOCK_MODE_ACTIVE);
+	Clock_Mode_Update(0, 10);
+	TEST_CHECK_EQ(Clock_Mode_Get(), CLOCK_MODE_LOW_POWER);
+
+	return TEST_RESULT("test_clock_mode");
+}
@@ -0,0 +1,86 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_eeprom_24cxx.c 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* 24Cxx EEPROM driver over the real I2C driver and the I2C1 model: ACK polling
+ * of a write cycle left by a reset, writes split at the page ends, the next
+ * access waiting for the cycle of the last page */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include "test.h"
+#include "sim_i2c.h"
+#include "eeprom_24cxx.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#include "../HAL/eeprom_24cxx.c"
+
+#define LENGTH		300
+#define ADDRESS		21
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+int main(void){
+	uint8 source[LENGTH], data[LENGTH];
+	unsigned long nacks;
+	uint16 index;
+
+	Timer2_init();
+	Sim_I2C_Reset();
+	memset(Sim_I2C_Memory, 0xFF, sizeof(Sim_I2C_Memory));
+	for(index = 0; index < LENGTH; index++){
+		source[index] = (uint8)((index * 7) + 3);
+	}
+
+	/* A write cycle cut by the reset: polled until the EEPROM answers */
+	Sim_I2C_Busy_Until_ns = Sim_Time_ns + 3000000ULL;
+	TEST_CHECK_EQ(AT24_Init(), AT24_OK);
+	TEST_CHECK(Sim_I2C_Address_NACKs > 10);
+	TEST_CHECK(Sim_Time_ns >= Sim_I2C_Busy_Until_ns);
+
+	/* Starts in the middle of a page: 11 bytes, nine pages and one byte */
+	TEST_CHECK_EQ(AT24_Write(ADDRESS, source, LENGTH), AT24_OK);
+	TEST_CHECK_EQ(Sim_I2C_Page_Writes, 11);
+	TEST_CHECK(Sim_I2C_Max_Write_Bytes <= AT24_PAGE_SIZE);
+	memset(data, 0, sizeof(data));
+	TEST_CHECK_EQ(AT24_Read(ADDRESS, data, LENGTH), AT24_OK);
+	TEST_CHECK(0 == memcmp(source, data, LENGTH));
+	TEST_CHECK(0 == memcmp(source, &Sim_I2C_Memory[ADDRESS], LENGTH));
+	TEST_CHECK_EQ(Sim_I2C_Memory[ADDRESS - 1], 0xFF);
+	TEST_CHECK_EQ(Sim_I2C_Memory[ADDRESS + LENGTH], 0xFF);
+	printf("%d bytes written in %lu pages, %lu ACK polls NACKed\n", LENGTH, Sim_I2C_Page_Writes, Sim_I2C_Address_NACKs);
+
+	/* The write returns with the cycle running, the next read polls it */
+	nacks = Sim_I2C_Address_NACKs;
+	TEST_CHECK_EQ(AT24_Write(4000, source, 5), AT24_OK);
+	TEST_CHECK(Sim_Time_ns < Sim_I2C_Busy_Until_ns);
+	TEST_CHECK_EQ(Sim_I2C_Address_NACKs, nacks);
+	TEST_CHECK_EQ(AT24_Read(4000, data, 5), AT24_OK);
+	TEST_CHECK(Sim_I2C_Address_NACKs > nacks);
+	TEST_CHECK(0 == memcmp(source, data, 5));
+
+	/* Past the end of the memory: nothing sent */
+	nacks = Sim_I2C_Page_Writes;
+	TEST_CHECK_EQ(AT24_Write(AT24_SIZE - 2, source, 5), AT24_ERROR);
+	TEST_CHECK_EQ(AT24_Read(AT24_SIZE - 2, data, 5), AT24_ERROR);
+	TEST_CHECK_EQ(Sim_I2C_Page_Writes, nacks);
+
+	/* The EEPROM never answers: error after AT24_ACK_POLL_TRIES polls */
+	TEST_CHECK_EQ(AT24_Write(0, source, 1), AT24_OK);
+	Sim_I2C_Busy_Until_ns = ~0ULL;
+	nacks = Sim_I2C_Address_NACKs;
+	TEST_CHECK_EQ(AT24_Read(0, data, 1), AT24_ERROR);
+	TEST_CHECK_EQ(Sim_I2C_Address_NACKs - nacks, AT24_ACK_POLL_TRIES);
+	TEST_CHECK_EQ(Sim_I2C_Violations, 0);
+
+	return TEST_RESULT("test_eeprom_24cxx");
+}
@@ -0,0 +1,241 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_eeprom_emul.c 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Emulated EEPROM on a flash model of its two pages: scan of the records after
+ * a reset, page transfers against a reference copy of the values, balanced wear
+ * and a power cut at every flash operation of a transferring write */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include "test.h"
+#include "eeprom_emul.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#define RANDOM_WRITES		5000UL
+#define CUT_RUNS			400UL
+#define SIM_PAGE_HALFWORDS	(FLASH_PAGE_SIZE / 2)
+#define SIM_NO_CUT			0xFFFFFFFFUL
+
+//----------------------------------------------
+// Section: Simulated flash
+//----------------------------------------------
+static uint16 Sim_Flash[2 * SIM_PAGE_HALFWORDS];
+static unsigned long Sim_Erases[2];
+static unsigned long Sim_Flash_Ops;		// Flash accesses of any kind, for the image check
+static uint32 Sim_Ops_Left = SIM_NO_CUT;	// Erase and program operations before the power cut
+static uint8 Sim_Dead;					// Power cut: no more operation succeeds
+static uint8 Sim_Cut_Mid_Erase;			// The cut hits inside an erase rather than before it
+static uint32 Sim_Image_End = FLASH_MEMORY_BASE + 0x8000UL;
+
+#define EEPROM_IMAGE_END	Sim_Image_End
+
+/* Counts an operation, returns 0 once the power is cut */
+static uint8 Sim_Operation(void){
+	uint8 alive = 0;
+
+	Sim_Flash_Ops++;
+	if(Sim_Dead){
+		/* Do Nothing */
+	}
+	else if(0 == Sim_Ops_Left){
+		Sim_Dead = 1;
+	}
+	else{
+		if(SIM_NO_CUT != Sim_Ops_Left){
+			Sim_Ops_Left--;
+		}
+		else{ /* Do Nothing */ }
+		alive = 1;
+	}
+	return alive;
+}
+
+static uint16* Sim_Cell(uint32 address){
+	TEST_CHECK((address >= EEPROM_PAGE0_ADDRESS) && (address < (EEPROM_PAGE1_ADDRESS + FLASH_PAGE_SIZE)) && !(address & 1));
+	return &Sim_Flash[((address - EEPROM_PAGE0_ADDRESS) / 2) % (2 * SIM_PAGE_HALFWORDS)];
+}
+
+void MCAL_FLASH_Unlock(void){ }
+void MCAL_FLASH_Lock(void){ }
+
+uint16 MCAL_FLASH_Read_HalfWord(uint32 address){
+	Sim_Flash_Ops++;
+	return *Sim_Cell(address);
+}
+
+/* A cut inside the erase leaves the first half of the page erased */
+uint8 MCAL_FLASH_Erase_Page(uint32 address){
+	uint8 page = (uint8)((address - EEPROM_PAGE0_ADDRESS) / FLASH_PAGE_SIZE);
+	uint8 return_value = FLASH_ERROR;
+	uint8 was_dead = Sim_Dead;
+
+	TEST_CHECK(0 == ((address - EEPROM_PAGE0_ADDRESS) % FLASH_PAGE_SIZE));
+	if(Sim_Operation()){
+		memset(&Sim_Flash[page * SIM_PAGE_HALFWORDS], 0xFF, FLASH_PAGE_SIZE);
+		Sim_Erases[page]++;
+		return_value = FLASH_OK;
+	}
+	else if(!was_dead && Sim_Cut_Mid_Erase){
+		memset(&Sim_Flash[page * SIM_PAGE_HALFWORDS], 0xFF, FLASH_PAGE_SIZE / 2);
+	}
+	else{ /* Do Nothing */ }
+	return return_value;
+}
+
+/* Programming a written cell only works with 0, anything else is a PGERR */
+uint8 MCAL_FLASH_Program_HalfWord(uint32 address, uint16 data){
+	uint16* cell = Sim_Cell(address);
+	uint8 return_value = FLASH_ERROR;
+
+	if(Sim_Operation()){
+		TEST_CHECK((FLASH_ERASED_HALFWORD == *cell) || (0 == data));
+		*cell = data;
+		return_value = FLASH_OK;
+	}
+	else{ /* Do Nothing */ }
+	return return_value;
+}
+
+#include "../HAL/eeprom_emul.c"
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+static uint32 Seed = 12345;
+static char Reference[EEPROM_MAX_KEYS][EEPROM_MAX_LENGTH + 1];
+
+static uint32 Random(void){
+	Seed = (Seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+	return (Seed >> 8) & 0xFFFFUL;
+}
+
+/* 1 if the key holds value, or has no value for NULL and "" */
+static uint8 Holds(uint8 key, const char* value){
+	uint8 data[EEPROM_MAX_LENGTH], length = 0;
+	uint8 found = (EEPROM_OK == EEPROM_Read(key, data, &length));
+
+	return ((NULL == value) || ('\0' == value[0])) ? !found :
+			(found && (length == strlen(value)) && (0 == memcmp(data, value, length)));
+}
+
+static void Random_Value(char* value, uint8 length, char first){
+	uint8 index;
+
+	for(index = 0; index < length; index++){
+		value[index] = (char)(first + (Random() % 26));
+	}
+	value[length] = '\0';
+}
+
+static uint8 Holds_Reference(void){
+	uint8 key, same = 1;
+
+	for(key = 0; key < EEPROM_MAX_KEYS; key++){
+		same = same && Holds(key, Reference[key]);
+	}
+	return same;
+}
+
+int main(void){
+	char value[EEPROM_MAX_LENGTH + 1];
+	unsigned long run, cuts = 0, both_cuts = 0;
+	uint8 key, length, result, was_dead, newer, both_active;
+
+	/* Last two pages of the 64 KB flash */
+	TEST_CHECK_EQ(EEPROM_PAGE0_ADDRESS, 0x0800F800UL);
+	TEST_CHECK_EQ(EEPROM_PAGE1_ADDRESS, 0x0800FC00UL);
+
+	/* A program image reaching the pages: no flash access at all */
+	memset(Sim_Flash, 0x5A, sizeof(Sim_Flash));
+	Sim_Image_End = EEPROM_PAGE0_ADDRESS + 4;
+	TEST_CHECK_EQ(EEPROM_Init(), EEPROM_ERROR);
+	TEST_CHECK_EQ(Sim_Flash_Ops, 0);
+	TEST_CHECK_EQ(EEPROM_Write(0, (const uint8*)"a", 1), EEPROM_ERROR);
+	TEST_CHECK_EQ(Sim_Flash_Ops, 0);
+	TEST_CHECK_EQ(Sim_Flash[0], 0x5A5A);
+	Sim_Image_End = EEPROM_PAGE0_ADDRESS;
+
+	/* Garbage in both pages: formatted on the first boot */
+	TEST_CHECK_EQ(EEPROM_Init(), EEPROM_OK);
+	TEST_CHECK(Holds(0, NULL));
+	TEST_CHECK_EQ(EEPROM_Write(0, (const uint8*)"1234567890", 10), EEPROM_OK);
+	TEST_CHECK_EQ(EEPROM_Write(1, (const uint8*)"abc", 3), EEPROM_OK);
+	strcpy(Reference[0], "1234567890");
+	strcpy(Reference[1], "abc");
+	TEST_CHECK_EQ(EEPROM_Init(), EEPROM_OK);
+	TEST_CHECK(Holds_Reference());
+
+	/* The saved value again costs no flash write, bad keys and lengths are refused */
+	TEST_CHECK_EQ(EEPROM_Free, EEPROM_RECORDS_OFFSET + EEPROM_RECORD_SIZE(10) + EEPROM_RECORD_SIZE(3));
+	TEST_CHECK_EQ(EEPROM_Write(1, (const uint8*)"abc", 3), EEPROM_OK);
+	TEST_CHECK_EQ(EEPROM_Free, EEPROM_RECORDS_OFFSET + EEPROM_RECORD_SIZE(10) + EEPROM_RECORD_SIZE(3));
+	TEST_CHECK_EQ(EEPROM_Write(EEPROM_MAX_KEYS, (const uint8*)"a", 1), EEPROM_ERROR);
+	TEST_CHECK_EQ(EEPROM_Write(0, (const uint8*)"a", EEPROM_MAX_LENGTH + 1), EEPROM_ERROR);
+	TEST_CHECK(Holds_Reference());
+
+	/* Random writes and deletes through many page transfers, a reset now and then */
+	for(run = 0; (run < RANDOM_WRITES) && !Test_Failures; run++){
+		key = (uint8)(Random() % 4);
+		length = (uint8)(Random() % (EEPROM_MAX_LENGTH + 1));
+		Random_Value(value, length, 'a');
+		TEST_CHECK_EQ(EEPROM_Write(key, (const uint8*)value, length), EEPROM_OK);
+		strcpy(Reference[key], value);
+		if(0 == (run % 500)){
+			TEST_CHECK_EQ(EEPROM_Init(), EEPROM_OK);
+		}
+		else{ /* Do Nothing */ }
+		TEST_CHECK(Holds_Reference());
+	}
+	printf("%lu writes: %lu and %lu page erases\n", RANDOM_WRITES, Sim_Erases[0], Sim_Erases[1]);
+	TEST_CHECK(Sim_Erases[0] > 10);
+	TEST_CHECK((Sim_Erases[0] + 1 >= Sim_Erases[1]) && (Sim_Erases[1] + 1 >= Sim_Erases[0]));
+
+	/* Power cut at every operation of a write that transfers the page, then a reset:
+	 * every key keeps its old value, the written key may also hold the new one */
+	for(run = 0; (run < CUT_RUNS) && !Test_Failures; run++){
+		while((EEPROM_Free + EEPROM_RECORD_SIZE(EEPROM_MAX_LENGTH)) <= FLASH_PAGE_SIZE){
+			key = (uint8)(Random() % 4);
+			Random_Value(Reference[key], EEPROM_MAX_LENGTH, 'a');
+			TEST_CHECK_EQ(EEPROM_Write(key, (const uint8*)Reference[key], EEPROM_MAX_LENGTH), EEPROM_OK);
+		}
+		key = (uint8)(run % 4);
+		Random_Value(value, EEPROM_MAX_LENGTH, 'A');
+		Sim_Ops_Left = run % 120;
+		Sim_Cut_Mid_Erase = (uint8)((run / 120) & 1);
+		Sim_Dead = 0;
+		result = EEPROM_Write(key, (const uint8*)value, EEPROM_MAX_LENGTH);
+		was_dead = Sim_Dead;
+		Sim_Ops_Left = SIM_NO_CUT;
+		Sim_Dead = 0;
+
+		/* Cut between the end of a transfer and the erase of the old page: the newer one is kept */
+		both_active = (EEPROM_PAGE_ACTIVE == Sim_Flash[0]) && (EEPROM_PAGE_ACTIVE == Sim_Flash[SIM_PAGE_HALFWORDS]);
+		newer = ((sint16)(Sim_Flash[SIM_PAGE_HALFWORDS + 1] - Sim_Flash[1]) > 0) ? 1 : 0;
+		TEST_CHECK_EQ(EEPROM_Init(), EEPROM_OK);
+		TEST_CHECK(was_dead || (EEPROM_OK == result));
+		TEST_CHECK(!both_active || (newer == EEPROM_Active));
+		both_cuts += both_active;
+		if(Holds(key, value)){
+			strcpy(Reference[key], value);
+		}
+		else{
+			TEST_CHECK(EEPROM_OK != result);
+		}
+		TEST_CHECK(Holds_Reference());
+		cuts += was_dead;
+	}
+	printf("%lu power cuts recovered, %lu with both pages active\n", cuts, both_cuts);
+	TEST_CHECK(cuts > (CUT_RUNS / 2));
+	TEST_CHECK(both_cuts > 0);
+
+	return TEST_RESULT("test_eeprom_emul");
+}
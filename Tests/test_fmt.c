@@ -0,0 +1,147 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_fmt.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Formatter against the host printf for the supported subset, then the
+ * fixed-point writer, the buffer sink truncation and the LCD/USART sinks */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include <limits.h>
+#include "test.h"
+#include "fmt.h"
+
+TEST_MAIN_DEFINITIONS;
+
+//----------------------------------------------
+// Section: Sinks of the drivers
+//----------------------------------------------
+static char Sim_Out[64];
+static uint8 Sim_Out_Length;
+static void* Sim_Out_Target;
+
+void LCD_Send_Char(LCD_t* LCD_cfg, uint8 Char){
+	Sim_Out_Target = LCD_cfg;
+	Sim_Out[Sim_Out_Length++] = (char)Char;
+}
+
+void MCAL_USART_SendData(USART_TypeDef* USARTx, uint16 *pTxBuffer, Polling_Mechanism PollingEn){
+	TEST_CHECK_EQ(PollingEn, enable);
+	Sim_Out_Target = USARTx;
+	Sim_Out[Sim_Out_Length++] = (char)*pTxBuffer;
+}
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+static uint8 Data[64];
+static Fmt_Buffer_t Buffer;
+static Fmt_Sink_t Sink;
+
+static void Check_Output(const char* what, const char* expected){
+	if((0 != strcmp((const char*)Data, expected)) || (Sink.Count != strlen(expected))){
+		printf("%s: \"%s\" (%u characters), expected \"%s\"\n", what, Data, Sink.Count, expected);
+		Test_Failures++;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Formats with Fmt_Print and with the host snprintf, both must agree */
+#define CHECK_PRINT(...)	do{ \
+		char expected[64]; \
+		snprintf(expected, sizeof(expected), __VA_ARGS__); \
+		Fmt_Sink_Buffer(&Sink, &Buffer, Data, sizeof(Data)); \
+		Fmt_Print(&Sink, __VA_ARGS__); \
+		Check_Output(#__VA_ARGS__, expected); \
+	}while(0)
+
+#define CHECK_FIXED(_VALUE_, _DIGITS_, _WIDTH_, _FLAGS_, _EXPECTED_)	do{ \
+		Fmt_Sink_Buffer(&Sink, &Buffer, Data, sizeof(Data)); \
+		Fmt_Fixed(&Sink, (_VALUE_), (_DIGITS_), (_WIDTH_), (_FLAGS_)); \
+		Check_Output("Fmt_Fixed(" #_VALUE_ ", " #_DIGITS_ ")", (_EXPECTED_)); \
+	}while(0)
+
+int main(void){
+	LCD_t lcd;
+	uint8 small[6];
+
+	/* printf subset */
+	CHECK_PRINT("%d Slots free!", 3);
+	CHECK_PRINT("%d %i %d", 0, -7, INT_MAX);
+	CHECK_PRINT("%d", INT_MIN);
+	CHECK_PRINT("%u %u", 0U, UINT_MAX);
+	CHECK_PRINT("%x %X %x", 0xBEEFU, 0xBEEFU, 0U);
+	CHECK_PRINT("[%5d] [%-5d] [%05d] [%+d] [%+d]", 42, 42, 42, 42, -42);
+	CHECK_PRINT("[%05d] [%+06d] [%-+5d]", -42, 42, 7);
+	CHECK_PRINT("[%08X] [%-4x] [%2u]", 0x1A2BU, 0xAU, 12345U);
+	CHECK_PRINT("%ld %lu %lx %hd %hu", -123456L, 4000000000UL, 0xDEADBEEFUL, 12, 34);
+	CHECK_PRINT("%c%c%c", 'I', 'D', '!');
+	CHECK_PRINT("[%s] [%8s] [%-8s] [%2s]", "gate", "gate", "gate", "gate");
+	CHECK_PRINT("100%% %s", "");
+	CHECK_PRINT("User%d:%s", 1, "1234");
+
+	/* Conversions outside the subset are printed as is, a dangling '%' is dropped */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat"
+#pragma GCC diagnostic ignored "-Wformat-extra-args"
+	Fmt_Sink_Buffer(&Sink, &Buffer, Data, sizeof(Data));
+	Fmt_Print(&Sink, "%q", 1);
+	Check_Output("%q", "%q");
+	Fmt_Sink_Buffer(&Sink, &Buffer, Data, sizeof(Data));
+	Fmt_Print(&Sink, "end %");
+	Check_Output("end %", "end ");
+#pragma GCC diagnostic pop
+
+	/* Direct writers */
+	Fmt_Sink_Buffer(&Sink, &Buffer, Data, sizeof(Data));
+	Fmt_Uint(&Sink, 0xA5UL, 2, 10, FMT_FLAG_ZERO_PAD);
+	Check_Output("Fmt_Uint base 2", "0010100101");
+	Fmt_Sink_Buffer(&Sink, &Buffer, Data, sizeof(Data));
+	Fmt_Uint(&Sink, 255UL, 1, 0, FMT_FLAG_NONE);
+	Check_Output("Fmt_Uint bad base", "255");
+	Fmt_Sink_Buffer(&Sink, &Buffer, Data, sizeof(Data));
+	Fmt_String(&Sink, (const uint8*)"ab", 4, FMT_FLAG_LEFT);
+	Check_Output("Fmt_String", "ab  ");
+
+	CHECK_FIXED(1234, 2, 0, FMT_FLAG_NONE, "12.34");
+	CHECK_FIXED(-1234, 2, 0, FMT_FLAG_NONE, "-12.34");
+	CHECK_FIXED(5, 3, 0, FMT_FLAG_NONE, "0.005");
+	CHECK_FIXED(-5, 1, 0, FMT_FLAG_NONE, "-0.5");
+	CHECK_FIXED(250, 1, 7, FMT_FLAG_ZERO_PAD | FMT_FLAG_PLUS, "+0025.0");
+	CHECK_FIXED(250, 1, 7, FMT_FLAG_LEFT, "25.0   ");
+	CHECK_FIXED(42, 0, 0, FMT_FLAG_NONE, "42");
+	CHECK_FIXED(7, 12, 0, FMT_FLAG_NONE, "0.000000007");
+
+	/* Buffer sink: output is cut at Size - 1, still terminated and still counted */
+	Fmt_Sink_Buffer(&Sink, &Buffer, small, sizeof(small));
+	Fmt_Print(&Sink, "%s-%d", "Slots", 3);
+	TEST_CHECK_EQ(strcmp((const char*)small, "Slots"), 0);
+	TEST_CHECK_EQ(Buffer.Length, 5);
+	TEST_CHECK_EQ(Sink.Count, 7);
+	Fmt_Sink_Buffer(&Sink, &Buffer, small, 0);
+	Fmt_Print(&Sink, "x");
+	TEST_CHECK_EQ(Buffer.Length, 0);
+
+	/* LCD and USART sinks write one character at a time to their device */
+	Sim_Out_Length = 0;
+	Fmt_Sink_LCD(&Sink, &lcd);
+	Fmt_Print(&Sink, "%d Slots", 2);
+	TEST_CHECK(Sim_Out_Target == (void*)&lcd);
+	TEST_CHECK_EQ(memcmp(Sim_Out, "2 Slots", 7), 0);
+	TEST_CHECK_EQ(Sim_Out_Length, 7);
+	Sim_Out_Length = 0;
+	Fmt_Sink_USART(&Sink, USART1);
+	Fmt_Print(&Sink, "ID:%02X", 0x0BU);
+	TEST_CHECK(Sim_Out_Target == (void*)USART1);
+	TEST_CHECK_EQ(memcmp(Sim_Out, "ID:0B", 5), 0);
+	TEST_CHECK_EQ(Sim_Out_Length, 5);
+
+	return TEST_RESULT("test_fmt");
+}
@@ -0,0 +1,277 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_gate_session.c 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Gate sessions on the EXTI driver with its registers in memory: scripted
+ * PIR edge and arm sequences on the entry (line 4) and exit (line 1) gates */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "test.h"
+#include "gate_session.h"
+
+/* The EXTI driver on a simulated register block */
+#undef EXTI
+static EXTI_TypeDef Sim_EXTI;
+#define EXTI	(&Sim_EXTI)
+#include "../MCAL/EXTI_driver.c"
+
+TEST_MAIN_DEFINITIONS;
+
+#define ENTRY				0
+#define EXIT				1
+#define ENTRY_LINE			4
+#define EXIT_LINE			1
+
+/* Bit 31 is not a line: while it is set in PR the driver has not written the register,
+ * except for the all-ones write of DeInit */
+#define SIM_PR_UNWRITTEN	0x80000000UL
+
+//----------------------------------------------
+// Section: Simulated EXTI, AFIO, NVIC, servos and PIRs
+//----------------------------------------------
+static GPIO_TypeDef Sim_Port;			// PIR inputs, a level in IDR per pin
+static uint32 Sim_Pending;				// Pending lines, PR is write 1 to clear
+static uint32 Sim_NVIC_Enabled;			// Bit per IRQ number
+static GPIO_TypeDef* Sim_AFIO_Source[EXTI_LINES_COUNT];
+static uint8 Sim_AFIO_Clocked;
+static uint8 Sim_Arm_Target[2];
+static unsigned long Sim_Servo_Commands, Sim_Interrupts;
+
+static Gate_Session_t Sessions[2];
+static unsigned long Done_Count[2];
+
+void MCAL_AFIO_Init(void){ Sim_AFIO_Clocked = 1; }
+void MCAL_AFIO_DeInit(void){ Sim_AFIO_Clocked = 0; }
+void MCAL_AFIO_Set_EXTI_Source(uint8 line, GPIO_TypeDef* GPIOx){
+	TEST_CHECK(Sim_AFIO_Clocked);
+	Sim_AFIO_Source[line] = GPIOx;
+}
+void MCAL_NVIC_EnableIRQ(uint8 IRQn){ Sim_NVIC_Enabled |= (1UL << IRQn); }
+void MCAL_NVIC_DisableIRQ(uint8 IRQn){ Sim_NVIC_Enabled &= ~(1UL << IRQn); }
+
+void Servo_Set(uint8 Servo, uint8 Angle){
+	Sim_Arm_Target[Servo] = Angle;
+	Sim_Servo_Commands++;
+}
+
+/* Applies the ones the driver wrote to PR */
+static void Sim_Sync_PR(void){
+	if((0 == (Sim_EXTI.PR & SIM_PR_UNWRITTEN)) || (0xFFFFFFFFUL == Sim_EXTI.PR)){
+		Sim_Pending &= ~Sim_EXTI.PR;
+	}
+	else{ /* Do Nothing */ }
+	Sim_EXTI.PR = SIM_PR_UNWRITTEN | Sim_Pending;
+}
+
+/* Enabled pending lines run their handler, as the NVIC would */
+static void Sim_Interrupts_Run(void){
+	Sim_Sync_PR();
+	if((Sim_Pending & Sim_EXTI.IMR & (1UL << ENTRY_LINE)) && (Sim_NVIC_Enabled & (1UL << EXTI4_IRQ))){
+		Sim_Interrupts++;
+		EXTI4_IRQHandler();
+		Sim_Sync_PR();
+	}
+	else{ /* Do Nothing */ }
+	if((Sim_Pending & Sim_EXTI.IMR & (1UL << EXIT_LINE)) && (Sim_NVIC_Enabled & (1UL << EXTI1_IRQ))){
+		Sim_Interrupts++;
+		EXTI1_IRQHandler();
+		Sim_Sync_PR();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Drives a PIR output, the selected edges set the pending flag of the line */
+static void Sim_PIR(uint8 line, uint8 level){
+	uint32 bit = (1UL << line);
+	uint8 previous = (Sim_Port.IDR & bit) ? 1 : 0;
+
+	if(level && !previous && (Sim_EXTI.RTSR & bit)){
+		Sim_Pending |= bit;
+	}
+	else if(!level && previous && (Sim_EXTI.FTSR & bit)){
+		Sim_Pending |= bit;
+	}
+	else{ /* Do Nothing */ }
+	Sim_Port.IDR = level ? (Sim_Port.IDR | bit) : (Sim_Port.IDR & ~bit);
+	Sim_Interrupts_Run();
+}
+
+/* The arm reaches its last commanded angle */
+static void Sim_Arm_Stop(uint8 gate){
+	Gate_Session_Arm_Event(&Sessions[gate], Sim_Arm_Target[gate]);
+}
+
+/* Main loop ticks, nothing happens between events */
+static void Run(uint8 gate, unsigned long ticks){
+	while(ticks--){
+		Gate_Session_Update(&Sessions[gate]);
+	}
+}
+
+static void Entry_PIR_CallBack(void){ Gate_Session_PIR_Event(&Sessions[ENTRY]); }
+static void Exit_PIR_CallBack(void){ Gate_Session_PIR_Event(&Sessions[EXIT]); }
+static void Entry_Done_CallBack(void){ Done_Count[ENTRY]++; }
+static void Exit_Done_CallBack(void){ Done_Count[EXIT]++; }
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+int main(void){
+	unsigned long commands;
+
+	Sim_EXTI.PR = SIM_PR_UNWRITTEN;
+	/* Edges seen before the configuration are dropped */
+	Sim_Pending = (1UL << ENTRY_LINE);
+	Gate_Session_Init(&Sessions[ENTRY], ENTRY, &Sim_Port, ENTRY_LINE, Entry_PIR_CallBack, Entry_Done_CallBack);
+	Sim_Sync_PR();
+	Gate_Session_Init(&Sessions[EXIT], EXIT, &Sim_Port, EXIT_LINE, Exit_PIR_CallBack, Exit_Done_CallBack);
+	Sim_Sync_PR();
+	TEST_CHECK_EQ(Sim_Pending, 0);
+	TEST_CHECK(&Sim_Port == Sim_AFIO_Source[ENTRY_LINE]);
+	TEST_CHECK(&Sim_Port == Sim_AFIO_Source[EXIT_LINE]);
+	TEST_CHECK(!Sim_AFIO_Clocked);
+	TEST_CHECK_EQ(Sim_EXTI.FTSR, (1UL << ENTRY_LINE) | (1UL << EXIT_LINE));
+	TEST_CHECK_EQ(Sim_EXTI.RTSR, 0);
+	TEST_CHECK_EQ(Sim_EXTI.IMR, (1UL << ENTRY_LINE) | (1UL << EXIT_LINE));
+	TEST_CHECK_EQ(Sim_NVIC_Enabled, (1UL << EXTI4_IRQ) | (1UL << EXTI1_IRQ));
+	TEST_CHECK(!Gate_Session_Is_Busy(&Sessions[ENTRY]));
+
+	/* A car waits in front of the entry gate: up, wait for the falling edge, down */
+	Sim_PIR(ENTRY_LINE, 1);
+	TEST_CHECK_EQ(Sim_Interrupts, 0);
+	Gate_Session_Open(&Sessions[ENTRY]);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_OPENING);
+	TEST_CHECK_EQ(Sim_Arm_Target[ENTRY], GATE_ARM_OPEN_ANGLE);
+	TEST_CHECK(Gate_Session_Is_Busy(&Sessions[ENTRY]));
+	Run(ENTRY, 50);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_OPENING);
+	Sim_Arm_Stop(ENTRY);
+	Run(ENTRY, 1);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_WAIT_CAR);
+	commands = Sim_Servo_Commands;
+	Run(ENTRY, 1000);
+	TEST_CHECK_EQ(Sim_Servo_Commands, commands);
+	Sim_PIR(ENTRY_LINE, 0);
+	TEST_CHECK_EQ(Sim_Interrupts, 1);
+	TEST_CHECK_EQ(Sim_Pending, 0);
+	TEST_CHECK(Sessions[ENTRY].PIR_Event);
+	Run(ENTRY, 1);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_CLOSING);
+	TEST_CHECK_EQ(Sim_Arm_Target[ENTRY], GATE_ARM_CLOSED_ANGLE);
+	Run(ENTRY, 50);
+	TEST_CHECK_EQ(Done_Count[ENTRY], 0);
+	Sim_Arm_Stop(ENTRY);
+	Run(ENTRY, 1);
+	TEST_CHECK(!Gate_Session_Is_Busy(&Sessions[ENTRY]));
+	TEST_CHECK_EQ(Done_Count[ENTRY], 1);
+	Run(ENTRY, 50);
+	TEST_CHECK_EQ(Done_Count[ENTRY], 1);
+
+	/* The car left while the arm was rising: the edge is ignored and the arm goes down once up */
+	Sim_PIR(ENTRY_LINE, 1);
+	Gate_Session_Open(&Sessions[ENTRY]);
+	Sim_PIR(ENTRY_LINE, 0);
+	Run(ENTRY, 1);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_OPENING);
+	Sim_Arm_Stop(ENTRY);
+	Run(ENTRY, 1);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_CLOSING);
+	Sim_Arm_Stop(ENTRY);
+	Run(ENTRY, 1);
+	TEST_CHECK_EQ(Done_Count[ENTRY], 2);
+
+	/* The sensor drops out for a moment with the car still there, then the car leaves */
+	Sim_PIR(ENTRY_LINE, 1);
+	Gate_Session_Open(&Sessions[ENTRY]);
+	Sim_Arm_Stop(ENTRY);
+	Run(ENTRY, 1);
+	Sim_PIR(ENTRY_LINE, 0);
+	Sim_PIR(ENTRY_LINE, 1);
+	TEST_CHECK_EQ(Sim_Interrupts, 3);
+	Run(ENTRY, 1);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_WAIT_CAR);
+	TEST_CHECK_EQ(Sim_Arm_Target[ENTRY], GATE_ARM_OPEN_ANGLE);
+	/* A card shown meanwhile keeps the arm up without a new command */
+	commands = Sim_Servo_Commands;
+	Gate_Session_Open(&Sessions[ENTRY]);
+	TEST_CHECK_EQ(Sim_Servo_Commands, commands);
+	Sim_PIR(ENTRY_LINE, 0);
+	Run(ENTRY, 1);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_CLOSING);
+
+	/* A card shown while the arm goes down raises it again, the stop of the closing move is not the end */
+	Gate_Session_Open(&Sessions[ENTRY]);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_OPENING);
+	TEST_CHECK_EQ(Sim_Arm_Target[ENTRY], GATE_ARM_OPEN_ANGLE);
+	Gate_Session_Arm_Event(&Sessions[ENTRY], GATE_ARM_CLOSED_ANGLE);
+	Run(ENTRY, 1);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_OPENING);
+	Sim_PIR(ENTRY_LINE, 1);
+	Sim_Arm_Stop(ENTRY);
+	Run(ENTRY, 1);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_WAIT_CAR);
+	TEST_CHECK_EQ(Done_Count[ENTRY], 2);
+
+	/* Both gates at once: the exit session only follows its own line */
+	Sim_PIR(EXIT_LINE, 1);
+	Gate_Session_Open(&Sessions[EXIT]);
+	Sim_Arm_Stop(EXIT);
+	Run(EXIT, 1);
+	TEST_CHECK_EQ(Sessions[EXIT].State, GATE_SESSION_WAIT_CAR);
+	Sim_PIR(ENTRY_LINE, 0);
+	TEST_CHECK(!Sessions[EXIT].PIR_Event);
+	Run(ENTRY, 1);
+	Run(EXIT, 1);
+	TEST_CHECK_EQ(Sessions[ENTRY].State, GATE_SESSION_CLOSING);
+	TEST_CHECK_EQ(Sessions[EXIT].State, GATE_SESSION_WAIT_CAR);
+	Sim_PIR(EXIT_LINE, 0);
+	Sim_Arm_Stop(ENTRY);
+	Run(ENTRY, 1);
+	Run(EXIT, 1);
+	TEST_CHECK_EQ(Done_Count[ENTRY], 3);
+	TEST_CHECK_EQ(Sessions[EXIT].State, GATE_SESSION_CLOSING);
+	Sim_Arm_Stop(EXIT);
+	Run(EXIT, 1);
+	TEST_CHECK_EQ(Done_Count[EXIT], 1);
+	TEST_CHECK_EQ(Done_Count[ENTRY], 3);
+
+	/* Rising edges never interrupt, a masked line keeps its edge pending until enabled */
+	commands = Sim_Interrupts;
+	Sim_PIR(EXIT_LINE, 1);
+	TEST_CHECK_EQ(Sim_Interrupts, commands);
+	MCAL_EXTI_Disable_Lines((uint16)(1U << EXIT_LINE));
+	Sim_PIR(EXIT_LINE, 0);
+	TEST_CHECK_EQ(Sim_Interrupts, commands);
+	MCAL_EXTI_Enable_Lines((uint16)(1U << EXIT_LINE));
+	Sim_Interrupts_Run();
+	TEST_CHECK_EQ(Sim_Interrupts, commands + 1);
+	TEST_CHECK_EQ(Sim_Pending, 0);
+
+	/* An idle gate ignores stray edges and arm stops */
+	Sessions[EXIT].PIR_Event = 0;
+	commands = Sim_Servo_Commands;
+	Sim_PIR(EXIT_LINE, 1);
+	Sim_PIR(EXIT_LINE, 0);
+	Sim_Arm_Stop(EXIT);
+	Run(EXIT, 10);
+	TEST_CHECK(!Gate_Session_Is_Busy(&Sessions[EXIT]));
+	TEST_CHECK_EQ(Sim_Servo_Commands, commands);
+	TEST_CHECK_EQ(Done_Count[EXIT], 1);
+
+	/* DeInit masks every line and clears what is pending */
+	Sim_Pending = (1UL << ENTRY_LINE);
+	MCAL_EXTI_DeInit();
+	Sim_Sync_PR();
+	TEST_CHECK_EQ(Sim_Pending, 0);
+	TEST_CHECK_EQ(Sim_EXTI.IMR, 0);
+	TEST_CHECK_EQ(Sim_NVIC_Enabled & ((1UL << EXTI4_IRQ) | (1UL << EXTI1_IRQ)), 0);
+
+	return TEST_RESULT("test_gate_session");
+}
@@ -0,0 +1,166 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_gpio.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* GPIO driver on port registers in memory: MCAL_GPIO_InitMask against the
+ * per-pin MCAL_GPIO_Init on random port states, group writes and toggles
+ * that only store the bits of their pins through BSRR */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include "test.h"
+#include "gpio_driver.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#define RANDOM_RUNS		100000UL
+
+static uint32 Seed = 12345;
+
+static uint32 Random(void){
+	Seed = (Seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+	return (Seed >> 8) & 0xFFFFUL;
+}
+
+/* BSRR and BRR are write-only, their stores act on ODR: set wins over reset */
+static void Apply_Stores(GPIO_TypeDef* port){
+	port->ODR = ((port->ODR & ~((port->BSRR >> 16) | port->BRR)) | (port->BSRR & 0xFFFFUL)) & 0xFFFFUL;
+	port->BSRR = 0;
+	port->BRR = 0;
+}
+
+static void Random_Port(GPIO_TypeDef* port){
+	memset(port, 0, sizeof(*port));
+	port->CRL = (Random() << 16) | Random();
+	port->CRH = (Random() << 16) | Random();
+	port->ODR = Random();
+}
+
+/* Bits of the pins a BSRR store acts on */
+static uint16 Stored_Pins(const GPIO_TypeDef* port){
+	return (uint16)((port->BSRR & 0xFFFFUL) | (port->BSRR >> 16));
+}
+
+static uint8 Same_Port(const GPIO_TypeDef* first, const GPIO_TypeDef* second){
+	return (first->CRL == second->CRL) && (first->CRH == second->CRH) && (first->ODR == second->ODR);
+}
+
+int main(void){
+	GPIO_TypeDef mask_port, pin_port;
+	GPIO_PinConfig_t config;
+	unsigned long run, mismatches = 0;
+	uint16 mask, value, before;
+	uint8 mode, speed, pin;
+
+	/* InitMask gives the registers of one MCAL_GPIO_Init per pin */
+	for(run = 0; run < RANDOM_RUNS; run++){
+		Random_Port(&mask_port);
+		pin_port = mask_port;
+		mask = (uint16)Random();
+		mode = (uint8)(Random() % 9);
+		speed = (uint8)(1 + (Random() % 3));
+
+		MCAL_GPIO_InitMask(&mask_port, mask, mode, speed);
+		Apply_Stores(&mask_port);
+		config.GPIO_MODE = mode;
+		config.GPIO_OUTPUT_SPEED = speed;
+		for(pin = 0; pin < 16; pin++){
+			if(mask & (1U << pin)){
+				config.GPIO_PinNumber = (uint16)(1U << pin);
+				MCAL_GPIO_Init(&pin_port, &config);
+			}
+			else{ /* Do Nothing */ }
+		}
+		if(!Same_Port(&mask_port, &pin_port)){
+			if(0 == mismatches){
+				printf("mask 0x%04X mode %u speed %u: CRL %08lX/%08lX CRH %08lX/%08lX ODR %04lX/%04lX\n", mask, mode, speed,
+						(unsigned long)mask_port.CRL, (unsigned long)pin_port.CRL, (unsigned long)mask_port.CRH,
+						(unsigned long)pin_port.CRH, (unsigned long)mask_port.ODR, (unsigned long)pin_port.ODR);
+			}
+			else{ /* Do Nothing */ }
+			mismatches++;
+		}
+		else{ /* Do Nothing */ }
+	}
+	printf("InitMask against Init: %lu mismatches in %lu runs\n", mismatches, RANDOM_RUNS);
+	TEST_CHECK_EQ(mismatches, 0);
+
+	/* Known encodings: keypad rows PB0/1/3/4 output 10 MHz, columns PB5-7 input pull-down */
+	memset(&mask_port, 0, sizeof(mask_port));
+	mask_port.CRL = 0x44444444UL;
+	mask_port.CRH = 0x44444444UL;
+	mask_port.ODR = 0xFFFFUL;
+	MCAL_GPIO_InitMask(&mask_port, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_3 | GPIO_PIN_4, GPIO_MODE_OUTPUT_PP, GPIO_SPEED_10M);
+	MCAL_GPIO_InitMask(&mask_port, GPIO_PIN_5 | GPIO_PIN_6 | GPIO_PIN_7, GPIO_MODE_INPUT_PD, GPIO_SPEED_10M);
+	TEST_CHECK_EQ(mask_port.BRR, GPIO_PIN_5 | GPIO_PIN_6 | GPIO_PIN_7);
+	Apply_Stores(&mask_port);
+	TEST_CHECK_EQ(mask_port.CRL, 0x88811411UL);
+	TEST_CHECK_EQ(mask_port.CRH, 0x44444444UL);
+	TEST_CHECK_EQ(mask_port.ODR, 0xFF1FUL);
+	/* LCD data pins PB12-15 only touch CRH */
+	MCAL_GPIO_InitMask(&mask_port, GPIO_PIN_12 | GPIO_PIN_13 | GPIO_PIN_14 | GPIO_PIN_15, GPIO_MODE_OUTPUT_PP, GPIO_SPEED_2M);
+	TEST_CHECK_EQ(mask_port.CRL, 0x88811411UL);
+	TEST_CHECK_EQ(mask_port.CRH, 0x22224444UL);
+	TEST_CHECK_EQ(mask_port.BSRR + mask_port.BRR, 0);
+
+	/* Group writes and toggles: one BSRR store on the group pins only, ODR is never written,
+	 * so pins an interrupt changes between the read and the store keep their level */
+	for(run = 0; run < RANDOM_RUNS; run++){
+		Random_Port(&mask_port);
+		before = (uint16)mask_port.ODR;
+		mask = (uint16)Random();
+		value = (uint16)Random();
+
+		MCAL_GPIO_WriteGroup(&mask_port, mask, value);
+		TEST_CHECK_EQ(mask_port.ODR, before);
+		TEST_CHECK_EQ(Stored_Pins(&mask_port), mask);
+		Apply_Stores(&mask_port);
+		TEST_CHECK_EQ(mask_port.ODR, (before & ~mask) | (value & mask));
+
+		before = (uint16)mask_port.ODR;
+		MCAL_GPIO_ToggleGroup(&mask_port, mask);
+		TEST_CHECK_EQ(mask_port.ODR, before);
+		TEST_CHECK_EQ(Stored_Pins(&mask_port), mask);
+		Apply_Stores(&mask_port);
+		TEST_CHECK_EQ(mask_port.ODR, before ^ mask);
+
+		pin = (uint8)(Random() & 15);
+		before = (uint16)mask_port.ODR;
+		MCAL_GPIO_TogglePin(&mask_port, (uint16)(1U << pin));
+		TEST_CHECK_EQ(Stored_Pins(&mask_port), 1U << pin);
+		Apply_Stores(&mask_port);
+		TEST_CHECK_EQ(mask_port.ODR, before ^ (1U << pin));
+		if(Test_Failures){
+			break;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	/* Single pin writes and set/reset of overlapping pins, set wins */
+	mask_port.ODR = 0x00F0UL;
+	MCAL_GPIO_WritePin(&mask_port, GPIO_PIN_0, GPIO_PIN_SET);
+	Apply_Stores(&mask_port);
+	MCAL_GPIO_WritePin(&mask_port, GPIO_PIN_4, GPIO_PIN_RESET);
+	Apply_Stores(&mask_port);
+	TEST_CHECK_EQ(mask_port.ODR, 0x00E1UL);
+	MCAL_GPIO_SetResetPins(&mask_port, GPIO_PIN_8 | GPIO_PIN_1, GPIO_PIN_1 | GPIO_PIN_5);
+	Apply_Stores(&mask_port);
+	TEST_CHECK_EQ(mask_port.ODR, 0x01C3UL);
+	MCAL_GPIO_WritePort(&mask_port, 0xA55AU);
+	TEST_CHECK_EQ(mask_port.ODR, 0xA55AUL);
+
+	/* Reads come from IDR */
+	mask_port.IDR = 0x8001UL;
+	TEST_CHECK_EQ(MCAL_GPIO_ReadPort(&mask_port), 0x8001U);
+	TEST_CHECK_EQ(MCAL_GPIO_ReadPin(&mask_port, GPIO_PIN_15), GPIO_PIN_SET);
+	TEST_CHECK_EQ(MCAL_GPIO_ReadPin(&mask_port, GPIO_PIN_14), GPIO_PIN_RESET);
+
+	return TEST_RESULT("test_gpio");
+}
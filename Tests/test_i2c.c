@@ -0,0 +1,160 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_i2c.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* I2C master driver on the I2C1 register model: every read length with prompt
+ * and late interrupts, the events left set between a repeated start request and
+ * SB, back to back transfers while the STOP is still on the wire, NACKs and the
+ * timeouts of a held bus */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include "test.h"
+#include "sim_i2c.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#define MAX_LENGTH		40
+#define POINTER			0x0123
+#define SLACK_US		100UL
+#define COUNT_NS		1000ULL		// One TIM2 count: a start in the middle of one sees a count less
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+static const unsigned long long Latencies_ns[] = {0, 3000, 40000};
+
+static uint8 Transfer(uint8 address, const uint8* tx, uint16 tx_length, uint8* rx, uint16 rx_length){
+	I2C_Transfer_t transfer;
+
+	transfer.Address = address;
+	transfer.TX = tx;
+	transfer.TX_Length = tx_length;
+	transfer.RX = rx;
+	transfer.RX_Length = rx_length;
+	return MCAL_I2C_Transfer(I2C1, &transfer);
+}
+
+/* Bytes of the slave memory from a pointer */
+static uint8 Same_As_Memory(uint16 pointer, const uint8* data, uint16 length){
+	return 0 == memcmp(&Sim_I2C_Memory[pointer], data, length);
+}
+
+int main(void){
+	I2C_cfg_t config;
+	uint8 tx[2 + SIM_I2C_PAGE_SIZE], rx[MAX_LENGTH];
+	uint16 length, index;
+	uint8 latency, status;
+	unsigned long polls;
+	unsigned long long start_ns;
+
+	Timer2_init();
+	Sim_I2C_Reset();
+	for(index = 0; index < SIM_I2C_MEMORY_SIZE; index++){
+		Sim_I2C_Memory[index] = (uint8)((index * 7) + 3);
+	}
+	config.ClockSpeed = I2C_SPEED_FAST;
+	MCAL_I2C_Init(I2C1, &config);
+
+	/* 400 kHz from the 36 MHz PCLK1 */
+	TEST_CHECK_EQ(Sim_I2C1.CR2 & I2C_CR2_FREQ, 36);
+	TEST_CHECK_EQ(Sim_I2C1.CCR, (1UL << 15) | 30);
+	TEST_CHECK_EQ(Sim_I2C1.TRISE, 11);
+
+	/* Pointer write, repeated start and every read length: the NACK on the last byte only,
+	 * the STOP before the slave sends one more, late interrupts see BTF with RXNE */
+	tx[0] = (uint8)(POINTER >> 8);
+	tx[1] = (uint8)POINTER;
+	for(latency = 0; latency < (sizeof(Latencies_ns) / sizeof(Latencies_ns[0])); latency++){
+		Sim_I2C_Latency_ns = Latencies_ns[latency];
+		for(length = 1; (length <= MAX_LENGTH) && !Test_Failures; length++){
+			memset(rx, 0, sizeof(rx));
+			TEST_CHECK_EQ(Transfer(SIM_I2C_SLAVE_ADDRESS, tx, 2, rx, length), I2C_STATUS_DONE);
+			TEST_CHECK(Same_As_Memory(POINTER, rx, length));
+			/* Read only, from where the last read stopped */
+			memset(rx, 0, sizeof(rx));
+			TEST_CHECK_EQ(Transfer(SIM_I2C_SLAVE_ADDRESS, NULL, 0, rx, length), I2C_STATUS_DONE);
+			TEST_CHECK(Same_As_Memory(POINTER + length, rx, length));
+			TEST_CHECK_EQ(Sim_I2C_Violations, 0);
+		}
+	}
+	/* The prompt interrupts ran while TXE and BTF waited for the repeated start */
+	printf("%lu events between a repeated start request and SB\n", Sim_I2C_Restart_Events);
+	TEST_CHECK(Sim_I2C_Restart_Events > 0);
+
+	/* Page writes, then ACK polling back to back: each poll starts while the STOP of the last one is sent */
+	Sim_I2C_Latency_ns = 3000;
+	for(length = 1; (length <= SIM_I2C_PAGE_SIZE) && !Test_Failures; length++){
+		tx[0] = 0x02;
+		tx[1] = 0x00;
+		for(index = 0; index < length; index++){
+			tx[2 + index] = (uint8)(length + index);
+		}
+		TEST_CHECK_EQ(Transfer(SIM_I2C_SLAVE_ADDRESS, tx, 2 + length, NULL, 0), I2C_STATUS_DONE);
+		TEST_CHECK(Same_As_Memory(0x0200, &tx[2], length));
+
+		start_ns = Sim_Time_ns;
+		polls = 0;
+		do{
+			status = Transfer(SIM_I2C_SLAVE_ADDRESS, NULL, 0, NULL, 0);
+			polls++;
+		}while(I2C_STATUS_NACK == status);
+		TEST_CHECK_EQ(status, I2C_STATUS_DONE);
+		TEST_CHECK(polls > 100);
+		TEST_CHECK((Sim_Time_ns - start_ns) < (SIM_I2C_WRITE_CYCLE_NS + 100000ULL));
+		TEST_CHECK_EQ(Sim_I2C_Violations, 0);
+	}
+	printf("Write cycle: %lu ACK polls\n", polls);
+
+	/* No slave at the address */
+	TEST_CHECK_EQ(Transfer(SIM_I2C_SLAVE_ADDRESS + 1, tx, 2, rx, 4), I2C_STATUS_NACK);
+	TEST_CHECK_EQ(Transfer(SIM_I2C_SLAVE_ADDRESS, tx, 2, rx, 4), I2C_STATUS_DONE);
+	TEST_CHECK_EQ(Sim_I2C_Violations, 0);
+
+	/* Another master holds the bus: no START, error after I2C_STOP_TIMEOUT_US */
+	Sim_I2C_Bus_Held = 1;
+	start_ns = Sim_Time_ns;
+	TEST_CHECK_EQ(Transfer(SIM_I2C_SLAVE_ADDRESS, tx, 2, rx, 4), I2C_STATUS_ERROR);
+	TEST_CHECK((Sim_Time_ns - start_ns) >= (I2C_STOP_TIMEOUT_US * 1000ULL - COUNT_NS));
+	TEST_CHECK((Sim_Time_ns - start_ns) <= ((I2C_STOP_TIMEOUT_US + SLACK_US) * 1000ULL));
+	TEST_CHECK(!(Sim_I2C1.CR1 & I2C_CR1_START));
+	Sim_I2C_Bus_Held = 0;
+
+	/* The slave holds SCL in the middle of a write: error I2C_BYTE_TIMEOUT_US after the last byte, then a STOP */
+	tx[0] = 0x03;
+	tx[1] = 0x00;
+	Sim_I2C_Busy_Until_ns = 0;
+	Sim_I2C_Hold_At_Byte = 6;
+	start_ns = Sim_Time_ns;
+	TEST_CHECK_EQ(Transfer(SIM_I2C_SLAVE_ADDRESS, tx, 2 + SIM_I2C_PAGE_SIZE, NULL, 0), I2C_STATUS_ERROR);
+	TEST_CHECK((Sim_Time_ns - start_ns) >= (I2C_BYTE_TIMEOUT_US * 1000ULL - COUNT_NS));
+	TEST_CHECK((Sim_Time_ns - start_ns) <= ((I2C_BYTE_TIMEOUT_US + SLACK_US) * 1000ULL + 8 * SIM_I2C_BYTE_NS));
+	TEST_CHECK(Sim_I2C1.CR1 & I2C_CR1_STOP);
+	TEST_CHECK_EQ(Sim_I2C1.CR2 & (I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN), 0);
+	Sim_I2C_Hold_At_Byte = 0;
+	Sim_I2C_SCL_Held = 0;
+
+	/* Released: the STOP goes out, the slave writes the bytes it got, then the bus works again */
+	polls = 0;
+	do{
+		status = Transfer(SIM_I2C_SLAVE_ADDRESS, NULL, 0, NULL, 0);
+		polls++;
+	}while(I2C_STATUS_NACK == status);
+	TEST_CHECK_EQ(status, I2C_STATUS_DONE);
+	TEST_CHECK(polls > 1);
+	memset(rx, 0, sizeof(rx));
+	tx[0] = (uint8)(POINTER >> 8);
+	tx[1] = (uint8)POINTER;
+	TEST_CHECK_EQ(Transfer(SIM_I2C_SLAVE_ADDRESS, tx, 2, rx, 8), I2C_STATUS_DONE);
+	TEST_CHECK(Same_As_Memory(POINTER, rx, 8));
+	TEST_CHECK_EQ(Sim_I2C_Violations, 0);
+
+	return TEST_RESULT("test_i2c");
+}
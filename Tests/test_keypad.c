@@ -0,0 +1,374 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_keypad.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Keypad scan on a simulated 4x3 matrix with bouncing contacts and the EXTI
+ * column wake-up: the row scan against the former per-pin scan over every
+ * contact state, with and without the input synchronizer delay, debounce, long
+ * press and repeat, event queue */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include "test.h"
+#include "keypad_driver.h"
+
+TEST_MAIN_DEFINITIONS;
+
+//----------------------------------------------
+// Section: Simulated matrix and EXTI lines
+//----------------------------------------------
+static uint8 Sim_Closed[KEYPAD_KEYS];	// Contact of each key, index row * KEYPAD_COLS + col
+static uint16 Sim_Rows;					// Row pins driven high
+static uint16 Sim_Columns;				// Column levels seen by the EXTI edge detector
+static uint16 Sim_EXTI_Enabled, Sim_EXTI_Pending;
+static void (*Sim_EXTI_CallBack)(void);
+static unsigned long Sim_Port_Accesses, Sim_Wakeups;
+static sint32 Sim_Close_On_Idle = -1;	// Key closed when the rows go back high, before the lines are armed
+static uint8 Sim_Sync_Reads;			// Reads after a row write still seeing the columns of before it
+static uint8 Sim_Stale_Reads;
+static uint16 Sim_Stale_Columns;
+
+static uint16 Sim_Read_Columns(void){
+	static const uint16 rows[KEYPAD_ROWS] = {ROW0, ROW1, ROW2, ROW3};
+	uint16 columns = 0;
+	uint8 index;
+	for(index = 0; index < KEYPAD_KEYS; index++){
+		if(Sim_Closed[index] && (Sim_Rows & rows[index / KEYPAD_COLS])){
+			columns |= (uint16)(COL0 << (index % KEYPAD_COLS));
+		}
+		else{ /* Do Nothing */ }
+	}
+	return columns;
+}
+
+/* Rising column edges set the pending flags, an enabled pending line runs the handler */
+static void Sim_EXTI_Update(void){
+	uint16 columns = Sim_Read_Columns();
+	uint16 fire;
+
+	Sim_EXTI_Pending |= (uint16)(columns & ~Sim_Columns);
+	Sim_Columns = columns;
+	fire = Sim_EXTI_Pending & Sim_EXTI_Enabled;
+	if(fire){
+		Sim_EXTI_Pending &= (uint16)~fire;
+		Sim_Wakeups++;
+		Sim_EXTI_CallBack();
+	}
+	else{ /* Do Nothing */ }
+}
+
+static void Sim_Port_Set_Reset(GPIO_TypeDef* port, uint16 set, uint16 reset){
+	TEST_CHECK(KEYPAD_PORT == port);
+	Sim_Port_Accesses++;
+	Sim_Stale_Columns = Sim_Read_Columns();
+	Sim_Stale_Reads = Sim_Sync_Reads;
+	Sim_Rows = (uint16)((Sim_Rows & ~reset) | set) & ROWS_MASK;
+	if((ROWS_MASK == Sim_Rows) && (Sim_Close_On_Idle >= 0)){
+		Sim_Closed[Sim_Close_On_Idle] = 1;
+		Sim_Close_On_Idle = -1;
+	}
+	else{ /* Do Nothing */ }
+	Sim_EXTI_Update();
+}
+
+static uint16 Sim_Port_Read(GPIO_TypeDef* port){
+	TEST_CHECK(KEYPAD_PORT == port);
+	Sim_Port_Accesses++;
+	if(Sim_Stale_Reads > 0){
+		Sim_Stale_Reads--;
+		return (uint16)(Sim_Stale_Columns | Sim_Rows);
+	}
+	return (uint16)(Sim_Read_Columns() | Sim_Rows);
+}
+
+/* Pin accesses of the former scan */
+void MCAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16 PinNumber, uint8 Value){
+	Sim_Port_Set_Reset(GPIOx, (GPIO_PIN_SET == Value) ? PinNumber : 0, (GPIO_PIN_SET == Value) ? 0 : PinNumber);
+}
+uint8 MCAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16 PinNumber){
+	return (Sim_Port_Read(GPIOx) & PinNumber) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void MCAL_GPIO_InitMask(GPIO_TypeDef *GPIOx, uint16 PinMask, uint8 Mode, uint8 Speed){
+	(void)GPIOx; (void)PinMask; (void)Mode; (void)Speed;
+}
+
+void MCAL_EXTI_Init(EXTI_PinConfig_t* EXTI_cfg){
+	TEST_CHECK_EQ(EXTI_cfg->Trigger, EXTI_TRIGGER_RISING);
+	Sim_EXTI_CallBack = EXTI_cfg->P_IRQ_CallBack;
+	Sim_EXTI_Enabled |= (uint16)(1U << EXTI_cfg->Line);
+}
+void MCAL_EXTI_Enable_Lines(uint16 lines){
+	Sim_EXTI_Enabled |= lines;
+	Sim_EXTI_Update();
+}
+void MCAL_EXTI_Disable_Lines(uint16 lines){ Sim_EXTI_Enabled &= (uint16)~lines; }
+void MCAL_EXTI_Clear_Pending(uint16 lines){ Sim_EXTI_Pending &= (uint16)~lines; }
+
+/* The keypad reaches the port through the register macros */
+#undef GPIO_PORT_SET_RESET
+#define GPIO_PORT_SET_RESET(port, set, reset)	Sim_Port_Set_Reset((port), (set), (reset))
+#undef GPIO_PORT_READ
+#define GPIO_PORT_READ(port)					Sim_Port_Read(port)
+#include "../HAL/keypad_driver.c"
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+
+/* Scan before the whole port accesses: two pin writes and three pin reads per row */
+static uint16 Old_Sample(void){
+	static const uint16 rows[KEYPAD_ROWS] = {ROW0, ROW1, ROW2, ROW3};
+	static const uint16 cols[KEYPAD_COLS] = {COL0, COL1, COL2};
+	uint16 sample = 0;
+	uint8 row_index, col_index;
+
+	for(row_index = 0; row_index < KEYPAD_ROWS; row_index++){
+		MCAL_GPIO_WritePin(KEYPAD_PORT, rows[row_index], GPIO_PIN_SET);
+		for(col_index = 0; col_index < KEYPAD_COLS; col_index++){
+			if(MCAL_GPIO_ReadPin(KEYPAD_PORT, cols[col_index]) == GPIO_PIN_SET){
+				sample |= (1U << ((row_index * KEYPAD_COLS) + col_index));
+			}
+			else{ /* Do Nothing */ }
+		}
+		MCAL_GPIO_WritePin(KEYPAD_PORT, rows[row_index], GPIO_PIN_RESET);
+	}
+
+	return sample;
+}
+
+/* Closes the keys of a bit mask, index row * KEYPAD_COLS + col */
+static void Set_Contacts(uint16 state){
+	uint8 index;
+	for(index = 0; index < KEYPAD_KEYS; index++){
+		Sim_Closed[index] = (state >> index) & 1U;
+	}
+}
+
+/* Index of a key in the layout */
+static uint8 Key(uint8 value){
+	uint8 index;
+	for(index = 0; index < KEYPAD_KEYS; index++){
+		if(Keypad_Buttons[index / KEYPAD_COLS][index % KEYPAD_COLS] == value){
+			return index;
+		}
+		else{ /* Do Nothing */ }
+	}
+	printf("no key '%c'\n", value);
+	return 0;
+}
+
+static void Set_Key(uint8 value, uint8 closed){
+	Sim_Closed[Key(value)] = closed;
+	Sim_EXTI_Update();
+}
+
+static void Ticks(uint16 count){
+	while(count--){
+		keypad_Scan_Tick();
+	}
+}
+
+/* Plays a contact trace, one character per scan period */
+static void Trace(uint8 value, const char* trace){
+	for(; *trace; trace++){
+		Set_Key(value, ('1' == *trace));
+		keypad_Scan_Tick();
+	}
+}
+
+static void Check_Event(uint8 key, Keypad_Event_Type_t type){
+	Keypad_Event_t event;
+	if(!keypad_Get_Event(&event)){
+		printf("no event, expected '%c' type %d\n", key, type);
+		Test_Failures++;
+	}
+	else if((event.Key != key) || (event.Type != type)){
+		printf("event '%c' type %d, expected '%c' type %d\n", event.Key, event.Type, key, type);
+		Test_Failures++;
+	}
+	else{ /* Do Nothing */ }
+}
+
+static void Check_No_Event(void){
+	Keypad_Event_t event;
+	if(keypad_Get_Event(&event)){
+		printf("unexpected event '%c' type %d\n", event.Key, event.Type);
+		Test_Failures++;
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Idle: rows high, columns armed, no scanning */
+static void Check_Idle(void){
+	TEST_CHECK(!Keypad_Scanning);
+	TEST_CHECK_EQ(Sim_Rows, ROWS_MASK);
+	TEST_CHECK_EQ(Sim_EXTI_Enabled, COLS_MASK);
+}
+
+int main(void){
+	unsigned long old_accesses, new_accesses;
+	uint16 state, old_sample, old_rows, new_sample;
+	uint8 index;
+	uint16 hold;
+
+	/* Every contact state: the same keys and rows left as with the per-pin scan, in fewer accesses */
+	old_accesses = 0;
+	new_accesses = 0;
+	for(state = 0; (state < (1U << KEYPAD_KEYS)) && !Test_Failures; state++){
+		Set_Contacts(state);
+		Sim_Rows = 0;
+		Sim_Port_Accesses = 0;
+		old_sample = Old_Sample();
+		old_rows = Sim_Rows;
+		old_accesses += Sim_Port_Accesses;
+		Sim_Rows = 0;
+		Sim_Port_Accesses = 0;
+		new_sample = keypad_Sample();
+		new_accesses += Sim_Port_Accesses;
+		TEST_CHECK_EQ(new_sample, old_sample);
+		TEST_CHECK_EQ(new_sample, state);
+		TEST_CHECK_EQ(Sim_Rows, old_rows);
+		TEST_CHECK_EQ(Sim_Rows, 0);
+	}
+	printf("Scan: %lu port accesses, per-pin scan %lu\n", new_accesses / (1UL << KEYPAD_KEYS), old_accesses / (1UL << KEYPAD_KEYS));
+	TEST_CHECK(new_accesses < old_accesses);
+
+	/* One read after a row write still sees the columns of the row before: the read back covers it */
+	Sim_Sync_Reads = 1;
+	for(state = 0; (state < (1U << KEYPAD_KEYS)) && !Test_Failures; state++){
+		Set_Contacts(state);
+		Sim_Rows = ROWS_MASK;
+		TEST_CHECK_EQ(keypad_Sample(), state);
+	}
+	Sim_Sync_Reads = 0;
+	Sim_Stale_Reads = 0;
+	Set_Contacts(0);
+	Sim_Rows = 0;
+	Sim_Columns = 0;
+	Sim_EXTI_Pending = 0;
+
+	keypad_init();
+	Check_Idle();
+
+	/* Idle ticks cost nothing */
+	Sim_Port_Accesses = 0;
+	Ticks(100);
+	TEST_CHECK_EQ(Sim_Port_Accesses, 0);
+
+	/* Clean press: the edge wakes the scan, the press needs KEYPAD_DEBOUNCE_SAMPLES samples */
+	Set_Key('5', 1);
+	TEST_CHECK_EQ(Sim_Wakeups, 1);
+	TEST_CHECK(Keypad_Scanning);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES - 1);
+	Check_No_Event();
+	Ticks(1);
+	Check_Event('5', KEYPAD_EVENT_PRESS);
+	Ticks(20);
+	Set_Key('5', 0);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES - 1);
+	Check_No_Event();
+	Ticks(1);
+	Check_Event('5', KEYPAD_EVENT_RELEASE);
+	Check_No_Event();
+	Check_Idle();
+
+	/* Bouncing contact: a single press and a single release */
+	Trace('8', "1010011011111111110110100100000000");
+	Check_Event('8', KEYPAD_EVENT_PRESS);
+	Check_Event('8', KEYPAD_EVENT_RELEASE);
+	Check_No_Event();
+	Check_Idle();
+
+	/* Spikes shorter than the debounce wake the scan up but give no event */
+	Sim_Wakeups = 0;
+	Trace('0', "10000");
+	Trace('0', "11000000");
+	Check_No_Event();
+	TEST_CHECK_EQ(Sim_Wakeups, 2);
+	Check_Idle();
+
+	/* Long press after KEYPAD_LONG_PRESS_MS, then a repeat every KEYPAD_REPEAT_MS */
+	Set_Key('#', 1);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	Check_Event('#', KEYPAD_EVENT_PRESS);
+	for(hold = KEYPAD_SCAN_PERIOD_MS; hold <= (KEYPAD_LONG_PRESS_MS + 3 * KEYPAD_REPEAT_MS + 100); hold += KEYPAD_SCAN_PERIOD_MS){
+		Ticks(1);
+		if(KEYPAD_LONG_PRESS_MS == hold){
+			Check_Event('#', KEYPAD_EVENT_LONG_PRESS);
+		}
+		else if((hold > KEYPAD_LONG_PRESS_MS) && (0 == ((hold - KEYPAD_LONG_PRESS_MS) % KEYPAD_REPEAT_MS))){
+			Check_Event('#', KEYPAD_EVENT_REPEAT);
+		}
+		else{
+			Check_No_Event();
+		}
+	}
+	Set_Key('#', 0);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	Check_Event('#', KEYPAD_EVENT_RELEASE);
+	Check_Idle();
+
+	/* Two keys held together, events in layout order */
+	Set_Key('1', 1);
+	Set_Key('9', 1);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	Check_Event('9', KEYPAD_EVENT_PRESS);
+	Check_Event('1', KEYPAD_EVENT_PRESS);
+	Set_Key('9', 0);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	Check_Event('9', KEYPAD_EVENT_RELEASE);
+	TEST_CHECK(Keypad_Scanning);
+	Set_Key('1', 0);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	Check_Event('1', KEYPAD_EVENT_RELEASE);
+	Check_Idle();
+
+	/* Key closed between the last sample and the re-arm of the lines: the idle read catches it */
+	Set_Key('7', 1);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	Set_Key('7', 0);
+	Sim_Close_On_Idle = Key('3');
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	TEST_CHECK(Keypad_Scanning);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	Check_Event('7', KEYPAD_EVENT_PRESS);
+	Check_Event('7', KEYPAD_EVENT_RELEASE);
+	Check_Event('3', KEYPAD_EVENT_PRESS);
+	Set_Key('3', 0);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	Check_Event('3', KEYPAD_EVENT_RELEASE);
+	Check_Idle();
+
+	/* Full queue: KEYPAD_FIFO_SIZE - 1 events kept, the newest are dropped */
+	for(index = 0; index < 10; index++){
+		Set_Key('2', 1);
+		Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+		Set_Key('2', 0);
+		Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	}
+	for(index = 0; index < (KEYPAD_FIFO_SIZE - 1); index++){
+		Check_Event('2', (index & 1) ? KEYPAD_EVENT_RELEASE : KEYPAD_EVENT_PRESS);
+	}
+	Check_No_Event();
+
+	/* keypad_Get_Pressed_Key skips the other event types */
+	Set_Key('4', 1);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	Set_Key('4', 0);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	Set_Key('6', 1);
+	Ticks(KEYPAD_DEBOUNCE_SAMPLES);
+	TEST_CHECK_EQ(keypad_Get_Pressed_Key(), '4');
+	TEST_CHECK_EQ(keypad_Get_Pressed_Key(), '6');
+	TEST_CHECK_EQ(keypad_Get_Pressed_Key(), KEYPAD_NO_KEY);
+
+	return TEST_RESULT("test_keypad");
+}
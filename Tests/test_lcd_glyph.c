@@ -0,0 +1,146 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_lcd_glyph.c 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Glyph cache on the simulated HD44780: uploads only on a miss, evicts the
+ * least recently used glyph and never one that is on screen */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "test.h"
+#include "sim_lcd.h"
+#include "lcd_glyph.h"
+
+TEST_MAIN_DEFINITIONS;
+
+static LCD_t LCD;
+static Sim_LCD_t Sim;
+static LCD_Glyph_Cache_t Cache;
+static uint8 Glyphs[12][LCD_GLYPH_ROWS];
+
+/* Checks the CGRAM slot of a code holds the bitmap */
+static void Check_CGRAM(uint8 code, const uint8* bitmap){
+	uint8 row;
+	for(row = 0; row < LCD_GLYPH_ROWS; row++){
+		if(Sim.CGRAM[((code & 0x07) * LCD_GLYPH_ROWS) + row] != (bitmap[row] & 0x1F)){
+			printf("CGRAM slot %u row %u is 0x%02X, expected 0x%02X\n", code & 0x07, row,
+					Sim.CGRAM[((code & 0x07) * LCD_GLYPH_ROWS) + row], bitmap[row] & 0x1F);
+			Test_Failures++;
+			return;
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+
+int main(void){
+	uint8 index, row, code, codes[8];
+	uint8 masked[LCD_GLYPH_ROWS];
+	unsigned long writes;
+
+	for(index = 0; index < 12; index++){
+		for(row = 0; row < LCD_GLYPH_ROWS; row++){
+			Glyphs[index][row] = (uint8)((index * 3 + row * 7 + 1) & 0x1F);
+		}
+	}
+
+	Sim_LCD_Attach(&Sim, GPIOB, GPIO_PIN_11, GPIO_PIN_10, GPIO_PIN_12, GPIO_PIN_13, GPIO_PIN_14, GPIO_PIN_15);
+	LCD.Mode = LCD_4BIT;
+	LCD.GPIO_PORT = GPIOB;
+	LCD.Entry_Mode = LCD_ENTRY_MODE_INC_SHIFT_OFF;
+	LCD.Display_Mode = LCD_DISPLAY_ON_UNDERLINE_OFF_CURSOR_OFF;
+	LCD.EN_PIN = GPIO_PIN_10;
+	LCD.RS_PIN = GPIO_PIN_11;
+	LCD.D4_PIN = GPIO_PIN_12;
+	LCD.D5_PIN = GPIO_PIN_13;
+	LCD.D6_PIN = GPIO_PIN_14;
+	LCD.D7_PIN = GPIO_PIN_15;
+	LCD_Init(&LCD);
+	LCD_Glyph_Cache_Init(&Cache, &LCD);
+	Sim_LCD_Clear_Stats(&Sim);
+
+	/* Cold cache: each glyph takes the next empty slot */
+	for(index = 0; index < 8; index++){
+		codes[index] = LCD_Glyph_Get(&Cache, Glyphs[index]);
+		TEST_CHECK_EQ(codes[index], LCD_GLYPH_CODE_BASE + index);
+		Check_CGRAM(codes[index], Glyphs[index]);
+	}
+	TEST_CHECK_EQ(Cache.CGRAM_Uploads, 8);
+	TEST_CHECK_EQ(Sim.CGRAM_Writes, 8 * LCD_GLYPH_ROWS);
+
+	/* Hits, the 3 upper bits of the rows are not part of the glyph */
+	writes = Sim.CGRAM_Writes;
+	for(index = 0; index < 8; index++){
+		TEST_CHECK_EQ(LCD_Glyph_Get(&Cache, Glyphs[index]), codes[index]);
+	}
+	for(row = 0; row < LCD_GLYPH_ROWS; row++){
+		masked[row] = (uint8)(Glyphs[3][row] | 0xE0);
+	}
+	TEST_CHECK_EQ(LCD_Glyph_Get(&Cache, masked), codes[3]);
+	TEST_CHECK_EQ(Sim.CGRAM_Writes, writes);
+	TEST_CHECK_EQ(Cache.CGRAM_Uploads, 8);
+
+	/* LRU: slots used from 7 down to 0, then 0 and 3 again... */
+	for(index = 8; index > 0; index--){
+		LCD_Glyph_Get(&Cache, Glyphs[index - 1]);
+	}
+	LCD_Glyph_Get(&Cache, Glyphs[0]);
+	LCD_Glyph_Get(&Cache, Glyphs[3]);
+	/* ...order from the oldest: 7 6 5 4 2 1 0 3 */
+	code = LCD_Glyph_Get(&Cache, Glyphs[8]);
+	TEST_CHECK_EQ(code, codes[7]);
+	Check_CGRAM(code, Glyphs[8]);
+	code = LCD_Glyph_Get(&Cache, Glyphs[9]);
+	TEST_CHECK_EQ(code, codes[6]);
+	TEST_CHECK_EQ(Cache.CGRAM_Uploads, 10);
+
+	/* Glyphs on screen are kept even when they are the oldest ones: 5 and 4 */
+	LCD_Send_Char_Pos(&LCD, codes[5], LCD_FIRST_ROW, 1);
+	LCD_Send_Char_Pos(&LCD, codes[4], LCD_THIRD_ROW, 16);
+	code = LCD_Glyph_Get(&Cache, Glyphs[10]);
+	TEST_CHECK_EQ(code, codes[2]);
+	Check_CGRAM(codes[5], Glyphs[5]);
+	Check_CGRAM(codes[4], Glyphs[4]);
+	/* The upload restores the address counter, the next character follows the last one */
+	LCD_Send_Char(&LCD, 'x');
+	TEST_CHECK_EQ(Sim.DDRAM[0x14 + 15], codes[4]);
+	TEST_CHECK_EQ(Sim.DDRAM[0x14 + 16], 'x');
+	TEST_CHECK_EQ(Sim.DDRAM[0x00], codes[5]);
+
+	/* Every slot on screen: nothing can be evicted and CGRAM is left alone */
+	LCD_Send_Command(&LCD, LCD_CLEAR_DISPLAY);
+	for(index = 0; index < 8; index++){
+		LCD_Send_Char_Pos(&LCD, (uint8)(LCD_GLYPH_CODE_BASE + index), LCD_SECOND_ROW, (uint8)(index + 1));
+	}
+	writes = Sim.CGRAM_Writes;
+	TEST_CHECK_EQ(LCD_Glyph_Get(&Cache, Glyphs[11]), LCD_GLYPH_NONE);
+	TEST_CHECK_EQ(Sim.CGRAM_Writes, writes);
+	/* A glyph already loaded still hits */
+	TEST_CHECK_EQ(LCD_Glyph_Get(&Cache, Glyphs[8]), codes[7]);
+
+	/* Cleared screen frees every slot again */
+	LCD_Send_Command(&LCD, LCD_CLEAR_DISPLAY);
+	code = LCD_Glyph_Get(&Cache, Glyphs[11]);
+	TEST_CHECK(LCD_GLYPH_NONE != code);
+	Check_CGRAM(code, Glyphs[11]);
+
+	/* The welcome screen redrawn 20 times uploads its glyph once */
+	LCD_Glyph_Cache_Init(&Cache, &LCD);
+	Sim_LCD_Clear_Stats(&Sim);
+	for(index = 0; index < 20; index++){
+		LCD_Send_Command(&LCD, LCD_CLEAR_DISPLAY);
+		LCD_Send_string_Pos(&LCD, (uint8*)"Welcome!", LCD_FIRST_ROW, 4);
+		LCD_Send_Char_Pos(&LCD, LCD_Glyph_Get(&Cache, Glyphs[0]), LCD_FIRST_ROW, 13);
+	}
+	printf("welcome screen x20: %lu CGRAM writes, %lu uploads\n", Sim.CGRAM_Writes, (unsigned long)Cache.CGRAM_Uploads);
+	TEST_CHECK_EQ(Cache.CGRAM_Uploads, 1);
+	TEST_CHECK_EQ(Sim.CGRAM_Writes, LCD_GLYPH_ROWS);
+	TEST_CHECK_EQ(Sim.Violations, 0);
+
+	return TEST_RESULT("test_lcd_glyph");
+}
@@ -0,0 +1,167 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_lcd_text.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Paging and marquee on the simulated HD44780: the frame sequence, the
+ * step timing and one data write for each cell that changes */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include "test.h"
+#include "sim_lcd.h"
+#include "lcd_text.h"
+
+TEST_MAIN_DEFINITIONS;
+
+static LCD_t LCD;
+static Sim_LCD_t Sim;
+static LCD_Text_t Text;
+static char Rows[LCD_MAX_ROWS][LCD_MAX_COLUMNS + 1];
+
+/* Number of cells that differ between the screen and the expected rows */
+static unsigned long Changed_Cells(uint8 first_row, const char* const* expected, uint8 rows){
+	char text[LCD_MAX_COLUMNS + 1];
+	unsigned long changed = 0;
+	uint8 row, column;
+
+	for(row = 0; row < rows; row++){
+		Sim_LCD_Row(&Sim, first_row + row, text);
+		for(column = 0; column < LCD_MAX_COLUMNS; column++){
+			changed += (text[column] != expected[row][column]);
+		}
+	}
+	return changed;
+}
+
+/* Checks the rows on screen and that only the changed cells were written since the previous frame */
+static void Check_Frame(const char* what, uint8 first_row, const char* const* expected, uint8 rows, unsigned long changed){
+	uint8 row;
+
+	for(row = 0; row < rows; row++){
+		Sim_LCD_Row(&Sim, first_row + row, Rows[row]);
+		if(0 != strcmp(Rows[row], expected[row])){
+			printf("%s: row %u is \"%s\", expected \"%s\"\n", what, first_row + row, Rows[row], expected[row]);
+			Test_Failures++;
+		}
+		else{ /* Do Nothing */ }
+	}
+	if(Sim.Data_Writes != changed){
+		printf("%s: %lu data writes for %lu changed cells\n", what, Sim.Data_Writes, changed);
+		Test_Failures++;
+	}
+	else{ /* Do Nothing */ }
+	/* At most one cursor command for each written cell */
+	TEST_CHECK(Sim.Commands <= changed);
+	Sim_LCD_Clear_Stats(&Sim);
+}
+
+static void Clear_Screen(void){
+	LCD_Send_Command(&LCD, LCD_CLEAR_DISPLAY);
+	Sim_LCD_Clear_Stats(&Sim);
+}
+
+int main(void){
+	static const char* const pages[][2] = {
+			{"Tap your card on", "the gate reader "},
+			{"to enter the car", "park            "},
+			{"Thank you       ", "                "}
+	};
+	static const char* const hard_break[][1] = {{"ABCDEFGHIJKLMNOP"}, {"QRSTUV          "}};
+	static const char* const fits[] = {"Welcome!        "};
+	const char* marquee = "Tap your card on the gate reader to enter";
+	char cycle[128], frame[LCD_MAX_COLUMNS + 1];
+	const char* expected[1] = {frame};
+	unsigned long changed;
+	uint16 step;
+	uint8 page;
+
+	Sim_LCD_Attach(&Sim, GPIOA, GPIO_PIN_5, GPIO_PIN_6, GPIO_PIN_12, GPIO_PIN_13, GPIO_PIN_14, GPIO_PIN_15);
+	LCD.Mode = LCD_4BIT;
+	LCD.GPIO_PORT = GPIOA;
+	LCD.Entry_Mode = LCD_ENTRY_MODE_INC_SHIFT_OFF;
+	LCD.Display_Mode = LCD_DISPLAY_ON_UNDERLINE_OFF_CURSOR_OFF;
+	LCD.RS_PIN = GPIO_PIN_5;
+	LCD.EN_PIN = GPIO_PIN_6;
+	LCD.D4_PIN = GPIO_PIN_12;
+	LCD.D5_PIN = GPIO_PIN_13;
+	LCD.D6_PIN = GPIO_PIN_14;
+	LCD.D7_PIN = GPIO_PIN_15;
+	LCD_Init(&LCD);
+
+	/* Pages: word wrap, explicit line break, then back to the first page */
+	Clear_Screen();
+	changed = Changed_Cells(1, pages[0], 2);
+	LCD_Text_Start(&Text, &LCD, (const uint8*)"Tap your card on the gate reader to enter the car park\nThank you",
+			LCD_TEXT_PAGE, LCD_SECOND_ROW, 2, 2000);
+	TEST_CHECK(Text.Active);
+	Check_Frame("page 0", 1, pages[0], 2, changed);
+	for(step = 1; step <= 4; step++){
+		page = (uint8)(step % 3);
+		/* Nothing is drawn before the step time */
+		LCD_Text_Update(&Text, 1000);
+		LCD_Text_Update(&Text, 999);
+		TEST_CHECK_EQ(Sim.Data_Writes + Sim.Commands, 0);
+		changed = Changed_Cells(1, pages[page], 2);
+		LCD_Text_Update(&Text, 1);
+		Check_Frame("page", 1, pages[page], 2, changed);
+	}
+	Sim_LCD_Row(&Sim, 0, Rows[0]);
+	TEST_CHECK_EQ(strcmp(Rows[0], "                "), 0);
+	Sim_LCD_Row(&Sim, 3, Rows[0]);
+	TEST_CHECK_EQ(strcmp(Rows[0], "                "), 0);
+
+	/* A word longer than a row is cut at the row end */
+	Clear_Screen();
+	changed = Changed_Cells(0, hard_break[0], 1);
+	LCD_Text_Start(&Text, &LCD, (const uint8*)"ABCDEFGHIJKLMNOPQRSTUV", LCD_TEXT_PAGE, LCD_FIRST_ROW, 1, 500);
+	Check_Frame("hard break 0", 0, hard_break[0], 1, changed);
+	changed = Changed_Cells(0, hard_break[1], 1);
+	LCD_Text_Update(&Text, 500);
+	Check_Frame("hard break 1", 0, hard_break[1], 1, changed);
+
+	/* Text that fits is drawn once and never redrawn */
+	Clear_Screen();
+	LCD_Text_Start(&Text, &LCD, (const uint8*)"Welcome!", LCD_TEXT_PAGE, LCD_FIRST_ROW, 1, 500);
+	TEST_CHECK(!Text.Active);
+	Check_Frame("fits", 0, fits, 1, 8);
+	LCD_Text_Update(&Text, 5000);
+	TEST_CHECK_EQ(Sim.Data_Writes + Sim.Commands, 0);
+
+	/* Marquee: one column every step, the text repeats after LCD_TEXT_MARQUEE_GAP blanks */
+	snprintf(cycle, sizeof(cycle), "%s%*s%s%*s", marquee, LCD_TEXT_MARQUEE_GAP, "", marquee, LCD_TEXT_MARQUEE_GAP, "");
+	Clear_Screen();
+	memcpy(frame, cycle, LCD_MAX_COLUMNS);
+	frame[LCD_MAX_COLUMNS] = '\0';
+	changed = Changed_Cells(3, expected, 1);
+	LCD_Text_Start(&Text, &LCD, (const uint8*)marquee, LCD_TEXT_MARQUEE, LCD_FOURTH_ROW, 3, 300);
+	TEST_CHECK_EQ(Text.Rows, 1);
+	Check_Frame("marquee 0", 3, expected, 1, changed);
+	for(step = 1; step <= (2 * (strlen(marquee) + LCD_TEXT_MARQUEE_GAP)); step++){
+		LCD_Text_Update(&Text, 200);
+		TEST_CHECK_EQ(Sim.Data_Writes + Sim.Commands, 0);
+		memcpy(frame, &cycle[step % (strlen(marquee) + LCD_TEXT_MARQUEE_GAP)], LCD_MAX_COLUMNS);
+		changed = Changed_Cells(3, expected, 1);
+		LCD_Text_Update(&Text, 100);
+		Check_Frame("marquee", 3, expected, 1, changed);
+		if(Test_Failures){
+			printf("at step %u\n", step);
+			break;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	/* Stopped: the last frame stays */
+	LCD_Text_Stop(&Text);
+	LCD_Text_Update(&Text, 300);
+	TEST_CHECK_EQ(Sim.Data_Writes + Sim.Commands, 0);
+	TEST_CHECK_EQ(Sim.Violations, 0);
+
+	return TEST_RESULT("test_lcd_text");
+}
@@ -0,0 +1,187 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_lcd_timing.c 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Runs ECU_Init and the admin screens of ecu.c on two simulated HD44780 and
+ * reports the bus time of each step against the original millisecond driver.
+ * The models check the enable pulse widths and every execution time. */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include "test.h"
+#include "sim_lcd.h"
+#include "ecu.h"
+
+TEST_MAIN_DEFINITIONS;
+
+/* Original driver: 2 ms + 4 commands of 107 ms + 11 ms of extra delays per LCD_Init,
+ * 107 ms per command or character (1 + 1 + 2 + 1 + 2 + 100 ms of MCAL_STK_Delay1ms) */
+#define BASELINE_INIT_MS		439ULL
+#define BASELINE_TRANSFER_MS	107ULL
+
+//----------------------------------------------
+// Section: Stubs of the modules the screens do not use
+//----------------------------------------------
+static void (*Sim_Tasks[8])(void);
+static uint8 Sim_Tasks_Count;
+static Keypad_Event_t Sim_Keys[64];
+static uint8 Sim_Keys_Head, Sim_Keys_Count;
+static Cred_t Sim_Creds[CRED_MAX_USERS];
+
+uint8 SCH_Add_Task(void (*task)(void), uint16 period_ms, SCH_Context_t context){
+	(void)period_ms; (void)context;
+	Sim_Tasks[Sim_Tasks_Count++] = task;
+	return 1;
+}
+void SCH_Init(void){ Sim_Tasks_Count = 0; }
+
+uint8 keypad_Get_Event(Keypad_Event_t* event){
+	if(Sim_Keys_Head < Sim_Keys_Count){
+		*event = Sim_Keys[Sim_Keys_Head++];
+		return 1;
+	}
+	return 0;
+}
+void keypad_Scan_Tick(void){}
+void keypad_init(){}
+
+uint8 Cred_Store_Init(void){ return CRED_OK; }
+uint8 Cred_Store_Set(uint8 slot, const uint8* uid, uint8 length){
+	memcpy(Sim_Creds[slot].UID, uid, length);
+	Sim_Creds[slot].Length = length;
+	return CRED_OK;
+}
+const Cred_t* Cred_Store_Get(uint8 slot){ return &Sim_Creds[slot]; }
+uint8 Cred_Store_Find(const uint8* uid, uint8 length){ (void)uid; (void)length; return CRED_NOT_FOUND; }
+uint8 Cred_Store_Count(void){
+	uint8 slot, count = 0;
+	for(slot = 0; slot < CRED_MAX_USERS; slot++){ count += (0 != Sim_Creds[slot].Length); }
+	return count;
+}
+
+const LED_Pattern_t LED_PATTERN_BLINK3, LED_PATTERN_BREATHE, LED_PATTERN_FAST_ALARM;
+void LED_Init(const LED_cfg_t *led_cfg){ (void)led_cfg; }
+void LED_Pattern_Init(LED_Pattern_Player_t* player, const LED_cfg_t* led_cfg){ (void)player; (void)led_cfg; }
+uint8 LED_Pattern_Start(LED_Pattern_Player_t* player, const LED_Pattern_t* pattern){ (void)player; (void)pattern; return 1; }
+void LED_Pattern_Stop(LED_Pattern_Player_t* player){ (void)player; }
+void LED_Pattern_Update(LED_Pattern_Player_t* player, uint16 elapsed_ms){ (void)player; (void)elapsed_ms; }
+void LED_Pattern_Set_Done_CallBack(LED_Pattern_Player_t* player, void (*callback)(const LED_Pattern_t* pattern)){ (void)player; (void)callback; }
+
+uint8 Clock_Mode_Add_UART(USART_TypeDef* USARTx){ (void)USARTx; return 1; }
+void Clock_Mode_Init(Clock_Mode_t mode){ (void)mode; }
+void Clock_Mode_Update(uint8 busy, uint16 elapsed_ms){ (void)busy; (void)elapsed_ms; }
+void Gate_Session_Arm_Event(Gate_Session_t* session, uint8 angle){ (void)session; (void)angle; }
+void Gate_Session_Init(Gate_Session_t* session, uint8 servo, GPIO_TypeDef* PIR_Port, uint8 PIR_Line, void (*PIR_CallBack)(void), void (*done_callback)(void)){
+	(void)session; (void)servo; (void)PIR_Port; (void)PIR_Line; (void)PIR_CallBack; (void)done_callback;
+}
+uint8 Gate_Session_Is_Busy(const Gate_Session_t* session){ (void)session; return 0; }
+void Gate_Session_Open(Gate_Session_t* session){ (void)session; }
+void Gate_Session_PIR_Event(Gate_Session_t* session){ (void)session; }
+void Gate_Session_Update(Gate_Session_t* session){ (void)session; }
+void MCAL_NVIC_Critical_Measure_Start(void){}
+uint8 MCAL_NVIC_Relocate_Vector_Table(void){ return 1; }
+void IRQ_Priorities_Init(void){}
+void MCAL_RCC_Select_Clock(uint8 clock){ (void)clock; }
+void MCAL_USART_Init(USART_TypeDef* USARTx, USART_cfg_t* USART_cfg){ (void)USARTx; (void)USART_cfg; }
+void MCAL_USART_ReceiveData(USART_TypeDef* USARTx, uint16 *pRxBuffer, Polling_Mechanism PollingEn){ (void)USARTx; (void)PollingEn; *pRxBuffer = 0; }
+void MCAL_USART_SendData(USART_TypeDef* USARTx, uint16 *pTxBuffer, Polling_Mechanism PollingEn){ (void)USARTx; (void)pTxBuffer; (void)PollingEn; }
+void Servo_Init(const Servo_t* Servos, uint8 Count){ (void)Servos; (void)Count; }
+void Servo_Set_Done_CallBack(void (*CallBack)(uint8 Servo, uint8 Angle)){ (void)CallBack; }
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+static Sim_LCD_t Admin_Sim, User_Sim;
+
+static void Type_Keys(const char* keys){
+	Sim_Keys_Head = 0;
+	Sim_Keys_Count = 0;
+	for(; *keys; keys++){
+		Sim_Keys[Sim_Keys_Count].Key = (uint8)*keys;
+		Sim_Keys[Sim_Keys_Count].Type = KEYPAD_EVENT_PRESS;
+		Sim_Keys_Count++;
+	}
+}
+
+/* Prints a step and checks it is at least min_factor times faster than the original driver */
+static void Report(const char* step, unsigned long long elapsed_ns, unsigned long transfers, unsigned long inits, unsigned long min_factor){
+	unsigned long long baseline_ms = (BASELINE_INIT_MS * inits) + (BASELINE_TRANSFER_MS * transfers);
+
+	printf("%-24s %4lu transfers %9.3f ms (original driver %6llu ms, x%.0f)\n",
+			step, transfers, elapsed_ns / 1e6, baseline_ms, (baseline_ms * 1e6) / (double)elapsed_ns);
+	TEST_CHECK((elapsed_ns * min_factor) < (baseline_ms * 1000000ULL));
+}
+
+static unsigned long Transfers(const Sim_LCD_t* lcd){
+	return lcd->Commands + lcd->Data_Writes + lcd->CGRAM_Writes;
+}
+
+static void Check_Row(const Sim_LCD_t* lcd, uint8 row, const char* expected){
+	char text[17];
+	Sim_LCD_Row(lcd, row, text);
+	if(0 != strcmp(text, expected)){
+		printf("row %u is \"%s\", expected \"%s\"\n", row, text, expected);
+		Test_Failures++;
+	}
+	else{ /* Do Nothing */ }
+}
+
+int main(void){
+	unsigned long long start;
+	uint8 user;
+
+	Sim_LCD_Attach(&Admin_Sim, GPIOB, GPIO_PIN_11, GPIO_PIN_10, GPIO_PIN_12, GPIO_PIN_13, GPIO_PIN_14, GPIO_PIN_15);
+	Sim_LCD_Attach(&User_Sim, GPIOA, GPIO_PIN_5, GPIO_PIN_6, GPIO_PIN_12, GPIO_PIN_13, GPIO_PIN_14, GPIO_PIN_15);
+
+	/* Boot: both LCD_Init */
+	start = Sim_Time_ns;
+	ECU_Init();
+	Report("ECU_Init (2 LCDs)", Sim_Time_ns - start, Transfers(&Admin_Sim) + Transfers(&User_Sim), 2, 50);	// 15 ms power on waits
+	TEST_CHECK(Admin_Sim.Four_Bit && User_Sim.Four_Bit);
+	TEST_CHECK_EQ(Admin_Sim.Violations, 0);
+	Sim_LCD_Clear_Stats(&Admin_Sim);
+
+	/* Entry screen */
+	start = Sim_Time_ns;
+	Admin_Init();
+	Report("Admin_Init screen", Sim_Time_ns - start, Transfers(&Admin_Sim), 0, 1000);
+	Check_Row(&Admin_Sim, 0, "Enter users' IDs");
+	Check_Row(&Admin_Sim, 1, "User1:_         ");
+	Check_Row(&Admin_Sim, 2, "User2:          ");
+	TEST_CHECK_EQ(Admin_Sim.Violations, 0);
+	Sim_LCD_Clear_Stats(&Admin_Sim);
+
+	/* Three IDs typed, with a correction, through the admin task */
+	TEST_CHECK(Sim_Tasks_Count > 2);
+	Type_Keys("1234#98*7#555#");
+	start = Sim_Time_ns;
+	for(user = 0; user < Sim_Tasks_Count; user++){
+		Sim_Tasks[user]();
+	}
+	Report("ID entry (14 keys)", Sim_Time_ns - start, Transfers(&Admin_Sim), 0, 1000);
+	Check_Row(&Admin_Sim, 0, "  System is ON  ");
+	Check_Row(&Admin_Sim, 1, "User1:1234      ");
+	Check_Row(&Admin_Sim, 2, "User2:97        ");
+	Check_Row(&Admin_Sim, 3, "User3:555       ");
+	TEST_CHECK_EQ(Cred_Store_Count(), 3);
+	TEST_CHECK_EQ(Admin_Sim.Violations, 0);
+	Sim_LCD_Clear_Stats(&Admin_Sim);
+
+	/* Next boot, IDs restored from the EEPROM */
+	start = Sim_Time_ns;
+	TEST_CHECK(Admin_Restore());
+	Report("Admin_Restore screen", Sim_Time_ns - start, Transfers(&Admin_Sim), 0, 1000);
+	Check_Row(&Admin_Sim, 0, "  System is ON  ");
+	Check_Row(&Admin_Sim, 3, "User3:555       ");
+	TEST_CHECK_EQ(Admin_Sim.Violations, 0);
+	TEST_CHECK_EQ(User_Sim.Violations, 0);
+
+	return TEST_RESULT("test_lcd_timing");
+}
@@ -0,0 +1,179 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_led.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* LED driver on the TIM1...TIM4 model: the green LED of the board on TIM1 CH4,
+ * active low, the gamma table against (level / 63)^2.2, the CCR and lit time of
+ * every level, on, off and toggle, an active high LED on the same timer and the
+ * red GPIO LED */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <math.h>
+#include "test.h"
+#include "sim_tim.h"
+#include "../HAL/led_driver.c"
+
+TEST_MAIN_DEFINITIONS;
+
+#define US_NS			1000ULL
+#define PERIOD_NS		(LED_PWM_PERIOD * US_NS)
+
+//----------------------------------------------
+// Section: Simulated GPIO
+//----------------------------------------------
+static uint16 Sim_Pin_Mode[16];
+static uint16 Sim_Pins, Sim_Writes, Sim_Toggles;
+
+void MCAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_PinConfig_t* PinConfig){
+	uint8 pin;
+
+	(void)GPIOx;
+	for(pin = 0; pin < 16; pin++){
+		if(PinConfig->GPIO_PinNumber & (1U << pin)){
+			Sim_Pin_Mode[pin] = PinConfig->GPIO_MODE;
+		}
+		else{ /* Do Nothing */ }
+	}
+}
+void MCAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16 PinNumber, uint8 Value){
+	(void)GPIOx;
+	Sim_Pins = (GPIO_PIN_SET == Value) ? (Sim_Pins | PinNumber) : (Sim_Pins & ~PinNumber);
+	Sim_Writes++;
+}
+void MCAL_GPIO_ToggleGroup(GPIO_TypeDef* GPIOx, uint16 GroupMask){
+	(void)GPIOx;
+	Sim_Pins ^= GroupMask;
+	Sim_Toggles++;
+}
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+
+/* Time the LED is lit in the last period of TIM1 */
+static unsigned long long Lit_ns(const LED_cfg_t* led, uint8 channel){
+	unsigned long long high = Sim_TIM_Wave[0].High_ns[channel];
+
+	return (led->LED_Mode == LED_Active_Low) ? (Sim_TIM_Wave[0].Period_ns - high) : high;
+}
+
+/* Runs the period still using the last width, then one with the new width */
+static void Next_Width(void){
+	Sim_TIM_Run(TIM1, 2);
+}
+
+int main(void){
+	LED_cfg_t green, white, red;
+	long ideal;
+	uint8 level;
+
+	Sim_TIM_Reset();
+
+	/* Green LED of the board: PA11, TIM1 CH4, active low */
+	green.LED_Port = GPIOA;
+	green.LED_Mode = LED_Active_Low;
+	green.LED_Pin.GPIO_PinNumber = GPIO_PIN_11;
+	green.LED_Pin.GPIO_MODE = GPIO_MODE_OUTPUT_AF_PP;
+	green.LED_Pin.GPIO_OUTPUT_SPEED = GPIO_SPEED_10M;
+	green.LED_Timer = TIM1;
+	green.LED_Channel = PWM_CHANNEL_4;
+	LED_Init(&green);
+	TEST_CHECK_EQ(Sim_Pin_Mode[11], GPIO_MODE_OUTPUT_AF_PP);
+	TEST_CHECK(TIM1->BDTR & TIM_BDTR_MOE);
+
+	/* Off from the first period: the output stays high for the whole 1 kHz period */
+	TEST_CHECK_EQ(TIM1->CCR4, LED_PWM_PERIOD);
+	Sim_TIM_Run(TIM1, 1);
+	TEST_CHECK_EQ(Sim_TIM_Wave[0].Period_ns, PERIOD_NS);
+	TEST_CHECK(Sim_TIM_Wave[0].Enabled[3]);
+	TEST_CHECK_EQ(Sim_TIM_Wave[0].High_ns[3], PERIOD_NS);
+	TEST_CHECK_EQ(Lit_ns(&green, 3), 0);
+
+	/* Gamma table: 0 and full at the ends, never darker for a higher level, within one tick of the curve */
+	TEST_CHECK_EQ(LED_Gamma[0], 0);
+	TEST_CHECK_EQ(LED_Gamma[LED_BRIGHTNESS_MAX], LED_PWM_PERIOD);
+	for(level = 0; level <= LED_BRIGHTNESS_MAX; level++){
+		ideal = lround(pow((double)level / LED_BRIGHTNESS_MAX, 2.2) * LED_PWM_PERIOD);
+		TEST_CHECK(labs((long)LED_Gamma[level] - ideal) <= 1);
+		TEST_CHECK((0 == level) || (LED_Gamma[level] >= LED_Gamma[level - 1]));
+	}
+
+	/* Every level: the inverted CCR and the lit time of the gamma pulse */
+	for(level = 0; level <= LED_BRIGHTNESS_MAX; level++){
+		LED_Set_Brightness(&green, level);
+		TEST_CHECK_EQ(TIM1->CCR4, LED_PWM_PERIOD - LED_Gamma[level]);
+		Next_Width();
+		TEST_CHECK_EQ(Lit_ns(&green, 3), LED_Gamma[level] * US_NS);
+	}
+	LED_Set_Brightness(&green, 200);
+	TEST_CHECK_EQ(TIM1->CCR4, 0);
+
+	/* On, off and toggle, a dimmed LED toggles to off */
+	LED_TurnOff(&green);
+	TEST_CHECK_EQ(TIM1->CCR4, LED_PWM_PERIOD);
+	Next_Width();
+	TEST_CHECK_EQ(Lit_ns(&green, 3), 0);
+	LED_TurnOn(&green);
+	TEST_CHECK_EQ(TIM1->CCR4, 0);
+	Next_Width();
+	TEST_CHECK_EQ(Lit_ns(&green, 3), PERIOD_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[0].High_ns[3], 0);
+	LED_Toggle(&green);
+	TEST_CHECK_EQ(TIM1->CCR4, LED_PWM_PERIOD);
+	LED_Toggle(&green);
+	TEST_CHECK_EQ(TIM1->CCR4, 0);
+	LED_Set_Brightness(&green, 10);
+	LED_Toggle(&green);
+	TEST_CHECK_EQ(TIM1->CCR4, LED_PWM_PERIOD);
+
+	/* An active high LED on CH1 of the same timer: not inverted, the green one keeps its width */
+	white = green;
+	white.LED_Mode = LED_Active_High;
+	white.LED_Pin.GPIO_PinNumber = GPIO_PIN_8;
+	white.LED_Channel = PWM_CHANNEL_1;
+	LED_Init(&white);
+	TEST_CHECK_EQ(TIM1->CCR1, 0);
+	LED_Set_Brightness(&white, 40);
+	LED_Set_Brightness(&green, 20);
+	TEST_CHECK_EQ(TIM1->CCR1, LED_Gamma[40]);
+	Next_Width();
+	TEST_CHECK_EQ(Lit_ns(&white, 0), LED_Gamma[40] * US_NS);
+	TEST_CHECK_EQ(Lit_ns(&green, 3), LED_Gamma[20] * US_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[0].Period_ns, PERIOD_NS);
+
+	/* Red LED of the board: PA0 GPIO, active low, on above half brightness */
+	red.LED_Port = GPIOA;
+	red.LED_Mode = LED_Active_Low;
+	red.LED_Pin.GPIO_PinNumber = GPIO_PIN_0;
+	red.LED_Pin.GPIO_MODE = GPIO_MODE_OUTPUT_PP;
+	red.LED_Pin.GPIO_OUTPUT_SPEED = GPIO_SPEED_10M;
+	red.LED_Timer = NULL;
+	red.LED_Channel = 0;
+	LED_Init(&red);
+	TEST_CHECK_EQ(Sim_Pins & GPIO_PIN_0, GPIO_PIN_0);
+	LED_TurnOn(&red);
+	TEST_CHECK_EQ(Sim_Pins & GPIO_PIN_0, 0);
+	LED_TurnOff(&red);
+	TEST_CHECK_EQ(Sim_Pins & GPIO_PIN_0, GPIO_PIN_0);
+	LED_Set_Brightness(&red, LED_BRIGHTNESS_MAX / 2 + 1);
+	TEST_CHECK_EQ(Sim_Pins & GPIO_PIN_0, 0);
+	LED_Set_Brightness(&red, LED_BRIGHTNESS_MAX / 2);
+	TEST_CHECK_EQ(Sim_Pins & GPIO_PIN_0, GPIO_PIN_0);
+	LED_Toggle(&red);
+	TEST_CHECK_EQ(Sim_Pins & GPIO_PIN_0, 0);
+	TEST_CHECK_EQ(Sim_Toggles, 1);
+	TEST_CHECK_EQ(Sim_Writes, 5);
+
+	/* The PWM LEDs never drove their pins as GPIO */
+	TEST_CHECK_EQ(Sim_Pins & (GPIO_PIN_8 | GPIO_PIN_11), 0);
+	TEST_CHECK_EQ(Sim_TIM_Violations, 0);
+
+	return TEST_RESULT("test_led");
+}
@@ -0,0 +1,195 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_led_pattern.c 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Pattern player on a simulated tick: step timing, priorities, resuming
+ * the preempted looping pattern, fading and the done callback */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "test.h"
+#include "led_pattern.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#define TICK_MS		10		// LED_PATTERN_PERIOD_MS of the application
+
+//----------------------------------------------
+// Section: Simulated LED and BASEPRI
+//----------------------------------------------
+static uint8 Sim_Level;		// 0...LED_BRIGHTNESS_MAX
+static unsigned long Sim_Critical_Depth;
+
+void LED_TurnOn(const LED_cfg_t *led_cfg){ (void)led_cfg; Sim_Level = LED_BRIGHTNESS_MAX; }
+void LED_TurnOff(const LED_cfg_t *led_cfg){ (void)led_cfg; Sim_Level = 0; }
+void LED_Set_Brightness(const LED_cfg_t *led_cfg, uint8 level){
+	(void)led_cfg;
+	TEST_CHECK(level <= LED_BRIGHTNESS_MAX);
+	Sim_Level = level;
+}
+uint32 MCAL_NVIC_Critical_Enter(uint8 level){
+	TEST_CHECK_EQ(level, LED_PATTERN_CRITICAL_LEVEL);
+	Sim_Critical_Depth++;
+	return 0;
+}
+void MCAL_NVIC_Critical_Exit(uint32 basepri){ (void)basepri; Sim_Critical_Depth--; }
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+static LED_cfg_t LED;
+static LED_Pattern_Player_t Player;
+static const LED_Pattern_t* Done_Pattern;
+static unsigned long Done_Count, Time_ms, Done_Time_ms;
+
+static void Done_CallBack(const LED_Pattern_t* pattern){
+	Done_Pattern = pattern;
+	Done_Count++;
+	Done_Time_ms = Time_ms;
+	/* The player is already on the next pattern */
+	TEST_CHECK(Player.Pattern != pattern);
+}
+
+static void Run(unsigned long ms, uint16 period_ms){
+	unsigned long end = Time_ms + ms;
+	while(Time_ms < end){
+		Time_ms += period_ms;
+		LED_Pattern_Update(&Player, period_ms);
+	}
+}
+
+/* Checks the LED over a finite on/off pattern sampled on every tick */
+static void Check_Blinks(const LED_Pattern_t* pattern){
+	unsigned long start = Time_ms, cycle = 0, offset;
+	uint8 step, runs, expected;
+
+	for(step = 0; step < pattern->Count; step++){
+		cycle += pattern->Steps[step];
+	}
+	for(runs = 0; runs < pattern->Repeat; runs++){
+		for(offset = 0; offset < cycle; offset += TICK_MS){
+			/* Level during [Time_ms, Time_ms + TICK_MS) */
+			unsigned long at = offset, edge = 0;
+			expected = LED_BRIGHTNESS_MAX;
+			for(step = 0; step < pattern->Count; step++){
+				edge += pattern->Steps[step];
+				if(at < edge){
+					expected = (step & 1) ? 0 : LED_BRIGHTNESS_MAX;
+					break;
+				}
+				else{ /* Do Nothing */ }
+			}
+			if(Sim_Level != expected){
+				printf("at %lu ms of the pattern the LED is %u, expected %u\n", Time_ms - start, Sim_Level, expected);
+				Test_Failures++;
+				return;
+			}
+			else{ /* Do Nothing */ }
+			Run(TICK_MS, TICK_MS);
+		}
+	}
+}
+
+int main(void){
+	uint8 level, previous;
+
+	LED_Pattern_Init(&Player, &LED);
+	LED_Pattern_Set_Done_CallBack(&Player, Done_CallBack);
+	TEST_CHECK(!LED_Pattern_Is_Active(&Player));
+	Run(100, TICK_MS);
+	TEST_CHECK_EQ(Sim_Level, 0);
+
+	/* Three 100 ms flashes, the callback comes on the tick that ends the last off time */
+	TEST_CHECK(LED_Pattern_Start(&Player, &LED_PATTERN_BLINK3));
+	Check_Blinks(&LED_PATTERN_BLINK3);
+	TEST_CHECK(!LED_Pattern_Is_Active(&Player));
+	TEST_CHECK_EQ(Done_Count, 1);
+	TEST_CHECK(&LED_PATTERN_BLINK3 == Done_Pattern);
+	TEST_CHECK_EQ(Done_Time_ms, Time_ms);
+	TEST_CHECK_EQ(Sim_Level, 0);
+
+	/* Ten 50 ms flashes, then 250 ms updates that end several steps in one call */
+	TEST_CHECK(LED_Pattern_Start(&Player, &LED_PATTERN_FAST_ALARM));
+	Check_Blinks(&LED_PATTERN_FAST_ALARM);
+	TEST_CHECK_EQ(Done_Count, 2);
+	TEST_CHECK(LED_Pattern_Start(&Player, &LED_PATTERN_BLINK3));
+	Run(500, 250);
+	TEST_CHECK(LED_Pattern_Is_Active(&Player));
+	Run(250, 250);
+	TEST_CHECK(!LED_Pattern_Is_Active(&Player));
+	TEST_CHECK_EQ(Done_Count, 3);
+
+	/* A looping pattern never calls back and is resumed after a finite one */
+	TEST_CHECK(LED_Pattern_Start(&Player, &LED_PATTERN_HEARTBEAT));
+	Run(5000, TICK_MS);
+	TEST_CHECK_EQ(Done_Count, 3);
+	TEST_CHECK(LED_Pattern_Start(&Player, &LED_PATTERN_BLINK3));
+	Check_Blinks(&LED_PATTERN_BLINK3);
+	TEST_CHECK_EQ(Done_Count, 4);
+	TEST_CHECK(&LED_PATTERN_HEARTBEAT == Player.Pattern);
+	TEST_CHECK_EQ(Player.Step, 0);
+	TEST_CHECK_EQ(Sim_Level, LED_BRIGHTNESS_MAX);
+
+	/* Priorities: the alarm takes over the blink, which never completes, and refuses lower ones */
+	TEST_CHECK(LED_Pattern_Start(&Player, &LED_PATTERN_BLINK3));
+	Run(150, TICK_MS);
+	TEST_CHECK(LED_Pattern_Start(&Player, &LED_PATTERN_FAST_ALARM));
+	TEST_CHECK(!LED_Pattern_Start(&Player, &LED_PATTERN_BLINK3));
+	TEST_CHECK(!LED_Pattern_Start(&Player, &LED_PATTERN_BREATHE));
+	Run(990, TICK_MS);
+	TEST_CHECK_EQ(Done_Count, 4);
+	Run(TICK_MS, TICK_MS);
+	TEST_CHECK_EQ(Done_Count, 5);
+	TEST_CHECK(&LED_PATTERN_FAST_ALARM == Done_Pattern);
+	/* The heartbeat was kept through both */
+	TEST_CHECK(&LED_PATTERN_HEARTBEAT == Player.Pattern);
+
+	/* Stopped patterns do not call back */
+	TEST_CHECK(LED_Pattern_Start(&Player, &LED_PATTERN_BLINK3));
+	Run(300, TICK_MS);
+	LED_Pattern_Stop(&Player);
+	TEST_CHECK(!LED_Pattern_Is_Active(&Player));
+	TEST_CHECK_EQ(Sim_Level, 0);
+	Run(1000, TICK_MS);
+	TEST_CHECK_EQ(Done_Count, 5);
+	TEST_CHECK_EQ(Sim_Level, 0);
+
+	/* Breathing: brightness rises for 1.5 s, then falls, on every tick */
+	TEST_CHECK(LED_Pattern_Start(&Player, &LED_PATTERN_BREATHE));
+	TEST_CHECK_EQ(Sim_Level, 0);
+	previous = 0;
+	for(Time_ms = 0; Time_ms < 1490; ){
+		Run(TICK_MS, TICK_MS);
+		level = Sim_Level;
+		TEST_CHECK(level >= previous);
+		previous = level;
+	}
+	TEST_CHECK(previous >= (LED_BRIGHTNESS_MAX - 1));
+	Run(TICK_MS, TICK_MS);
+	previous = Sim_Level;
+	TEST_CHECK_EQ(previous, LED_BRIGHTNESS_MAX);
+	for(Time_ms = 0; Time_ms < 1490; ){
+		Run(TICK_MS, TICK_MS);
+		level = Sim_Level;
+		TEST_CHECK(level <= previous);
+		previous = level;
+	}
+	TEST_CHECK(previous <= 1);
+
+	/* Without a callback the player runs the same way */
+	LED_Pattern_Set_Done_CallBack(&Player, NULL);
+	LED_Pattern_Stop(&Player);
+	TEST_CHECK(LED_Pattern_Start(&Player, &LED_PATTERN_BLINK3));
+	Run(600, TICK_MS);
+	TEST_CHECK(!LED_Pattern_Is_Active(&Player));
+	TEST_CHECK_EQ(Done_Count, 5);
+	TEST_CHECK_EQ(Sim_Critical_Depth, 0);
+
+	return TEST_RESULT("test_led_pattern");
+}
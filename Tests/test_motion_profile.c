@@ -0,0 +1,140 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_motion_profile.c 			                     */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Trajectories stepped every millisecond: total duration, monotonic moves
+ * that end on the target, velocity and acceleration within the limits */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "test.h"
+#include "motion_profile.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#define MAX_DURATION_MS		5000
+#define WINDOW_MS			100		// Velocity and acceleration are measured over this window
+
+typedef struct{
+	const char*		Name;
+	Motion_Limits_t	Limits;
+	uint16			Start, Target;
+	uint32			Duration_ms;	// Expected, from the closed form of each shape
+	uint8			Velocity_Bound;	// 1 if the duration is set by the velocity limit, 0 by the acceleration
+}Case_t;
+
+static uint16 Positions[MAX_DURATION_MS + 1];
+
+static void Run_Case(const Case_t* test){
+	Motion_t motion;
+	uint32 t, duration = 0;
+	sint32 step, window;
+	double velocity, accel, peak_velocity = 0, peak_accel = 0;
+	double h = WINDOW_MS / 1000.0;
+	sint32 direction = (test->Target > test->Start) ? 1 : -1;
+	unsigned long failures = Test_Failures;
+
+	Motion_Init(&motion, &test->Limits, test->Start);
+	TEST_CHECK_EQ(Motion_Step(&motion, 10), test->Start);
+	Motion_Start(&motion, test->Target);
+	TEST_CHECK(Motion_Is_Active(&motion));
+
+	Positions[0] = test->Start;
+	for(t = 1; (t <= MAX_DURATION_MS) && Motion_Is_Active(&motion); t++){
+		Positions[t] = Motion_Step(&motion, 1);
+		step = ((sint32)Positions[t] - (sint32)Positions[t - 1]) * direction;
+		/* Never backwards and never past the target */
+		TEST_CHECK(step >= 0);
+		TEST_CHECK(((sint32)test->Target - (sint32)Positions[t]) * direction >= 0);
+		duration = t;
+		if(failures != Test_Failures){
+			printf("%s: at %lu ms\n", test->Name, (unsigned long)t);
+			return;
+		}
+		else{ /* Do Nothing */ }
+	}
+	TEST_CHECK(!Motion_Is_Active(&motion));
+	TEST_CHECK_EQ(Positions[duration], test->Target);
+	TEST_CHECK_EQ(motion.Duration_ms, duration);
+	TEST_CHECK((duration + 1 >= test->Duration_ms) && (duration <= test->Duration_ms + 1));
+
+	/* Window averages, the quantization of the positions is +/-1 unit per sample */
+	for(t = WINDOW_MS; (t + WINDOW_MS) <= duration; t++){
+		window = ((sint32)Positions[t + WINDOW_MS] - (sint32)Positions[t - WINDOW_MS]) * direction;
+		velocity = window / (2 * h);
+		accel = (((sint32)Positions[t + WINDOW_MS] + (sint32)Positions[t - WINDOW_MS] - 2 * (sint32)Positions[t]) * direction) / (h * h);
+		peak_velocity = (velocity > peak_velocity) ? velocity : peak_velocity;
+		peak_accel = ((accel > peak_accel) || (-accel > peak_accel)) ? ((accel < 0) ? -accel : accel) : peak_accel;
+	}
+	printf("%-28s %4lu ms, peak velocity %5.0f/%lu, acceleration %5.0f/%lu\n", test->Name, (unsigned long)duration,
+			peak_velocity, (unsigned long)test->Limits.Max_Velocity, peak_accel, (unsigned long)test->Limits.Acceleration);
+	TEST_CHECK(peak_velocity <= (test->Limits.Max_Velocity * 1.01) + (1 / h));
+	TEST_CHECK(peak_accel <= (test->Limits.Acceleration * 1.01) + (3 / (h * h)));
+	/* The shortest time: the bounding limit is reached */
+	if(test->Velocity_Bound){
+		TEST_CHECK(peak_velocity >= (test->Limits.Max_Velocity * 0.95));
+	}
+	else{
+		TEST_CHECK(peak_accel >= (test->Limits.Acceleration * 0.75));
+	}
+
+	/* Zero velocity at both ends of an S-curve */
+	if(MOTION_SCURVE == test->Limits.Shape){
+		TEST_CHECK((((sint32)Positions[10] - (sint32)Positions[0]) * direction) <= 1);
+		TEST_CHECK((((sint32)Positions[duration] - (sint32)Positions[duration - 10]) * direction) <= 1);
+	}
+	else{ /* Do Nothing */ }
+}
+
+int main(void){
+	static const Case_t cases[] = {
+			{"trapezoid cruise up",         {MOTION_TRAPEZOID, 1000, 2000},    0, 3000, 3500, 1},
+			{"trapezoid cruise down",       {MOTION_TRAPEZOID, 1000, 2000}, 3000, 1000, 2500, 1},
+			{"trapezoid triangle",          {MOTION_TRAPEZOID, 1000, 2000},  100,  300,  632, 0},
+			{"s-curve gate arm open",       {MOTION_SCURVE,    1000, 2000},  500, 1488, 1852, 1},
+			{"s-curve gate arm close",      {MOTION_SCURVE,    1000, 2000}, 1488,  500, 1852, 1},
+			{"s-curve acceleration bound",  {MOTION_SCURVE,    1000,  200},    0,  100, 1699, 0},
+	};
+	static const Motion_Limits_t servo = {MOTION_SCURVE, 1000, 2000};
+	Motion_t motion;
+	uint16 position;
+	uint8 index;
+
+	for(index = 0; index < (sizeof(cases) / sizeof(cases[0])); index++){
+		Run_Case(&cases[index]);
+	}
+
+	/* No move: inactive at once */
+	Motion_Init(&motion, &servo, 700);
+	Motion_Start(&motion, 700);
+	TEST_CHECK(!Motion_Is_Active(&motion));
+	TEST_CHECK_EQ(Motion_Step(&motion, 20), 700);
+
+	/* Replanned halfway back to the start, from where it is */
+	Motion_Start(&motion, 1488);
+	while(Motion_Is_Active(&motion) && (motion.Elapsed_ms < 900)){
+		position = Motion_Step(&motion, 20);
+	}
+	TEST_CHECK((position > 700) && (position < 1488));
+	Motion_Start(&motion, 700);
+	TEST_CHECK_EQ(motion.Start, position);
+	TEST_CHECK_EQ(motion.Distance, position - 700);
+	TEST_CHECK(Motion_Step(&motion, 20) <= position);
+	while(Motion_Is_Active(&motion)){
+		Motion_Step(&motion, 20);
+	}
+	TEST_CHECK_EQ(motion.Position, 700);
+
+	/* Steps longer than the move land on the target */
+	Motion_Start(&motion, 1000);
+	TEST_CHECK_EQ(Motion_Step(&motion, 60000), 1000);
+	TEST_CHECK(!Motion_Is_Active(&motion));
+
+	return TEST_RESULT("test_motion_profile");
+}
@@ -0,0 +1,178 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_nvic.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* NVIC driver on the NVIC/SCB/DWT model: the IP and SHP bytes written by the
+ * interrupt priority plan of the board, priority encoding of the system
+ * exceptions, BASEPRI only raised by nested critical sections and restored in
+ * order, and the worst case masked time measured on the DWT cycle counter */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "test.h"
+#include "sim_nvic.h"
+#include "irq_priorities.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#define IP_BYTES	(sizeof(Sim_NVIC.IP))
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+
+/* Priority byte of each interrupt of the board */
+static const struct{
+	uint8 IRQn;
+	uint8 Priority;
+}Board_IRQs[] = {
+		{37, NVIC_PRIO_0001},	// USART1, enter gate reader
+		{38, NVIC_PRIO_0001},	// USART2, exit gate reader
+		{30, NVIC_PRIO_0010},	// TIM4, servo steps
+		{7,  NVIC_PRIO_0011},	// EXTI1, exit PIR
+		{10, NVIC_PRIO_0011},	// EXTI4, enter PIR
+		{23, NVIC_PRIO_0011}	// EXTI9_5, keypad columns
+};
+
+/* An exception of this priority is held back by the current BASEPRI */
+static uint8 Masked(uint8 priority){
+	return (0 != Sim_BASEPRI) && (priority >= Sim_BASEPRI);
+}
+
+int main(void){
+	uint32 outer, inner, same;
+	uint8 index, irq, expected;
+
+	Sim_NVIC_Reset();
+
+	/* Priority plan: 4 preemption bits, one byte per IRQ, SysTick in SHP[15 - 4] */
+	IRQ_Priorities_Init();
+	TEST_CHECK_EQ(Sim_SCB.AIRCR, SCB_VECTKEY | NVIC_PRIO_16GRP_0SUBGRP);
+	TEST_CHECK_EQ(MCAL_NVIC_GetPriorityGrouping(), 3);
+	for(irq = 0; irq < IP_BYTES; irq++){
+		expected = 0;
+		for(index = 0; index < (sizeof(Board_IRQs) / sizeof(Board_IRQs[0])); index++){
+			expected = (Board_IRQs[index].IRQn == irq) ? Board_IRQs[index].Priority : expected;
+		}
+		TEST_CHECK_EQ(Sim_NVIC.IP[irq], expected);
+		TEST_CHECK_EQ(MCAL_NVIC_GetPriority(irq), expected);
+	}
+	for(index = 0; index < sizeof(Sim_SCB.SHP); index++){
+		TEST_CHECK_EQ(Sim_SCB.SHP[index], (11 == index) ? NVIC_PRIO_0010 : 0);
+	}
+	TEST_CHECK_EQ(MCAL_NVIC_GetSystemPriority(NVIC_SYSTICK_EXCEPTION), IRQ_PRIO_TIMER);
+	TEST_CHECK_EQ(Sim_NVIC.IP[USART1_IRQ], IRQ_PRIO_UART_RX);
+	TEST_CHECK_EQ(Sim_NVIC.IP[TIM4_IRQ], IRQ_PRIO_TIMER);
+	TEST_CHECK_EQ(Sim_NVIC.IP[EXTI9_IRQ], IRQ_PRIO_EXTI);
+
+	/* Only the 4 implemented bits are written, fixed priority exceptions are left alone */
+	MCAL_NVIC_SetPriority(TIM2_IRQ, 0x5F);
+	TEST_CHECK_EQ(Sim_NVIC.IP[TIM2_IRQ], NVIC_PRIO_0101);
+	MCAL_NVIC_SetPriority(TIM2_IRQ, NVIC_PRIO_0000);
+	MCAL_NVIC_SetSystemPriority(NVIC_SVCALL_EXCEPTION, NVIC_PRIO_1110);
+	MCAL_NVIC_SetSystemPriority(NVIC_PENDSV_EXCEPTION, NVIC_PRIO_1111 | 0x0F);
+	TEST_CHECK_EQ(Sim_SCB.SHP[7], NVIC_PRIO_1110);
+	TEST_CHECK_EQ(Sim_SCB.SHP[10], NVIC_PRIO_1111);
+	MCAL_NVIC_SetSystemPriority(3, NVIC_PRIO_0100);		// HardFault
+	MCAL_NVIC_SetSystemPriority(16, NVIC_PRIO_0100);	// IRQ 0
+	TEST_CHECK_EQ(MCAL_NVIC_GetSystemPriority(3), 0);
+	TEST_CHECK_EQ(Sim_SCB.SHP[0], 0);
+	TEST_CHECK_EQ(Sim_NVIC.IP[0], 0);
+	MCAL_NVIC_SetSystemPriority(NVIC_SVCALL_EXCEPTION, NVIC_PRIO_0000);
+	MCAL_NVIC_SetSystemPriority(NVIC_PENDSV_EXCEPTION, NVIC_PRIO_0000);
+
+	/* Timer level sections hold back the timers and the edges, never the card bytes */
+	CRITICAL_ENTER(IRQ_PRIO_TIMER);
+	TEST_CHECK_EQ(Sim_BASEPRI, IRQ_PRIO_TIMER);
+	TEST_CHECK(!Masked(Sim_NVIC.IP[USART1_IRQ]) && !Masked(Sim_NVIC.IP[USART2_IRQ]));
+	TEST_CHECK(Masked(Sim_NVIC.IP[TIM4_IRQ]) && Masked(Sim_SCB.SHP[11]));
+	TEST_CHECK(Masked(Sim_NVIC.IP[EXTI1_IRQ]) && Masked(Sim_NVIC.IP[EXTI9_IRQ]));
+	CRITICAL_EXIT();
+	TEST_CHECK_EQ(Sim_BASEPRI, 0);
+
+	/* Nested sections only raise the mask and each exit restores the level it found */
+	outer = MCAL_NVIC_Critical_Enter(IRQ_PRIO_EXTI);
+	TEST_CHECK_EQ(outer, 0);
+	TEST_CHECK_EQ(Sim_BASEPRI, IRQ_PRIO_EXTI);
+	inner = MCAL_NVIC_Critical_Enter(IRQ_PRIO_UART_RX | 0x0F);
+	TEST_CHECK_EQ(inner, IRQ_PRIO_EXTI);
+	TEST_CHECK_EQ(Sim_BASEPRI, IRQ_PRIO_UART_RX);
+	same = MCAL_NVIC_Critical_Enter(IRQ_PRIO_TIMER);
+	TEST_CHECK_EQ(same, IRQ_PRIO_UART_RX);
+	TEST_CHECK_EQ(Sim_BASEPRI, IRQ_PRIO_UART_RX);
+	TEST_CHECK_EQ(MCAL_NVIC_Critical_Enter(NVIC_PRIO_0000), IRQ_PRIO_UART_RX);
+	TEST_CHECK_EQ(Sim_BASEPRI, IRQ_PRIO_UART_RX);
+	MCAL_NVIC_Critical_Exit(IRQ_PRIO_UART_RX);
+	MCAL_NVIC_Critical_Exit(same);
+	TEST_CHECK_EQ(Sim_BASEPRI, IRQ_PRIO_UART_RX);
+	MCAL_NVIC_Critical_Exit(inner);
+	TEST_CHECK_EQ(Sim_BASEPRI, IRQ_PRIO_EXTI);
+	MCAL_NVIC_Critical_Exit(outer);
+	TEST_CHECK_EQ(Sim_BASEPRI, 0);
+
+	/* Macros nested in blocks, PRIMASK never touched */
+	CRITICAL_ENTER(IRQ_PRIO_TIMER);
+	CRITICAL_ENTER(IRQ_PRIO_EXTI);
+	TEST_CHECK_EQ(Sim_BASEPRI, IRQ_PRIO_TIMER);
+	CRITICAL_EXIT();
+	TEST_CHECK_EQ(Sim_BASEPRI, IRQ_PRIO_TIMER);
+	CRITICAL_EXIT();
+	TEST_CHECK_EQ(Sim_BASEPRI, 0);
+	TEST_CHECK_EQ(Sim_PRIMASK, 0);
+
+	/* Counter stopped out of reset: nothing measured */
+	CRITICAL_ENTER(IRQ_PRIO_TIMER);
+	Sim_DWT_Advance(1000);
+	CRITICAL_EXIT();
+	TEST_CHECK_EQ(MCAL_NVIC_Critical_Get_Max_Cycles(), 0);
+
+	/* Measured: the outermost section of nested ones, global sections too, the worst one kept */
+	Sim_DWT.CYCCNT = 1234;
+	MCAL_NVIC_Critical_Measure_Start();
+	TEST_CHECK(Sim_CoreDebug.DEMCR & (1UL << 24));
+	TEST_CHECK(Sim_DWT.CTRL & 1UL);
+	TEST_CHECK_EQ(Sim_DWT.CYCCNT, 0);
+	CRITICAL_ENTER(IRQ_PRIO_EXTI);
+	Sim_DWT_Advance(100);
+	CRITICAL_ENTER(IRQ_PRIO_TIMER);
+	Sim_DWT_Advance(50);
+	CRITICAL_EXIT();
+	Sim_DWT_Advance(20);
+	CRITICAL_EXIT();
+	Sim_DWT_Advance(5000);
+	TEST_CHECK_EQ(MCAL_NVIC_Critical_Get_Max_Cycles(), 170);
+	CRITICAL_ENTER(IRQ_PRIO_TIMER);
+	Sim_DWT_Advance(30);
+	CRITICAL_EXIT();
+	TEST_CHECK_EQ(MCAL_NVIC_Critical_Get_Max_Cycles(), 170);
+	outer = MCAL_NVIC_Disable_Global_IRQ();
+	TEST_CHECK_EQ(Sim_PRIMASK, 1);
+	Sim_DWT_Advance(200);
+	CRITICAL_ENTER(IRQ_PRIO_TIMER);
+	Sim_DWT_Advance(300);
+	CRITICAL_EXIT();
+	MCAL_NVIC_Restore_Global_IRQ(outer);
+	TEST_CHECK_EQ(Sim_PRIMASK, 0);
+	TEST_CHECK_EQ(MCAL_NVIC_Critical_Get_Max_Cycles(), 500);
+
+	/* The counter wraps in a minute at 72 MHz, a section across the wrap still counts */
+	Sim_DWT.CYCCNT = 0xFFFFFFF0UL;
+	CRITICAL_ENTER(IRQ_PRIO_TIMER);
+	Sim_DWT_Advance(0x300);
+	CRITICAL_EXIT();
+	TEST_CHECK_EQ(MCAL_NVIC_Critical_Get_Max_Cycles(), 0x300);
+	printf("Worst case masked time: %lu cycles\n", (unsigned long)MCAL_NVIC_Critical_Get_Max_Cycles());
+
+	/* A new measure starts from 0 */
+	MCAL_NVIC_Critical_Measure_Start();
+	TEST_CHECK_EQ(MCAL_NVIC_Critical_Get_Max_Cycles(), 0);
+	TEST_CHECK_EQ(Sim_BASEPRI, 0);
+
+	return TEST_RESULT("test_nvic");
+}
@@ -0,0 +1,150 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_pwm.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* PWM driver on the TIM1...TIM4 model: the 50 Hz servo time base from TIMCLK1
+ * and TIMCLK2, the recorded pulse widths of the channels, compare changes at the
+ * next period, the TIM1 main output, the update interrupt and the prescalers
+ * derived again after a clock change */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "test.h"
+#include "sim_tim.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#define TICK_FREQUENCY	1000000UL	// 1 us tick
+#define PERIOD_TICKS	20000		// 50 Hz
+#define PERIOD_NS		20000000ULL
+#define US_NS			1000ULL
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+static uint16 Next_Compare;
+static unsigned long Update_Calls;
+
+/* Update interrupt: the next width for every period */
+static void Update_CallBack(void){
+	Update_Calls++;
+	Next_Compare += 100;
+	MCAL_PWM_Set_Compare(TIM4, PWM_CHANNEL_3, Next_Compare);
+}
+
+int main(void){
+	PWM_cfg_t config = {TICK_FREQUENCY, PERIOD_TICKS};
+	uint16 compare, expected;
+	uint8 period;
+
+	Sim_TIM_Reset();
+
+	/* TIM4 from TIMCLK1: 1 us ticks, 20 ms period */
+	Sim_TIMCLK1 = 64000000UL;
+	Sim_TIMCLK2 = 32000000UL;
+	MCAL_PWM_Init(TIM4, &config);
+	TEST_CHECK_EQ(Sim_TIM_Clock_Users[3], 1);
+	TEST_CHECK_EQ(TIM4->PSC, 63);
+	TEST_CHECK_EQ(TIM4->ARR, PERIOD_TICKS - 1);
+	TEST_CHECK_EQ(TIM4->CR1, TIM_CR1_CEN | TIM_CR1_ARPE);
+	TEST_CHECK_EQ(TIM4->BDTR, 0);
+
+	/* Channels 3 and 4 share CCMR2, each keeps the bits of the other */
+	MCAL_PWM_Channel_Init(TIM4, PWM_CHANNEL_3, 500);
+	MCAL_PWM_Channel_Init(TIM4, PWM_CHANNEL_4, 1488);
+	TEST_CHECK_EQ(TIM4->CCMR2, ((TIM_CCMR_OC_PWM1 | TIM_CCMR_OC_PE) << 8) | TIM_CCMR_OC_PWM1 | TIM_CCMR_OC_PE);
+	TEST_CHECK_EQ(TIM4->CCMR1, 0);
+	TEST_CHECK_EQ(TIM4->CCR3, 500);
+	TEST_CHECK_EQ(TIM4->CCR4, 1488);
+	TEST_CHECK_EQ(TIM4->CCER, (1UL << 8) | (1UL << 12));
+	Sim_TIM_Run(TIM4, 1);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].Period_ns, PERIOD_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[2], 500 * US_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[3], 1488 * US_NS);
+	TEST_CHECK(Sim_TIM_Wave[3].Enabled[2] && Sim_TIM_Wave[3].Enabled[3]);
+	TEST_CHECK(!Sim_TIM_Wave[3].Enabled[0] && !Sim_TIM_Wave[3].Enabled[1]);
+
+	/* A channel number out of range changes nothing */
+	MCAL_PWM_Channel_Init(TIM4, 5, 100);
+	TEST_CHECK_EQ(TIM4->CCER, (1UL << 8) | (1UL << 12));
+	TEST_CHECK_EQ(TIM4->CCR1 | TIM4->CCR2, 0);
+
+	/* A new width is applied at the next period, the running one ends with the old width */
+	MCAL_PWM_Set_Compare(TIM4, PWM_CHANNEL_3, 1500);
+	TEST_CHECK_EQ(MCAL_PWM_Get_Compare(TIM4, PWM_CHANNEL_3), 1500);
+	Sim_TIM_Run(TIM4, 1);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[2], 500 * US_NS);
+	Sim_TIM_Run(TIM4, 1);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[2], 1500 * US_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].Period_ns, PERIOD_NS);
+
+	/* Full and empty pulses */
+	MCAL_PWM_Set_Compare(TIM4, PWM_CHANNEL_3, PERIOD_TICKS);
+	MCAL_PWM_Set_Compare(TIM4, PWM_CHANNEL_4, 0);
+	Sim_TIM_Run(TIM4, 2);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[2], PERIOD_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[3], 0);
+
+	/* TIM1 from TIMCLK2, its outputs only drive the pins with MOE */
+	MCAL_PWM_Init(TIM1, &config);
+	TEST_CHECK_EQ(Sim_TIM_Clock_Users[0], 1);
+	TEST_CHECK_EQ(TIM1->PSC, 31);
+	TEST_CHECK(TIM1->BDTR & TIM_BDTR_MOE);
+	MCAL_PWM_Channel_Init(TIM1, PWM_CHANNEL_4, 250);
+	Sim_TIM_Run(TIM1, 1);
+	TEST_CHECK_EQ(Sim_TIM_Wave[0].Period_ns, PERIOD_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[0].High_ns[3], 250 * US_NS);
+	TEST_CHECK(Sim_TIM_Wave[0].Enabled[3]);
+
+	/* Update interrupt at the start of every period: the shadow CCR is already loaded
+	 * so its width shows in the period after the one starting */
+	Next_Compare = 1000;
+	MCAL_PWM_Set_Compare(TIM4, PWM_CHANNEL_3, Next_Compare);
+	Sim_TIM_Run(TIM4, 1);
+	MCAL_PWM_Enable_Update_IRQ(TIM4, Update_CallBack);
+	TEST_CHECK(TIM4->DIER & TIM_DIER_UIE);
+	TEST_CHECK(Sim_NVIC_Enabled & (1ULL << TIM4_IRQ));
+	expected = Next_Compare;
+	for(period = 0; period < 10; period++){
+		compare = Next_Compare;
+		Sim_TIM_Run(TIM4, 1);
+		TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[2], expected * US_NS);
+		expected = compare;
+	}
+	TEST_CHECK_EQ(Update_Calls, 10);
+	TEST_CHECK_EQ(Sim_TIM_Updates[3], 10);
+	TEST_CHECK_EQ(Sim_TIM_Updates[0], 0);
+
+	/* Clock change: both timers get their prescalers back to 1 us ticks, the running period
+	 * ends on the old prescaler, then the period and widths are the same again */
+	Sim_TIM_Set_Clocks(8000000UL, 8000000UL);
+	TEST_CHECK_EQ(TIM4->PSC, 7);
+	TEST_CHECK_EQ(TIM1->PSC, 7);
+	TEST_CHECK_EQ(TIM3->PSC, 0);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].Period_ns, PERIOD_NS);
+	Sim_TIM_Run(TIM4, 1);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].Period_ns, PERIOD_NS * 8);
+	Sim_TIM_Run(TIM4, 1);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].Period_ns, PERIOD_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[2], (Next_Compare - 200) * US_NS);	// Written two updates ago
+	Sim_TIM_Run(TIM1, 2);
+	TEST_CHECK_EQ(Sim_TIM_Wave[0].Period_ns, PERIOD_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[0].High_ns[3], 250 * US_NS);
+
+	/* A tick frequency given after the init is also kept across clock changes */
+	MCAL_PWM_Set_Tick_Frequency(TIM4, 2 * TICK_FREQUENCY);
+	Sim_TIM_Set_Clocks(72000000UL, 72000000UL);
+	TEST_CHECK_EQ(TIM4->PSC, 35);
+	TEST_CHECK_EQ(TIM1->PSC, 71);
+	Sim_TIM_Run(TIM4, 2);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].Period_ns, PERIOD_NS / 2);
+	TEST_CHECK_EQ(Sim_TIM_Violations, 0);
+
+	return TEST_RESULT("test_pwm");
+}
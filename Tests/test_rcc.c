@@ -0,0 +1,399 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_rcc.c 			                             	 */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* RCC driver on a simulated RCC and FLASH register block: every switch
+ * between the clock configurations follows the hardware rules and gives
+ * the expected registers, clock tree and TIM2 prescaler, the tree is cached
+ * until the next switch and the clock callbacks see the new one, peripheral
+ * clocks are on exactly while they have users */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <string.h>
+#include "test.h"
+#include "sim_time.h"
+#include "RCC_driver.h"
+
+TEST_MAIN_DEFINITIONS;
+
+//----------------------------------------------
+// Section: Simulated RCC and FLASH
+//----------------------------------------------
+#define SIM_CR_HSION		(1UL<<0)
+#define SIM_CR_HSIRDY		(1UL<<1)
+#define SIM_CR_HSEON		(1UL<<16)
+#define SIM_CR_HSERDY		(1UL<<17)
+#define SIM_CR_PLLON		(1UL<<24)
+#define SIM_CR_PLLRDY		(1UL<<25)
+#define SIM_CFGR_PLL_BITS	(0x3FUL<<16)	// PLLSRC, PLLXTPRE, PLLMUL
+#define SIM_ACR_PRFTBE		(1UL<<4)
+
+static RCC_TypeDef Sim_RCC_Regs;
+static FLASH_TypeDef Sim_FLASH_Regs;
+static RCC_TypeDef Sim_RCC_Last;			// Registers at the previous access
+static unsigned long Sim_RCC_Accesses, Sim_Violations;
+static uint32 Sim_Max_SYSCLK;
+
+static void Sim_Violation(const char* what){
+	if(0 == Sim_Violations){
+		printf("hardware rule broken: %s (CR %08lX CFGR %08lX ACR %08lX)\n", what, (unsigned long)Sim_RCC_Regs.CR,
+				(unsigned long)Sim_RCC_Regs.CFGR, (unsigned long)Sim_FLASH_Regs.ACR);
+	}
+	else{ /* Do Nothing */ }
+	Sim_Violations++;
+}
+
+/* SYSCLK of the clock the core runs from, from the switch status */
+static uint32 Sim_SYSCLK(void){
+	uint32 cfgr = Sim_RCC_Regs.CFGR;
+	uint32 mul = ((cfgr >> 18) & 0xFUL) + 2;
+
+	switch((cfgr >> 2) & 3UL){
+	case 0: return 8000000UL;
+	case 1: return 8000000UL;
+	case 2: return ((cfgr & (1UL<<16)) ? ((cfgr & (1UL<<17)) ? 4000000UL : 8000000UL) : 4000000UL) * ((mul > 16) ? 16 : mul);
+	default: return 0;
+	}
+}
+
+/* The last write took effect: ready flags follow the enables, the switch status follows
+ * the switch once the selected clock is ready, and the running clock tree is checked */
+static void Sim_Hardware(void){
+	uint32 cr = Sim_RCC_Regs.CR;
+	uint32 cfgr = Sim_RCC_Regs.CFGR;
+	uint32 sw = cfgr & 3UL, sws;
+	uint32 pll_input_ready = (cfgr & (1UL<<16)) ? (cr & SIM_CR_HSERDY) : (cr & SIM_CR_HSIRDY);
+	uint32 hclk, pclk1, latency, latency_max;
+	static const uint32 ahb_shift[16] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 7, 8, 9};
+
+	if(((cfgr ^ Sim_RCC_Last.CFGR) & SIM_CFGR_PLL_BITS) && (Sim_RCC_Last.CR & SIM_CR_PLLON)){
+		Sim_Violation("PLL configured while on");
+	}
+	else{ /* Do Nothing */ }
+	if((cr & SIM_CR_PLLON) && !(Sim_RCC_Last.CR & SIM_CR_PLLON) && !pll_input_ready){
+		Sim_Violation("PLL started without its input");
+	}
+	else{ /* Do Nothing */ }
+
+	cr = (cr & ~(SIM_CR_HSIRDY | SIM_CR_HSERDY | SIM_CR_PLLRDY)) | ((cr & SIM_CR_HSION) ? SIM_CR_HSIRDY : 0)
+			| ((cr & SIM_CR_HSEON) ? SIM_CR_HSERDY : 0);
+	pll_input_ready = (cfgr & (1UL<<16)) ? (cr & SIM_CR_HSERDY) : (cr & SIM_CR_HSIRDY);
+	cr |= ((cr & SIM_CR_PLLON) && pll_input_ready) ? SIM_CR_PLLRDY : 0;
+
+	/* The switch only happens to a ready clock */
+	if(((0 == sw) && (cr & SIM_CR_HSIRDY)) || ((1 == sw) && (cr & SIM_CR_HSERDY)) || ((2 == sw) && (cr & SIM_CR_PLLRDY))){
+		cfgr = (cfgr & ~(3UL << 2)) | (sw << 2);
+	}
+	else if(sw != ((cfgr >> 2) & 3UL)){
+		Sim_Violation("switch to a clock that is not ready");
+		cfgr = (cfgr & ~(3UL << 2)) | (sw << 2);
+	}
+	else{ /* Do Nothing */ }
+	Sim_RCC_Regs.CR = cr;
+	Sim_RCC_Regs.CFGR = cfgr;
+
+	/* The running clock must not be stopped */
+	sws = (cfgr >> 2) & 3UL;
+	if(((0 == sws) && !(cr & SIM_CR_HSIRDY)) || ((1 == sws) && !(cr & SIM_CR_HSERDY)) || ((2 == sws) && !(cr & SIM_CR_PLLRDY))){
+		Sim_Violation("system clock stopped");
+	}
+	else{ /* Do Nothing */ }
+
+	/* Wait states for the core speed, APB1 at most 36 MHz */
+	hclk = Sim_SYSCLK() >> ahb_shift[(cfgr >> 4) & 0xFUL];
+	pclk1 = (((cfgr >> 8) & 4UL) ? (hclk >> (((cfgr >> 8) & 3UL) + 1)) : hclk);
+	latency = Sim_FLASH_Regs.ACR & 7UL;
+	latency_max = (0 == latency) ? 24000000UL : ((1 == latency) ? 48000000UL : 72000000UL);
+	if(hclk > latency_max){
+		Sim_Violation("too few flash wait states");
+	}
+	else{ /* Do Nothing */ }
+	if(pclk1 > 36000000UL){
+		Sim_Violation("APB1 above 36 MHz");
+	}
+	else{ /* Do Nothing */ }
+	if(!(Sim_FLASH_Regs.ACR & SIM_ACR_PRFTBE)){
+		Sim_Violation("prefetch buffer off");
+	}
+	else{ /* Do Nothing */ }
+	Sim_Max_SYSCLK = (Sim_SYSCLK() > Sim_Max_SYSCLK) ? Sim_SYSCLK() : Sim_Max_SYSCLK;
+
+	Sim_RCC_Last = Sim_RCC_Regs;
+}
+
+static RCC_TypeDef* Sim_RCC(void){
+	Sim_Hardware();
+	Sim_RCC_Accesses++;
+	return &Sim_RCC_Regs;
+}
+
+static FLASH_TypeDef* Sim_FLASH(void){
+	Sim_Hardware();
+	return &Sim_FLASH_Regs;
+}
+
+/* Power on: HSI running, no wait states, prefetch on */
+static void Sim_Reset(void){
+	memset(&Sim_RCC_Regs, 0, sizeof(Sim_RCC_Regs));
+	memset(&Sim_FLASH_Regs, 0, sizeof(Sim_FLASH_Regs));
+	Sim_RCC_Regs.CR = SIM_CR_HSION | SIM_CR_HSIRDY | (0x10UL << 3);
+	Sim_FLASH_Regs.ACR = 0x30UL;
+	Sim_RCC_Last = Sim_RCC_Regs;
+}
+
+/* The RCC driver on the simulated registers */
+#undef RCC
+#undef FLASH
+#define RCC		(Sim_RCC())
+#define FLASH	(Sim_FLASH())
+#include "../MCAL/RCC_driver.c"
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+typedef struct{
+	const char*		Name;
+	uint8			Clock;
+	uint32			CR_On;		// HSEON, HSION and PLLON that stay set
+	uint32			SW;
+	uint32			Latency;
+	RCC_ClockTree_t	Tree;
+}Config_t;
+
+static const Config_t Configs[] = {
+		{"HSI 8 MHz",     RCC_SELECT_HSI,     SIM_CR_HSION,                0, 0, { 8000000UL,  8000000UL,  8000000UL,  8000000UL,  8000000UL,  8000000UL}},
+		{"HSE 8 MHz",     RCC_SELECT_HSE,     SIM_CR_HSEON,                1, 0, { 8000000UL,  8000000UL,  8000000UL,  8000000UL,  8000000UL,  8000000UL}},
+		{"PLL HSE 72 MHz", RCC_SELECT_PLL,    SIM_CR_HSEON | SIM_CR_PLLON, 2, 2, {72000000UL, 72000000UL, 36000000UL, 72000000UL, 72000000UL, 72000000UL}},
+		{"PLL HSI 64 MHz", RCC_SELECT_PLL_HSI, SIM_CR_HSION | SIM_CR_PLLON, 2, 2, {64000000UL, 64000000UL, 32000000UL, 64000000UL, 64000000UL, 64000000UL}},
+};
+#define CONFIGS_COUNT	(sizeof(Configs) / sizeof(Configs[0]))
+
+/* Clock callbacks record their call order and the SYSCLK they read */
+static uint8 CallBack_Order[RCC_MAX_CLOCK_CALLBACKS];
+static uint8 CallBack_Calls;
+static uint32 CallBack_SYSCLK;
+
+static void CallBack_Record(uint8 id){
+	if(CallBack_Calls < RCC_MAX_CLOCK_CALLBACKS){
+		CallBack_Order[CallBack_Calls] = id;
+	}
+	else{ /* Do Nothing */ }
+	CallBack_Calls++;
+}
+static void CallBack_A(void){
+	CallBack_Record(1);
+	CallBack_SYSCLK = MCAL_RCC_GetSYS_CLKFreq();
+}
+static void CallBack_B(void){ CallBack_Record(2); }
+static void CallBack_Filler(void){ CallBack_Record(3); }
+static void CallBack_Filler_2(void){ CallBack_Record(4); }
+static void CallBack_Filler_3(void){ CallBack_Record(5); }
+static void CallBack_Filler_4(void){ CallBack_Record(6); }
+static void CallBack_Filler_5(void){ CallBack_Record(7); }
+static void CallBack_Extra(void){ CallBack_Record(8); }
+
+static uint32 Seed = 12345;
+
+static uint32 Random(void){
+	Seed = (Seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+	return (Seed >> 8) & 0xFFFFUL;
+}
+
+/* Registers and derived frequencies of a configuration */
+static void Check_Config(const Config_t* config, const char* from){
+	RCC_ClockTree_t tree;
+	unsigned long failures = Test_Failures;
+
+	MCAL_RCC_Get_Clock_Tree(&tree);
+	TEST_CHECK_EQ(Sim_RCC_Regs.CR & (SIM_CR_HSION | SIM_CR_HSEON | SIM_CR_PLLON), config->CR_On);
+	TEST_CHECK_EQ((Sim_RCC_Regs.CFGR >> 2) & 3UL, config->SW);
+	TEST_CHECK_EQ(Sim_RCC_Regs.CFGR & 0xF0UL, 0);								// AHB not divided
+	TEST_CHECK_EQ((Sim_RCC_Regs.CFGR >> 11) & 7UL, 0);							// APB2 not divided
+	TEST_CHECK_EQ(Sim_FLASH_Regs.ACR & 7UL, config->Latency);
+	TEST_CHECK_EQ(tree.SYSCLK, config->Tree.SYSCLK);
+	TEST_CHECK_EQ(tree.HCLK, config->Tree.HCLK);
+	TEST_CHECK_EQ(tree.PCLK1, config->Tree.PCLK1);
+	TEST_CHECK_EQ(tree.PCLK2, config->Tree.PCLK2);
+	TEST_CHECK_EQ(tree.TIMCLK1, config->Tree.TIMCLK1);
+	TEST_CHECK_EQ(tree.TIMCLK2, config->Tree.TIMCLK2);
+	TEST_CHECK_EQ(tree.SYSCLK, Sim_SYSCLK());
+	TEST_CHECK_EQ(MCAL_RCC_GetSYS_CLKFreq(), config->Tree.SYSCLK);
+	TEST_CHECK_EQ(MCAL_RCC_GetHCLKFreq(), config->Tree.HCLK);
+	TEST_CHECK_EQ(MCAL_RCC_GetPCLK1Freq(), config->Tree.PCLK1);
+	TEST_CHECK_EQ(MCAL_RCC_GetPCLK2Freq(), config->Tree.PCLK2);
+	/* TIM2 keeps its 1 MHz tick through the clock callback */
+	TEST_CHECK_EQ(Sim_TIM2_Prescaler(), (config->Tree.TIMCLK1 / 1000000UL) - 1);
+	if(failures != Test_Failures){
+		printf("%s from %s\n", config->Name, from);
+	}
+	else{ /* Do Nothing */ }
+}
+
+int main(void){
+	uint8 from, to;
+	uint32 cr, cfgr, acr;
+	unsigned long accesses, step;
+	RCC_ClockTree_t tree;
+	uint8 users[RCC_PERIPHERALS_COUNT] = {0};
+	uint32 expected;
+
+	Sim_Reset();
+	Timer2_init();
+	TEST_CHECK_EQ(Sim_TIM2_Prescaler(), 7);
+
+	/* Every configuration from every other one, and again from itself */
+	for(from = 0; from < CONFIGS_COUNT; from++){
+		for(to = 0; to < CONFIGS_COUNT; to++){
+			MCAL_RCC_Select_Clock(Configs[from].Clock);
+			Check_Config(&Configs[from], "reset");
+			Sim_Max_SYSCLK = 0;
+			MCAL_RCC_Select_Clock(Configs[to].Clock);
+			Check_Config(&Configs[to], Configs[from].Name);
+			/* Never faster than the slower of the two on the way */
+			TEST_CHECK(Sim_Max_SYSCLK <= ((Configs[from].Tree.SYSCLK > Configs[to].Tree.SYSCLK) ? Configs[from].Tree.SYSCLK : Configs[to].Tree.SYSCLK));
+		}
+	}
+	printf("%lu clock switches, %lu hardware rules broken\n", (unsigned long)(2 * CONFIGS_COUNT * CONFIGS_COUNT), Sim_Violations);
+	TEST_CHECK_EQ(Sim_Violations, 0);
+
+	/* An unknown source changes nothing */
+	cr = Sim_RCC_Regs.CR;
+	cfgr = Sim_RCC_Regs.CFGR;
+	acr = Sim_FLASH_Regs.ACR;
+	MCAL_RCC_Select_Clock(0x7F);
+	TEST_CHECK_EQ(Sim_RCC_Regs.CR, cr);
+	TEST_CHECK_EQ(Sim_RCC_Regs.CFGR, cfgr);
+	TEST_CHECK_EQ(Sim_FLASH_Regs.ACR, acr);
+
+	/* HSI for the flash controller: started and stopped around a PLL on HSE, kept when it is the source */
+	MCAL_RCC_Select_Clock(RCC_SELECT_PLL);
+	TEST_CHECK_EQ(MCAL_RCC_Enable_HSI(), 0);
+	TEST_CHECK(Sim_RCC_Regs.CR & SIM_CR_HSIRDY);
+	TEST_CHECK_EQ(MCAL_RCC_Enable_HSI(), 1);
+	MCAL_RCC_Disable_HSI();
+	TEST_CHECK_EQ(Sim_RCC_Regs.CR & SIM_CR_HSION, 0);
+	MCAL_RCC_Select_Clock(RCC_SELECT_PLL_HSI);
+	MCAL_RCC_Disable_HSI();
+	TEST_CHECK(Sim_RCC_Regs.CR & SIM_CR_HSION);
+	MCAL_RCC_Select_Clock(RCC_SELECT_HSI);
+	MCAL_RCC_Disable_HSI();
+	TEST_CHECK(Sim_RCC_Regs.CR & SIM_CR_HSION);
+	TEST_CHECK_EQ(Sim_Violations, 0);
+
+	/* Queries after the first one read no register, until the next switch
+	 * (here the first one is Timer2_Reclock, called back by the switch) */
+	MCAL_RCC_Select_Clock(RCC_SELECT_PLL);
+	accesses = Sim_RCC_Accesses;
+	for(from = 0; from < 100; from++){
+		MCAL_RCC_Get_Clock_Tree(&tree);
+		MCAL_RCC_GetSYS_CLKFreq();
+		MCAL_RCC_GetHCLKFreq();
+		MCAL_RCC_GetPCLK1Freq();
+		MCAL_RCC_GetPCLK2Freq();
+	}
+	TEST_CHECK_EQ(Sim_RCC_Accesses, accesses);
+	TEST_CHECK_EQ(tree.SYSCLK, 72000000UL);
+	MCAL_RCC_Select_Clock(RCC_SELECT_HSE);
+	MCAL_RCC_Get_Clock_Tree(&tree);
+	TEST_CHECK_EQ(tree.SYSCLK, 8000000UL);
+	TEST_CHECK_EQ(tree.PCLK1, 8000000UL);
+
+	/* Callbacks: called once each in registration order after every switch, with the new tree */
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(CallBack_A), 1);
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(CallBack_B), 1);
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(CallBack_A), 1);
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(NULL), 0);
+	MCAL_RCC_Select_Clock(RCC_SELECT_PLL_HSI);
+	TEST_CHECK_EQ(CallBack_Calls, 2);
+	TEST_CHECK_EQ(CallBack_Order[0], 1);
+	TEST_CHECK_EQ(CallBack_Order[1], 2);
+	TEST_CHECK_EQ(CallBack_SYSCLK, 64000000UL);
+	TEST_CHECK_EQ(Sim_TIM2_Prescaler(), 63);
+	CallBack_Calls = 0;
+	MCAL_RCC_Select_Clock(RCC_SELECT_HSI);
+	TEST_CHECK_EQ(CallBack_Calls, 2);
+	TEST_CHECK_EQ(CallBack_SYSCLK, 8000000UL);
+
+	/* The table holds RCC_MAX_CLOCK_CALLBACKS functions, Timer2_Reclock is the first */
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(CallBack_Filler), 1);
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(CallBack_Filler_2), 1);
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(CallBack_Filler_3), 1);
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(CallBack_Filler_4), 1);
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(CallBack_Filler_5), 1);
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(CallBack_Extra), 0);
+	TEST_CHECK_EQ(MCAL_RCC_Add_Clock_CallBack(CallBack_B), 1);
+	CallBack_Calls = 0;
+	MCAL_RCC_Select_Clock(RCC_SELECT_PLL);
+	TEST_CHECK_EQ(CallBack_Calls, RCC_MAX_CLOCK_CALLBACKS - 1);
+	for(from = 0; from < (RCC_MAX_CLOCK_CALLBACKS - 1); from++){
+		TEST_CHECK_EQ(CallBack_Order[from], from + 1);
+	}
+	TEST_CHECK_EQ(Sim_TIM2_Prescaler(), 71);
+	TEST_CHECK_EQ(Sim_Violations, 0);
+
+	/* Each peripheral maps to its own enable bit, a reset leaves the peripheral running */
+	TEST_CHECK_EQ(MCAL_RCC_Get_Clocked_Peripherals(), (1UL << RCC_TIM2));
+	Sim_RCC_Regs.APB1ENR = 0;
+	Sim_RCC_Regs.APB2ENR = 0;
+	Sim_RCC_Regs.AHBENR = 0;
+	for(from = 0; from < RCC_PERIPHERALS_COUNT; from++){
+		MCAL_RCC_Enable_Peripheral(from);
+		TEST_CHECK_EQ(MCAL_RCC_Get_Clocked_Peripherals(), (1UL << from));
+		MCAL_RCC_Reset_Peripheral(from);
+		TEST_CHECK_EQ(Sim_RCC_Regs.APB1RSTR | Sim_RCC_Regs.APB2RSTR, 0);
+		MCAL_RCC_Disable_Peripheral(from);
+		TEST_CHECK_EQ(MCAL_RCC_Get_Clocked_Peripherals(), 0);
+	}
+	TEST_CHECK_EQ(Sim_RCC_Regs.APB1ENR | Sim_RCC_Regs.APB2ENR | Sim_RCC_Regs.AHBENR, 0);
+	MCAL_RCC_Enable_Peripheral(RCC_PERIPHERALS_COUNT);
+	TEST_CHECK_EQ(MCAL_RCC_Get_Clocked_Peripherals(), 0);
+	MCAL_RCC_Enable_Peripheral(RCC_TIM2);
+
+	/* Reference counts: the clock goes off with the last release only */
+	MCAL_RCC_Acquire_Peripheral(RCC_USART1);
+	MCAL_RCC_Acquire_Peripheral(RCC_USART1);
+	MCAL_RCC_Release_Peripheral(RCC_USART1);
+	TEST_CHECK(MCAL_RCC_Get_Clocked_Peripherals() & (1UL << RCC_USART1));
+	MCAL_RCC_Release_Peripheral(RCC_USART1);
+	TEST_CHECK_EQ(MCAL_RCC_Get_Clocked_Peripherals() & (1UL << RCC_USART1), 0);
+	MCAL_RCC_Release_Peripheral(RCC_USART1);
+	MCAL_RCC_Acquire_Peripheral(RCC_USART1);
+	MCAL_RCC_Release_Peripheral(RCC_USART1);
+	TEST_CHECK_EQ(MCAL_RCC_Get_Clocked_Peripherals() & (1UL << RCC_USART1), 0);
+	MCAL_RCC_Release_Peripheral(RCC_PERIPHERALS_COUNT);
+	/* TIM2 was taken by Timer2_init */
+	MCAL_RCC_Release_Peripheral(RCC_TIM2);
+	TEST_CHECK_EQ(MCAL_RCC_Get_Clocked_Peripherals(), 0);
+
+	/* Random acquires and releases against a model of the counts: each clock is on at every step exactly while it has users */
+	for(step = 0; step < 100000UL; step++){
+		from = (uint8)(Random() % RCC_PERIPHERALS_COUNT);
+		if((Random() & 1) && (users[from] < 5)){
+			MCAL_RCC_Acquire_Peripheral(from);
+			users[from]++;
+		}
+		else{
+			MCAL_RCC_Release_Peripheral(from);
+			users[from] -= (users[from] > 0);
+		}
+		expected = 0;
+		for(to = 0; to < RCC_PERIPHERALS_COUNT; to++){
+			expected |= (users[to] ? (1UL << to) : 0);
+		}
+		if(MCAL_RCC_Get_Clocked_Peripherals() != expected){
+			printf("step %lu: clocked %08lX, expected %08lX\n", step, (unsigned long)MCAL_RCC_Get_Clocked_Peripherals(), (unsigned long)expected);
+			Test_Failures++;
+			break;
+		}
+		else{ /* Do Nothing */ }
+	}
+
+	return TEST_RESULT("test_rcc");
+}
@@ -0,0 +1,186 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_servo.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* Servo table on the TIM1...TIM4 model: calibrated pulse of every angle, inverted
+ * arms, servos on two timers stepped by the update interrupt of the first one,
+ * bounded steps and one done callback per move at the target angle */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "test.h"
+#include "sim_tim.h"
+#include "Servo_Motor.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#define SERVOS			3
+#define MAX_PERIODS		1000
+#define MAX_STEP_US		((SERVO_MAX_VELOCITY * SERVO_PERIOD_MS) / 1000 + 1)
+#define US_NS			1000ULL
+
+//----------------------------------------------
+// Section: Simulated GPIO and BASEPRI
+//----------------------------------------------
+static uint16 Sim_AF_Pins;
+static unsigned long Sim_Critical_Depth, Sim_Criticals;
+
+void MCAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_PinConfig_t* PinConfig){
+	(void)GPIOx;
+	TEST_CHECK_EQ(PinConfig->GPIO_MODE, GPIO_MODE_OUTPUT_AF_PP);
+	Sim_AF_Pins |= PinConfig->GPIO_PinNumber;
+}
+uint32 MCAL_NVIC_Critical_Enter(uint8 level){
+	TEST_CHECK_EQ(level, SERVO_CRITICAL_LEVEL);
+	Sim_Critical_Depth++;
+	Sim_Criticals++;
+	return 0;
+}
+void MCAL_NVIC_Critical_Exit(uint32 basepri){ (void)basepri; Sim_Critical_Depth--; }
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+
+/* Two arms on TIM4 like the gates, the second one inverted, a third one on TIM3 */
+static const Servo_t Servos[SERVOS] = {
+		{GPIOB, GPIO_PIN_8, TIM4, PWM_CHANNEL_3, 500, 2500, 0, 0},
+		{GPIOB, GPIO_PIN_9, TIM4, PWM_CHANNEL_4, 500, 1488, 1, 0},
+		{GPIOA, GPIO_PIN_6, TIM3, PWM_CHANNEL_1, 1000, 2000, 0, 45}
+};
+
+static unsigned long Done_Count[SERVOS];
+static uint8 Done_Angle[SERVOS];
+static uint16 Done_Compare[SERVOS];
+
+/* Pulse of an angle from the calibration, 0 degree is Max_Pulse_us on an inverted arm */
+static uint16 Expected_Pulse(uint8 servo, uint8 angle){
+	uint16 span = Servos[servo].Max_Pulse_us - Servos[servo].Min_Pulse_us;
+	uint16 offset = (uint16)(((uint32)span * angle) / SERVO_MAX_ANGLE);
+
+	return Servos[servo].Inverted ? (Servos[servo].Max_Pulse_us - offset) : (Servos[servo].Min_Pulse_us + offset);
+}
+
+static void Done_CallBack(uint8 Servo, uint8 Angle){
+	TEST_CHECK(Servo < SERVOS);
+	Done_Count[Servo]++;
+	Done_Angle[Servo] = Angle;
+	Done_Compare[Servo] = MCAL_PWM_Get_Compare(Servos[Servo].Timer, Servos[Servo].Channel);
+	TEST_CHECK(!Servo_Is_Moving(Servo));
+}
+
+/* Runs the TIM4 periods until no servo moves, checks that no step is larger than the
+ * velocity allows, returns the number of periods */
+static unsigned long Run_Until_Stopped(void){
+	uint16 last[SERVOS], compare;
+	unsigned long periods;
+	uint8 servo, moving = 1;
+
+	for(servo = 0; servo < SERVOS; servo++){
+		last[servo] = MCAL_PWM_Get_Compare(Servos[servo].Timer, Servos[servo].Channel);
+	}
+	for(periods = 0; moving && (periods < MAX_PERIODS); periods++){
+		Sim_TIM_Run(TIM4, 1);
+		moving = 0;
+		for(servo = 0; servo < SERVOS; servo++){
+			compare = MCAL_PWM_Get_Compare(Servos[servo].Timer, Servos[servo].Channel);
+			TEST_CHECK(((compare > last[servo]) ? (compare - last[servo]) : (last[servo] - compare)) <= MAX_STEP_US);
+			last[servo] = compare;
+			moving |= Servo_Is_Moving(servo);
+		}
+	}
+	TEST_CHECK(!moving);
+	return periods;
+}
+
+int main(void){
+	unsigned long periods;
+	uint8 servo, angle;
+
+	Sim_TIM_Reset();
+	Servo_Set_Done_CallBack(Done_CallBack);
+	Servo_Init(Servos, SERVOS);
+
+	/* Each timer started once at 50 Hz, only the update interrupt of the first servo's timer */
+	TEST_CHECK_EQ(Sim_AF_Pins, GPIO_PIN_6 | GPIO_PIN_8 | GPIO_PIN_9);
+	TEST_CHECK_EQ(Sim_TIM_Clock_Users[3], 1);
+	TEST_CHECK_EQ(Sim_TIM_Clock_Users[2], 1);
+	TEST_CHECK_EQ(Sim_NVIC_Enabled, 1ULL << TIM4_IRQ);
+
+	/* Initial angles held from the first period */
+	Sim_TIM_Run(TIM4, 1);
+	Sim_TIM_Run(TIM3, 1);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].Period_ns, SERVO_PERIOD_US * US_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[2].Period_ns, SERVO_PERIOD_US * US_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[2], 500 * US_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[3], 1488 * US_NS);
+	TEST_CHECK_EQ(Sim_TIM_Wave[2].High_ns[0], 1500 * US_NS);
+
+	/* Every angle of the normal and the inverted arm on TIM4: the last step is written by the
+	 * update interrupt after the shadow load, it drives the pin from the second period */
+	for(angle = 0; angle <= SERVO_MAX_ANGLE; angle += 5){
+		Servo_Set(0, angle);
+		Servo_Set(1, (uint8)(SERVO_MAX_ANGLE - angle));
+		Run_Until_Stopped();
+		Sim_TIM_Run(TIM4, 2);
+		TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[2], Expected_Pulse(0, angle) * US_NS);
+		TEST_CHECK_EQ(Sim_TIM_Wave[3].High_ns[3], Expected_Pulse(1, SERVO_MAX_ANGLE - angle) * US_NS);
+		TEST_CHECK_EQ(Done_Angle[0], angle);
+		TEST_CHECK_EQ(Done_Compare[0], Expected_Pulse(0, angle));
+		TEST_CHECK_EQ(Done_Angle[1], SERVO_MAX_ANGLE - angle);
+		TEST_CHECK_EQ(Done_Compare[1], Expected_Pulse(1, SERVO_MAX_ANGLE - angle));
+	}
+	TEST_CHECK_EQ(Done_Count[0], SERVO_MAX_ANGLE / 5 + 1);
+	TEST_CHECK_EQ(Done_Count[1], SERVO_MAX_ANGLE / 5 + 1);
+	TEST_CHECK_EQ(Expected_Pulse(1, SERVO_MAX_ANGLE), 500);
+
+	/* All three at once, the TIM3 arm also stepped by the TIM4 interrupt: one callback each */
+	Done_Count[0] = Done_Count[1] = Done_Count[2] = 0;
+	Servo_Set(0, 10);
+	Servo_Set(1, 80);
+	Servo_Set(2, 90);
+	for(servo = 0; servo < SERVOS; servo++){
+		TEST_CHECK(Servo_Is_Moving(servo));
+	}
+	periods = Run_Until_Stopped();
+	printf("Three arms moved in %lu periods\n", periods);
+	TEST_CHECK(periods > 10);
+	TEST_CHECK_EQ(Sim_TIM_Updates[2], 0);
+	Sim_TIM_Run(TIM3, 2);
+	TEST_CHECK_EQ(Sim_TIM_Wave[2].High_ns[0], 2000 * US_NS);
+	for(servo = 0; servo < SERVOS; servo++){
+		TEST_CHECK_EQ(Done_Count[servo], 1);
+	}
+	TEST_CHECK_EQ(Done_Angle[2], 90);
+	TEST_CHECK_EQ(Done_Compare[2], 2000);
+
+	/* Past the travel: clamped, the same angle again: reported at once without a move */
+	Servo_Set(2, 200);
+	TEST_CHECK(!Servo_Is_Moving(2));
+	TEST_CHECK_EQ(Done_Count[2], 2);
+	TEST_CHECK_EQ(Done_Angle[2], SERVO_MAX_ANGLE);
+	Servo_Set(SERVOS, 10);
+	TEST_CHECK_EQ(Done_Count[0] + Done_Count[1] + Done_Count[2], 4);
+
+	/* A move restarted halfway ends once, at the last target */
+	Servo_Set(0, 90);
+	Sim_TIM_Run(TIM4, 20);
+	TEST_CHECK(Servo_Is_Moving(0));
+	Servo_Set(0, 30);
+	Run_Until_Stopped();
+	TEST_CHECK_EQ(Done_Count[0], 2);
+	TEST_CHECK_EQ(Done_Angle[0], 30);
+	TEST_CHECK_EQ(Done_Compare[0], Expected_Pulse(0, 30));
+
+	TEST_CHECK_EQ(Sim_Critical_Depth, 0);
+	TEST_CHECK(Sim_Criticals > 0);
+	TEST_CHECK_EQ(Sim_TIM_Violations, 0);
+
+	return TEST_RESULT("test_servo");
+}
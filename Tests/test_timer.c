@@ -0,0 +1,65 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_timer.c 			                             */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* dus() on the TIM2 model: the wait must cover the requested time whatever
+ * the phase of the prescaler when CNT is cleared, also across the 50 ms period */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include "test.h"
+#include "sim_time.h"
+
+TEST_MAIN_DEFINITIONS;
+
+int main(void){
+	static const int waits_us[] = {1, 2, 37, 41, 1520, 4100};
+	static const int long_waits_us[] = {49999, 50000, 50001, 123456};
+	unsigned long long start, elapsed, shortest, longest;
+	unsigned int index, phase;
+
+	/* CNT wraps to 0 after ARR like on the board */
+	Timer2_init();
+
+	for(index = 0; index < (sizeof(waits_us) / sizeof(waits_us[0])); index++){
+		shortest = ~0ULL;
+		longest = 0;
+		/* Every prescaler phase, 7 ns apart */
+		for(phase = 0; phase < 1000; phase += 7){
+			Sim_Time_Advance((1000ULL - (Sim_Time_ns % 1000ULL) + phase) % 1000ULL);
+			start = Sim_Time_ns;
+			dus(waits_us[index]);
+			elapsed = Sim_Time_ns - start;
+			shortest = (elapsed < shortest) ? elapsed : shortest;
+			longest = (elapsed > longest) ? elapsed : longest;
+		}
+		printf("dus(%d): %llu...%llu ns\n", waits_us[index], shortest, longest);
+		TEST_CHECK(shortest >= (waits_us[index] * 1000ULL));
+		TEST_CHECK(longest <= ((waits_us[index] + 1) * 1000ULL + 2 * SIM_TIME_CNT_ACCESS_NS));
+	}
+
+	/* One period and more: the count wraps during the wait, a few prescaler phases */
+	for(index = 0; index < (sizeof(long_waits_us) / sizeof(long_waits_us[0])); index++){
+		for(phase = 0; phase < 1000; phase += 333){
+			Sim_Time_Advance((1000ULL - (Sim_Time_ns % 1000ULL) + phase) % 1000ULL);
+			start = Sim_Time_ns;
+			dus(long_waits_us[index]);
+			elapsed = Sim_Time_ns - start;
+			TEST_CHECK(elapsed >= (long_waits_us[index] * 1000ULL));
+			TEST_CHECK(elapsed <= ((long_waits_us[index] + 1) * 1000ULL + 2 * SIM_TIME_CNT_ACCESS_NS));
+		}
+		printf("dus(%d): %llu ns\n", long_waits_us[index], elapsed);
+	}
+
+	start = Sim_Time_ns;
+	dms(2);
+	TEST_CHECK((Sim_Time_ns - start) >= 2000000ULL);
+
+	return TEST_RESULT("test_timer");
+}
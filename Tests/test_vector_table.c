@@ -0,0 +1,176 @@
+/*************************************************************************/
+/* Author        : Omar Yamany                                    		 */
+/* Project       : Smart_Car_Parking_STM32F103  	                     */
+/* File          : test_vector_table.c 			                         */
+/* Date          : Oct 18, 2026                                          */
+/* Version       : V1                                                    */
+/* GitHub        : https://github.com/Piistachyoo             		     */
+/*************************************************************************/
+
+/* SRAM vector table on the NVIC/SCB model: copy of the flash table, alignment
+ * and VTOR write with the interrupts masked, handlers installed and read back
+ * for IRQs and system exceptions, invalid numbers rejected, and the cost of the
+ * direct vector against the fixed ISR calling the callback, on the DWT probe */
+
+//----------------------------------------------
+// Section: Includes
+//----------------------------------------------
+#include <stdint.h>
+#include <string.h>
+#include "test.h"
+#include "sim_nvic.h"
+
+TEST_MAIN_DEFINITIONS;
+
+#define DISPATCH_CALLS		2000
+#define DISPATCH_BATCHES	25
+#define TABLE_BYTES			(NVIC_VECTORS_COUNT * sizeof(void (*)(void)))
+
+//----------------------------------------------
+// Section: Handlers
+//----------------------------------------------
+static volatile unsigned long Default_Calls, Flash_USART1_Calls, Callback_Calls;
+static void (* volatile USART1_Callback)(void);
+
+static void Default_Handler(void){ Default_Calls++; }
+static void Reset_Handler(void){ }
+static void Flash_SysTick_Handler(void){ }
+static void Callback(void){ Callback_Calls++; }
+static void Other_Callback(void){ }
+
+/* Fixed ISR of the flash table, like USART1_IRQHandler before the relocation */
+static void Flash_USART1_Handler(void){
+	Flash_USART1_Calls++;
+	MCAL_NVIC_ClearPendingIRQ(USART1_IRQ);
+	if(USART1_Callback){
+		USART1_Callback();
+	}
+	else{ /* Do Nothing */ }
+}
+
+/* Takes an interrupt through the vector the core would fetch */
+static void Dispatch(uint8 IRQn){
+	Sim_Vector_Table[16 + IRQn]();
+}
+
+/* Shortest masked time of a batch of interrupts on the DWT probe, host nanoseconds stand in for cycles */
+static uint32 Dispatch_Cost(uint8 IRQn){
+	uint32 best = 0xFFFFFFFFUL, primask;
+	uint16 batch, call;
+
+	for(batch = 0; batch < DISPATCH_BATCHES; batch++){
+		MCAL_NVIC_Critical_Measure_Start();
+		primask = MCAL_NVIC_Disable_Global_IRQ();
+		for(call = 0; call < DISPATCH_CALLS; call++){
+			Dispatch(IRQn);
+		}
+		MCAL_NVIC_Restore_Global_IRQ(primask);
+		best = (MCAL_NVIC_Critical_Get_Max_Cycles() < best) ? MCAL_NVIC_Critical_Get_Max_Cycles() : best;
+	}
+	return best;
+}
+
+//----------------------------------------------
+// Section: Test
+//----------------------------------------------
+int main(void){
+	void (*before[NVIC_VECTORS_COUNT])(void);
+	void (* const * table)(void);
+	uint32 fixed_cost, direct_cost;
+	unsigned long dsbs;
+	uint8 index;
+
+	Sim_NVIC_Reset();
+	for(index = 0; index < NVIC_VECTORS_COUNT; index++){
+		Sim_Flash_Vectors[index] = Default_Handler;
+	}
+	Sim_Flash_Vectors[1] = Reset_Handler;
+	Sim_Flash_Vectors[NVIC_SYSTICK_EXCEPTION] = Flash_SysTick_Handler;
+	Sim_Flash_Vectors[16 + USART1_IRQ] = Flash_USART1_Handler;
+	USART1_Callback = Callback;
+
+	/* Still in flash: nothing can be installed, the flash vectors are read */
+	TEST_CHECK_EQ(MCAL_NVIC_SetHandler(USART1_IRQ, Callback), 0);
+	TEST_CHECK_EQ(MCAL_NVIC_SetSystemHandler(NVIC_SYSTICK_EXCEPTION, Callback), 0);
+	TEST_CHECK(MCAL_NVIC_GetHandler(USART1_IRQ) == Flash_USART1_Handler);
+	TEST_CHECK(Sim_Flash_Vectors[16 + USART1_IRQ] == Flash_USART1_Handler);
+	Dispatch(USART1_IRQ);
+	TEST_CHECK_EQ(Flash_USART1_Calls, 1);
+	TEST_CHECK_EQ(Callback_Calls, 1);
+
+	/* Relocation: every entry copied, 256 byte aligned table, VTOR written with the interrupts masked */
+	TEST_CHECK_EQ(MCAL_NVIC_Relocate_Vector_Table(), 1);
+	table = Sim_Vector_Table;
+	TEST_CHECK(table != (void (* const *)(void))Sim_Flash_Vectors);
+	TEST_CHECK_EQ(memcmp((const void*)table, (const void*)Sim_Flash_Vectors, TABLE_BYTES), 0);
+	TEST_CHECK_EQ((uintptr_t)table % 256, 0);
+	TEST_CHECK_EQ(Sim_SCB.VTOR, (uint32)(uintptr_t)table);
+	TEST_CHECK_EQ(Sim_SCB.VTOR & 0xFFUL, 0);
+	TEST_CHECK_EQ(Sim_VTOR_Writes, 1);
+	TEST_CHECK_EQ(Sim_VTOR_Write_PRIMASK, 1);
+	TEST_CHECK_EQ(Sim_PRIMASK, 0);
+	TEST_CHECK_EQ(Sim_DSBs, 2);
+	TEST_CHECK_EQ(Sim_ISBs, 1);
+	TEST_CHECK(MCAL_NVIC_GetHandler(USART1_IRQ) == Flash_USART1_Handler);
+
+	/* A second call keeps the table and its handlers */
+	TEST_CHECK_EQ(MCAL_NVIC_Relocate_Vector_Table(), 1);
+	TEST_CHECK_EQ(Sim_VTOR_Writes, 1);
+	TEST_CHECK(Sim_Vector_Table == table);
+
+	/* IRQ handlers: installed in the SRAM copy only, each followed by a DSB */
+	dsbs = Sim_DSBs;
+	TEST_CHECK_EQ(MCAL_NVIC_SetHandler(USART1_IRQ, Callback), 1);
+	TEST_CHECK_EQ(MCAL_NVIC_SetHandler(0, Other_Callback), 1);
+	TEST_CHECK_EQ(MCAL_NVIC_SetHandler(NVIC_IRQS_COUNT - 1, Other_Callback), 1);
+	TEST_CHECK_EQ(Sim_DSBs, dsbs + 3);
+	TEST_CHECK(MCAL_NVIC_GetHandler(USART1_IRQ) == Callback);
+	TEST_CHECK(MCAL_NVIC_GetHandler(0) == Other_Callback);
+	TEST_CHECK(MCAL_NVIC_GetHandler(NVIC_IRQS_COUNT - 1) == Other_Callback);
+	TEST_CHECK(table[16 + USART1_IRQ] == Callback);
+	TEST_CHECK(table[16] == Other_Callback);
+	TEST_CHECK(table[15] == Flash_SysTick_Handler);
+	TEST_CHECK(Sim_Flash_Vectors[16 + USART1_IRQ] == Flash_USART1_Handler);
+	Dispatch(USART1_IRQ);
+	TEST_CHECK_EQ(Flash_USART1_Calls, 1);
+	TEST_CHECK_EQ(Callback_Calls, 2);
+
+	/* System exceptions: NMI to SysTick, never the stack pointer or the reset vector */
+	TEST_CHECK_EQ(MCAL_NVIC_SetSystemHandler(NVIC_SYSTICK_EXCEPTION, Callback), 1);
+	TEST_CHECK_EQ(MCAL_NVIC_SetSystemHandler(NVIC_PENDSV_EXCEPTION, Other_Callback), 1);
+	TEST_CHECK_EQ(MCAL_NVIC_SetSystemHandler(2, Other_Callback), 1);
+	TEST_CHECK(table[NVIC_SYSTICK_EXCEPTION] == Callback);
+	TEST_CHECK(table[NVIC_PENDSV_EXCEPTION] == Other_Callback);
+	TEST_CHECK(table[2] == Other_Callback);
+	TEST_CHECK(Sim_Flash_Vectors[NVIC_SYSTICK_EXCEPTION] == Flash_SysTick_Handler);
+
+	/* Out of range numbers and NULL handlers change nothing */
+	memcpy(before, (const void*)table, TABLE_BYTES);
+	TEST_CHECK_EQ(MCAL_NVIC_SetHandler(NVIC_IRQS_COUNT, Callback), 0);
+	TEST_CHECK_EQ(MCAL_NVIC_SetHandler(255, Callback), 0);
+	TEST_CHECK_EQ(MCAL_NVIC_SetHandler(USART2_IRQ, NULL), 0);
+	TEST_CHECK_EQ(MCAL_NVIC_SetSystemHandler(0, Callback), 0);
+	TEST_CHECK_EQ(MCAL_NVIC_SetSystemHandler(1, Callback), 0);
+	TEST_CHECK_EQ(MCAL_NVIC_SetSystemHandler(16, Callback), 0);
+	TEST_CHECK_EQ(MCAL_NVIC_SetSystemHandler(NVIC_SVCALL_EXCEPTION, NULL), 0);
+	TEST_CHECK_EQ(memcmp(before, (const void*)table, TABLE_BYTES), 0);
+	TEST_CHECK(MCAL_NVIC_GetHandler(NVIC_IRQS_COUNT) == NULL);
+	TEST_CHECK(MCAL_NVIC_GetHandler(255) == NULL);
+	TEST_CHECK(table[1] == Reset_Handler);
+
+	/* The callback as the vector against the fixed ISR of the flash table, same batches on the probe */
+	Sim_DWT_Use_Host_Clock(1);
+	TEST_CHECK_EQ(MCAL_NVIC_SetHandler(USART2_IRQ, Flash_USART1_Handler), 1);
+	fixed_cost = Dispatch_Cost(USART2_IRQ);
+	direct_cost = Dispatch_Cost(USART1_IRQ);
+	Sim_DWT_Use_Host_Clock(0);
+	printf("%d interrupts: fixed ISR %lu ns, direct vector %lu ns (x%.2f)\n", DISPATCH_CALLS,
+			(unsigned long)fixed_cost, (unsigned long)direct_cost, (double)fixed_cost / (direct_cost ? direct_cost : 1));
+	TEST_CHECK(direct_cost > 0);
+	TEST_CHECK(direct_cost < fixed_cost);
+	TEST_CHECK_EQ(Callback_Calls, 2 + (2UL * DISPATCH_CALLS * DISPATCH_BATCHES));
+	TEST_CHECK_EQ(Default_Calls, 0);
+	TEST_CHECK_EQ(Sim_PRIMASK, 0);
+
+	return TEST_RESULT("test_vector_table");
+}